@@ -42,6 +42,8 @@ namespace geode
                 &BRepMeshesInspectionResult::meshes_degenerations )
             .def_readwrite( "meshes_intersections",
                 &BRepMeshesInspectionResult::meshes_intersections )
+            .def_readwrite( "lines_intersections",
+                &BRepMeshesInspectionResult::lines_intersections )
             .def_readwrite( "meshes_non_manifolds",
                 &BRepMeshesInspectionResult::meshes_non_manifolds )
             .def( "string", &BRepMeshesInspectionResult::string )
@@ -51,8 +53,11 @@ namespace geode
         pybind11::class_< BRepMeshesInspector, BRepUniqueVerticesColocation,
             BRepComponentMeshesAdjacency, BRepComponentMeshesColocation,
             BRepComponentMeshesDegeneration, BRepComponentMeshesManifold,
-            BRepMeshesIntersections >( module, "BRepMeshesInspector" )
+            BRepMeshesIntersections, BRepLinesIntersections >(
+            module, "BRepMeshesInspector" )
             .def( pybind11::init< const BRep& >() )
+            .def( "set_lines_intersections_inspection",
+                &BRepMeshesInspector::set_lines_intersections_inspection )
             .def( "inspect_brep_meshes",
                 &BRepMeshesInspector::inspect_brep_meshes );
     }
@@ -41,9 +41,21 @@ namespace geode
         pybind11::class_< EdgedCurveColocation >( module, name.c_str() )
             .def( pybind11::init< const EdgedCurve& >() )
             .def( "mesh_has_colocated_points",
-                &EdgedCurveColocation::mesh_has_colocated_points )
+                pybind11::overload_cast<>(
+                    &EdgedCurveColocation::mesh_has_colocated_points,
+                    pybind11::const_ ) )
             .def( "colocated_points_groups",
-                &EdgedCurveColocation::colocated_points_groups );
+                pybind11::overload_cast<>(
+                    &EdgedCurveColocation::colocated_points_groups,
+                    pybind11::const_ ) )
+            .def( "mesh_has_colocated_points",
+                pybind11::overload_cast< double >(
+                    &EdgedCurveColocation::mesh_has_colocated_points,
+                    pybind11::const_ ) )
+            .def( "colocated_points_groups",
+                pybind11::overload_cast< double >(
+                    &EdgedCurveColocation::colocated_points_groups,
+                    pybind11::const_ ) );
     }
     void define_edged_curve_colocation( pybind11::module& module )
     {
@@ -37,12 +37,41 @@ namespace geode
         pybind11::class_< PointSetColocation >( module, name.c_str() )
             .def( pybind11::init< const PointSet& >() )
             .def( "mesh_has_colocated_points",
-                &PointSetColocation::mesh_has_colocated_points )
+                pybind11::overload_cast<>(
+                    &PointSetColocation::mesh_has_colocated_points,
+                    pybind11::const_ ) )
             .def( "colocated_points_groups",
-                &PointSetColocation::colocated_points_groups );
+                pybind11::overload_cast<>(
+                    &PointSetColocation::colocated_points_groups,
+                    pybind11::const_ ) )
+            .def( "mesh_has_colocated_points",
+                pybind11::overload_cast< double >(
+                    &PointSetColocation::mesh_has_colocated_points,
+                    pybind11::const_ ) )
+            .def( "colocated_points_groups",
+                pybind11::overload_cast< double >(
+                    &PointSetColocation::colocated_points_groups,
+                    pybind11::const_ ) )
+            .def( "mesh_has_colocated_points",
+                pybind11::overload_cast< const OutOfCoreColocationParameters& >(
+                    &PointSetColocation::mesh_has_colocated_points,
+                    pybind11::const_ ) )
+            .def( "colocated_points_groups",
+                pybind11::overload_cast< const OutOfCoreColocationParameters& >(
+                    &PointSetColocation::colocated_points_groups,
+                    pybind11::const_ ) );
     }
     void define_point_set_colocation( pybind11::module& module )
     {
+        pybind11::class_< OutOfCoreColocationParameters >(
+            module, "OutOfCoreColocationParameters" )
+            .def( pybind11::init<>() )
+            .def_readwrite( "scratch_directory",
+                &OutOfCoreColocationParameters::scratch_directory )
+            .def_readwrite(
+                "chunk_size", &OutOfCoreColocationParameters::chunk_size )
+            .def_readwrite( "colocation_distance",
+                &OutOfCoreColocationParameters::colocation_distance );
         do_define_point_set_colocation< 2 >( module );
         do_define_point_set_colocation< 3 >( module );
     }
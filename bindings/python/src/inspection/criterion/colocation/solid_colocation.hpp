@@ -37,9 +37,21 @@ namespace geode
         pybind11::class_< SolidMeshColocation >( module, name.c_str() )
             .def( pybind11::init< const SolidMesh& >() )
             .def( "mesh_has_colocated_points",
-                &SolidMeshColocation::mesh_has_colocated_points )
+                pybind11::overload_cast<>(
+                    &SolidMeshColocation::mesh_has_colocated_points,
+                    pybind11::const_ ) )
             .def( "colocated_points_groups",
-                &SolidMeshColocation::colocated_points_groups );
+                pybind11::overload_cast<>(
+                    &SolidMeshColocation::colocated_points_groups,
+                    pybind11::const_ ) )
+            .def( "mesh_has_colocated_points",
+                pybind11::overload_cast< double >(
+                    &SolidMeshColocation::mesh_has_colocated_points,
+                    pybind11::const_ ) )
+            .def( "colocated_points_groups",
+                pybind11::overload_cast< double >(
+                    &SolidMeshColocation::colocated_points_groups,
+                    pybind11::const_ ) );
     }
     void define_solid_colocation( pybind11::module& module )
     {
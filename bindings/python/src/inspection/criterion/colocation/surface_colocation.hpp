@@ -38,9 +38,21 @@ namespace geode
         pybind11::class_< SurfaceMeshColocation >( module, name.c_str() )
             .def( pybind11::init< const SurfaceMesh& >() )
             .def( "mesh_has_colocated_points",
-                &SurfaceMeshColocation::mesh_has_colocated_points )
+                pybind11::overload_cast<>(
+                    &SurfaceMeshColocation::mesh_has_colocated_points,
+                    pybind11::const_ ) )
             .def( "colocated_points_groups",
-                &SurfaceMeshColocation::colocated_points_groups );
+                pybind11::overload_cast<>(
+                    &SurfaceMeshColocation::colocated_points_groups,
+                    pybind11::const_ ) )
+            .def( "mesh_has_colocated_points",
+                pybind11::overload_cast< double >(
+                    &SurfaceMeshColocation::mesh_has_colocated_points,
+                    pybind11::const_ ) )
+            .def( "colocated_points_groups",
+                pybind11::overload_cast< double >(
+                    &SurfaceMeshColocation::colocated_points_groups,
+                    pybind11::const_ ) );
     }
     void define_surface_colocation( pybind11::module& module )
     {
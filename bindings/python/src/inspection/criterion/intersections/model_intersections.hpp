@@ -35,7 +35,9 @@
         .def( "model_has_intersecting_surfaces",                               \
             &suffix##MeshesIntersections::model_has_intersecting_surfaces )    \
         .def( "inspect_intersections",                                         \
-            &suffix##MeshesIntersections::inspect_intersections )
+            &suffix##MeshesIntersections::inspect_intersections )              \
+        .def( "inspect_surfaces_near_misses",                                  \
+            &suffix##MeshesIntersections::inspect_surfaces_near_misses )
 
 namespace geode
 {
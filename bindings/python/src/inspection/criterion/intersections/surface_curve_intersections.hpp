@@ -45,6 +45,24 @@ namespace geode
                 &SurfaceCurveIntersections::meshes_have_intersections )
             .def( "intersecting_elements",
                 &SurfaceCurveIntersections::intersecting_elements );
+
+        using SurfaceCurvesIntersections =
+            SurfaceCurvesIntersections< dimension >;
+        const auto batch_name =
+            absl::StrCat( "SurfaceCurvesIntersections", dimension, "D" );
+        pybind11::class_< SurfaceCurvesIntersections >(
+            module, batch_name.c_str() )
+            .def( pybind11::init< const TriangulatedSurface& >() )
+            .def( "curves_have_intersections",
+                []( const SurfaceCurvesIntersections& inspector,
+                    const std::vector< const EdgedCurve* >& curves ) {
+                    return inspector.curves_have_intersections( curves );
+                } )
+            .def( "curves_intersecting_elements",
+                []( const SurfaceCurvesIntersections& inspector,
+                    const std::vector< const EdgedCurve* >& curves ) {
+                    return inspector.curves_intersecting_elements( curves );
+                } );
     }
     void define_surface_curve_intersections( pybind11::module& module )
     {
@@ -42,6 +42,8 @@ namespace geode
                 &SectionMeshesInspectionResult::meshes_degenerations )
             .def_readwrite( "meshes_intersections",
                 &SectionMeshesInspectionResult::meshes_intersections )
+            .def_readwrite( "lines_intersections",
+                &SectionMeshesInspectionResult::lines_intersections )
             .def_readwrite( "meshes_non_manifolds",
                 &SectionMeshesInspectionResult::meshes_non_manifolds )
             .def( "string", &SectionMeshesInspectionResult::string )
@@ -52,7 +54,8 @@ namespace geode
             SectionUniqueVerticesColocation, SectionComponentMeshesAdjacency,
             SectionComponentMeshesColocation,
             SectionComponentMeshesDegeneration, SectionComponentMeshesManifold,
-            SectionMeshesIntersections >( module, "SectionMeshesInspector" )
+            SectionMeshesIntersections, SectionLinesIntersections >(
+            module, "SectionMeshesInspector" )
             .def( pybind11::init< const Section& >() )
             .def( "inspect_section_meshes",
                 &SectionMeshesInspector::inspect_section_meshes );
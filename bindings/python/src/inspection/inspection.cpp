@@ -44,6 +44,7 @@
 #include "criterion/degeneration/surface_degeneration.hpp"
 
 #include "criterion/intersections/model_intersections.hpp"
+#include "criterion/intersections/model_lines_intersections.hpp"
 #include "criterion/intersections/surface_curve_intersections.hpp"
 #include "criterion/intersections/surface_intersections.hpp"
 
@@ -113,6 +114,7 @@ PYBIND11_MODULE( opengeode_inspector_py_inspection, module )
     geode::define_surface_intersections( module );
     geode::define_surface_curve_intersections( module );
     geode::define_model_intersections( module );
+    geode::define_model_lines_intersections( module );
     geode::define_surface_edge_manifold( module );
     geode::define_surface_vertex_manifold( module );
     geode::define_solid_edge_manifold( module );
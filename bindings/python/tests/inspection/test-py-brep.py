@@ -310,6 +310,44 @@ def check_model_D(verbose):
     inspect_model_D(model_brep, verbose)
 
 
+def add_triangle_surface(builder, points):
+    surface_id = builder.add_surface()
+    mesh_builder = builder.surface_mesh_builder(surface_id)
+    for point in points:
+        mesh_builder.create_point(opengeode.Point3D(point))
+    mesh_builder.create_polygon([0, 1, 2])
+    return surface_id
+
+
+def check_surfaces_near_misses():
+    model_brep = opengeode.BRep()
+    builder = opengeode.BRepBuilder(model_brep)
+    horizon_id = add_triangle_surface(builder, [[0, 0, 0], [10, 0, 0], [0, 10, 0]])
+    close_fault_id = add_triangle_surface(
+        builder, [[1, 1, 0.05], [2, 1, 0.05], [1, 1, 1]]
+    )
+    add_triangle_surface(builder, [[5, 1, 0.5], [6, 1, 0.5], [5, 1, 1.5]])
+    add_triangle_surface(builder, [[1, 4, -1], [2, 4, -1], [1, 4, 1]])
+    intersections = inspector.BRepMeshesIntersections(model_brep)
+    result = intersections.inspect_surfaces_near_misses(0.1)
+    if result.elements_intersections.nb_issues() != 1:
+        raise ValueError(
+            "[Test] Only the Surface stopping 0.05 short of the horizon should be a near miss."
+        )
+    near_miss = result.elements_intersections.issues()[0]
+    near_miss_surfaces = [
+        near_miss[0].component_id.id().string(),
+        near_miss[1].component_id.id().string(),
+    ]
+    if (
+        horizon_id.string() not in near_miss_surfaces
+        or close_fault_id.string() not in near_miss_surfaces
+    ):
+        raise ValueError(
+            "[Test] The near miss should be between the horizon and the Surface stopping short of it."
+        )
+
+
 if __name__ == "__main__":
     inspector.OpenGeodeInspectorInspectionLibrary.initialize()
     verbose = False
@@ -317,3 +355,4 @@ if __name__ == "__main__":
     check_a1_valid(verbose)
     check_model_mss(verbose)
     check_model_D(verbose)
+    check_surfaces_near_misses()
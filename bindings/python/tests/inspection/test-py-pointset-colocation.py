@@ -145,9 +145,40 @@ def check_colocation3D():
         )
 
 
+def check_colocation_distance2D():
+    pointset = geode.PointSet2D.create()
+    builder = geode.PointSetBuilder2D.create(pointset)
+    builder.create_vertices(5)
+    builder.set_point(0, geode.Point2D([0.0, 0.0]))
+    builder.set_point(1, geode.Point2D([5.0, 5.0]))
+    builder.set_point(2, geode.Point2D([0.5, 0.0]))
+    builder.set_point(3, geode.Point2D([1.0, 0.0]))
+    builder.set_point(4, geode.Point2D([-1.5, 0.0]))
+
+    colocation_inspector = inspector.PointSetColocation2D(pointset)
+    if colocation_inspector.mesh_has_colocated_points(0.4):
+        raise ValueError(
+            "[Test] PointSet has colocated points within 0.4 when it should have none."
+        )
+    if not colocation_inspector.mesh_has_colocated_points(0.6):
+        raise ValueError(
+            "[Test] PointSet doesn't have colocated points within 0.6 whereas it should have several."
+        )
+    issues = colocation_inspector.colocated_points_groups(0.6)
+    if not issues.nb_issues() == 1:
+        raise ValueError(
+            "[Test] PointSet has wrong number of colocated points groups within 0.6."
+        )
+    if not issues.issues()[0] == [0, 2, 3]:
+        raise ValueError(
+            "[Test] PointSet has wrong colocated points group within 0.6."
+        )
+
+
 if __name__ == "__main__":
     inspector.OpenGeodeInspectorInspectionLibrary.initialize()
     check_non_colocation2D()
     check_colocation2D()
     check_non_colocation3D()
     check_colocation3D()
+    check_colocation_distance2D()
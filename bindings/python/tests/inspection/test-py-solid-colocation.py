@@ -85,7 +85,38 @@ def check_colocation():
         raise ValueError("[Test] Solid has wrong second colocated points group.")
 
 
+def check_colocation_distance():
+    solid = geode.TetrahedralSolid3D.create()
+    builder = geode.TetrahedralSolidBuilder3D.create(solid)
+    builder.create_vertices(5)
+    builder.set_point(0, geode.Point3D([0.0, 0.0, 0.0]))
+    builder.set_point(1, geode.Point3D([5.0, 5.0, 0.0]))
+    builder.set_point(2, geode.Point3D([0.5, 0.0, 0.0]))
+    builder.set_point(3, geode.Point3D([1.0, 0.0, 0.0]))
+    builder.set_point(4, geode.Point3D([-1.5, 0.0, 0.0]))
+
+    colocation_inspector = inspector.SolidMeshColocation3D(solid)
+    if colocation_inspector.mesh_has_colocated_points(0.4):
+        raise ValueError(
+            "[Test] Solid has colocated points within 0.4 when it should have none."
+        )
+    if not colocation_inspector.mesh_has_colocated_points(0.6):
+        raise ValueError(
+            "[Test] Solid doesn't have colocated points within 0.6 whereas it should have several."
+        )
+    issues = colocation_inspector.colocated_points_groups(0.6)
+    if not issues.nb_issues() == 1:
+        raise ValueError(
+            "[Test] Solid has wrong number of colocated points groups within 0.6."
+        )
+    if not issues.issues()[0] == [0, 2, 3]:
+        raise ValueError(
+            "[Test] Solid has wrong colocated points group within 0.6."
+        )
+
+
 if __name__ == "__main__":
     inspector.OpenGeodeInspectorInspectionLibrary.initialize()
     check_non_colocation()
     check_colocation()
+    check_colocation_distance()
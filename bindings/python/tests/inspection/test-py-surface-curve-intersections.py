@@ -75,6 +75,15 @@ def check_intersections2D():
             "[Test] 2D Surface and Curve should have 7 intersecting elements pair."
         )
 
+    curves_inspector = inspector.SurfaceCurvesIntersections2D(surface)
+    if curves_inspector.curves_have_intersections([curve, curve]) != [True, True]:
+        raise ValueError("[Test] 2D Surface and Curves should have intersections.")
+    results = curves_inspector.curves_intersecting_elements([curve, curve])
+    if [result.nb_issues() for result in results] != [7, 7]:
+        raise ValueError(
+            "[Test] 2D Surface and Curves should have 7 intersecting elements pair."
+        )
+
 
 def check_intersections3D():
     surface = geode.TriangulatedSurface3D.create()
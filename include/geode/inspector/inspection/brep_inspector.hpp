@@ -61,5 +61,8 @@ namespace geode
         explicit BRepInspector( const BRep& brep );
 
         [[nodiscard]] BRepInspectionResult inspect_brep() const;
+
+    private:
+        const BRep& brep_;
     };
 } // namespace geode
\ No newline at end of file
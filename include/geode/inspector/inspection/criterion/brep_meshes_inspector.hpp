@@ -23,15 +23,27 @@
 
 #pragma once
 
+#include <optional>
+
 #include <geode/inspector/inspection/common.hpp>
 #include <geode/inspector/inspection/criterion/adjacency/brep_meshes_adjacency.hpp>
 #include <geode/inspector/inspection/criterion/colocation/component_meshes_colocation.hpp>
 #include <geode/inspector/inspection/criterion/colocation/unique_vertices_colocation.hpp>
 #include <geode/inspector/inspection/criterion/degeneration/brep_meshes_degeneration.hpp>
 #include <geode/inspector/inspection/criterion/intersections/model_intersections.hpp>
+#include <geode/inspector/inspection/criterion/intersections/model_lines_intersections.hpp>
 #include <geode/inspector/inspection/criterion/manifold/brep_meshes_manifold.hpp>
 #include <geode/inspector/inspection/criterion/negative_elements/brep_meshes_negative_elements.hpp>
 
+namespace geode
+{
+    class BRepInspector;
+    namespace internal
+    {
+        class ModelUniqueVertices;
+    } // namespace internal
+} // namespace geode
+
 namespace geode
 {
     struct opengeode_inspector_inspection_api BRepMeshesInspectionResult
@@ -41,6 +53,11 @@ namespace geode
         BRepMeshesAdjacencyInspectionResult meshes_adjacencies;
         BRepMeshesDegenerationInspectionResult meshes_degenerations;
         ElementsIntersectionsInspectionResult meshes_intersections;
+        /*!
+         * Only filled if the lines intersections inspection is activated.
+         */
+        std::optional< ElementsIntersectionsInspectionResult >
+            lines_intersections;
         BRepMeshesManifoldInspectionResult meshes_non_manifolds;
         BRepMeshesNegativeElementsInspectionResult meshes_negative_elements;
 
@@ -62,13 +79,33 @@ namespace geode
           public BRepComponentMeshesDegeneration,
           public BRepComponentMeshesManifold,
           public BRepComponentMeshesNegativeElements,
-          public BRepMeshesIntersections
+          public BRepMeshesIntersections,
+          public BRepLinesIntersections
     {
         OPENGEODE_DISABLE_COPY( BRepMeshesInspector );
+        friend class BRepInspector;
 
     public:
         explicit BRepMeshesInspector( const BRep& brep );
 
+        /*!
+         * Activates or deactivates the lines intersections inspection in
+         * inspect_brep_meshes, deactivated by default.
+         */
+        void set_lines_intersections_inspection( bool activate );
+
         [[nodiscard]] BRepMeshesInspectionResult inspect_brep_meshes() const;
+
+    private:
+        /*!
+         * Inspects the meshes using the unique vertices snapshot shared by
+         * the whole BRep inspection.
+         */
+        [[nodiscard]] BRepMeshesInspectionResult inspect_brep_meshes(
+            const internal::ModelUniqueVertices& unique_vertices ) const;
+
+    private:
+        const BRep& brep_;
+        bool lines_intersections_inspection_{ false };
     };
 } // namespace geode
\ No newline at end of file
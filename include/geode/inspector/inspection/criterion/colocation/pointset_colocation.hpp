@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <string>
+
 #include <geode/basic/pimpl.hpp>
 
 #include <geode/inspector/inspection/common.hpp>
@@ -35,6 +37,18 @@ namespace geode
 
 namespace geode
 {
+    /*!
+     * Parameters of the out-of-core colocation: points are streamed in
+     * chunks of chunk_size, each chunk is sorted in memory and spilled to
+     * scratch_directory (system temporary directory if empty).
+     */
+    struct OutOfCoreColocationParameters
+    {
+        std::string scratch_directory;
+        index_t chunk_size{ 50'000'000 };
+        double colocation_distance{ GLOBAL_EPSILON };
+    };
+
     /*!
      * Class for inspecting the colocation of points in a PointSet
      */
@@ -53,6 +67,31 @@ namespace geode
         [[nodiscard]] InspectionIssues< std::vector< index_t > >
             colocated_points_groups() const;
 
+        /*!
+         * Colocation inspection with a user-defined colocation distance,
+         * run on a parallel spatial hash grid. Groups gather points closer
+         * than the colocation distance, closed by transitivity.
+         */
+        [[nodiscard]] bool mesh_has_colocated_points(
+            double colocation_distance ) const;
+
+        [[nodiscard]] InspectionIssues< std::vector< index_t > >
+            colocated_points_groups( double colocation_distance ) const;
+
+        /*!
+         * Out-of-core colocation inspection for point sets whose search
+         * structure does not fit in memory. Besides the mesh, resident memory
+         * is bounded by one chunk of parameters.chunk_size points, a read
+         * buffer per chunk, a 4 bytes per point union-find and the points of
+         * the two largest slabs of cells along the first axis.
+         */
+        [[nodiscard]] bool mesh_has_colocated_points(
+            const OutOfCoreColocationParameters& parameters ) const;
+
+        [[nodiscard]] InspectionIssues< std::vector< index_t > >
+            colocated_points_groups(
+                const OutOfCoreColocationParameters& parameters ) const;
+
     private:
         IMPLEMENTATION_MEMBER( impl_ );
     };
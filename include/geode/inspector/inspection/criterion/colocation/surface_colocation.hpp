@@ -53,6 +53,17 @@ namespace geode
         [[nodiscard]] InspectionIssues< std::vector< index_t > >
             colocated_points_groups() const;
 
+        /*!
+         * Colocation inspection with a user-defined colocation distance,
+         * run on a parallel spatial hash grid. Groups gather points closer
+         * than the colocation distance, closed by transitivity.
+         */
+        [[nodiscard]] bool mesh_has_colocated_points(
+            double colocation_distance ) const;
+
+        [[nodiscard]] InspectionIssues< std::vector< index_t > >
+            colocated_points_groups( double colocation_distance ) const;
+
     private:
         IMPLEMENTATION_MEMBER( impl_ );
     };
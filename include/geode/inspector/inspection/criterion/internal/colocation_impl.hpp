@@ -32,6 +32,16 @@ namespace geode
 {
     namespace internal
     {
+        template < index_t dimension >
+        [[nodiscard]] bool points_have_colocation(
+            std::vector< Point< dimension > > points,
+            double colocation_distance );
+
+        template < index_t dimension >
+        [[nodiscard]] InspectionIssues< std::vector< index_t > >
+            colocated_points_groups( std::vector< Point< dimension > > points,
+                double colocation_distance );
+
         /*!
          * Implementation of the inspection of the colocation of a Mesh
          */
@@ -47,6 +57,12 @@ namespace geode
             [[nodiscard]] InspectionIssues< std::vector< index_t > >
                 colocated_points_groups() const;
 
+            [[nodiscard]] bool mesh_has_colocated_points(
+                double colocation_distance ) const;
+
+            [[nodiscard]] InspectionIssues< std::vector< index_t > >
+                colocated_points_groups( double colocation_distance ) const;
+
         private:
             const Mesh& mesh_;
         };
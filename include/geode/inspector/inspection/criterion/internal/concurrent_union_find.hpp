@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include <async++.h>
+
+#include <geode/inspector/inspection/common.hpp>
+
+namespace geode
+{
+    namespace internal
+    {
+        /*!
+         * Lock-free union-find: roots are always linked to the smaller root
+         * and paths are halved during find operations. Once all unions are
+         * done, the root of a set is its smallest element.
+         */
+        class ConcurrentUnionFind
+        {
+        public:
+            explicit ConcurrentUnionFind( index_t nb_elements )
+                : parents_( nb_elements )
+            {
+                async::parallel_for(
+                    async::irange( index_t{ 0 }, nb_elements ),
+                    [this]( index_t element ) {
+                        parents_[element].store(
+                            element, std::memory_order_relaxed );
+                    } );
+            }
+
+            [[nodiscard]] index_t find( index_t element )
+            {
+                while( true )
+                {
+                    auto parent =
+                        parents_[element].load( std::memory_order_relaxed );
+                    if( parent == element )
+                    {
+                        return element;
+                    }
+                    const auto grand_parent =
+                        parents_[parent].load( std::memory_order_relaxed );
+                    if( grand_parent != parent )
+                    {
+                        parents_[element].compare_exchange_weak(
+                            parent, grand_parent, std::memory_order_relaxed );
+                    }
+                    element = grand_parent;
+                }
+            }
+
+            void unite( index_t element0, index_t element1 )
+            {
+                while( true )
+                {
+                    auto root0 = find( element0 );
+                    auto root1 = find( element1 );
+                    if( root0 == root1 )
+                    {
+                        return;
+                    }
+                    if( root0 < root1 )
+                    {
+                        std::swap( root0, root1 );
+                    }
+                    auto expected = root0;
+                    if( parents_[root0].compare_exchange_strong(
+                            expected, root1, std::memory_order_relaxed ) )
+                    {
+                        return;
+                    }
+                }
+            }
+
+        private:
+            std::vector< std::atomic< index_t > > parents_;
+        };
+    } // namespace internal
+} // namespace geode
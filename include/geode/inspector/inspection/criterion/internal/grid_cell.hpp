@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+#include <geode/inspector/inspection/common.hpp>
+
+namespace geode
+{
+    namespace internal
+    {
+        /*!
+         * Bound of the grid cell coordinates, far enough from the integer
+         * limits to step to neighbor cells without overflow.
+         */
+        constexpr std::int64_t MAX_GRID_CELL_COORDINATE{
+            std::int64_t{ 1 } << 62
+        };
+
+        /*!
+         * Coordinate of the grid cell containing the value. It is clamped so
+         * that the conversion to integers is defined for tiny cell sizes or
+         * far away (or NaN) values. Clamped points may share a cell with far
+         * points, which only costs distance tests since close points stay in
+         * adjacent cells.
+         */
+        [[nodiscard]] inline std::int64_t grid_cell_coordinate(
+            double value, double cell_size )
+        {
+            const auto coordinate = std::floor( value / cell_size );
+            if( !( coordinate > -MAX_GRID_CELL_COORDINATE ) )
+            {
+                return -MAX_GRID_CELL_COORDINATE;
+            }
+            if( coordinate > MAX_GRID_CELL_COORDINATE )
+            {
+                return MAX_GRID_CELL_COORDINATE;
+            }
+            return static_cast< std::int64_t >( coordinate );
+        }
+    } // namespace internal
+} // namespace geode
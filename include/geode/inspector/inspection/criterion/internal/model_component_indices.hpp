@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#pragma once
+
+#include <array>
+#include <utility>
+#include <vector>
+
+#include <absl/container/flat_hash_map.h>
+
+#include <geode/basic/range.hpp>
+#include <geode/basic/uuid.hpp>
+
+#include <geode/model/mixin/core/component_type.hpp>
+
+#include <geode/inspector/inspection/common.hpp>
+
+namespace geode
+{
+    class BRep;
+    class Section;
+} // namespace geode
+
+namespace geode
+{
+    namespace internal
+    {
+        /*!
+         * Dense indices of the Corners, Lines, Surfaces and Blocks of a model,
+         * grouped by component kind in this order. Two instances built on the
+         * same model give the same index to each component, so that indices
+         * computed with one snapshot can be used with another.
+         * The indices must be rebuilt if the model is modified.
+         */
+        class opengeode_inspector_inspection_api ModelComponentIndices
+        {
+        public:
+            enum struct ComponentKind : local_index_t
+            {
+                corner,
+                line,
+                surface,
+                block
+            };
+
+            explicit ModelComponentIndices( const Section& section );
+
+            explicit ModelComponentIndices( const BRep& brep );
+
+            [[nodiscard]] index_t nb_components() const;
+
+            /*!
+             * Range of the dense indices of the components of the given kind.
+             */
+            [[nodiscard]] Range components( ComponentKind kind ) const;
+
+            /*!
+             * Dense index of the component, NO_ID if it is not a Corner, a
+             * Line, a Surface or a Block of the model.
+             */
+            [[nodiscard]] index_t component_index(
+                const uuid& component_id ) const;
+
+            [[nodiscard]] const ComponentID& component_id(
+                index_t component ) const;
+
+            [[nodiscard]] ComponentKind kind( index_t component ) const;
+
+            [[nodiscard]] bool is_active( index_t component ) const;
+
+        protected:
+            /*!
+             * First dense index of the given kind and first dense index after
+             * it.
+             */
+            [[nodiscard]] std::pair< index_t, index_t > kind_bounds(
+                ComponentKind kind ) const;
+
+        private:
+            template < typename Components >
+            void add_components(
+                const Components& components, ComponentKind kind );
+
+        private:
+            absl::flat_hash_map< uuid, index_t > indices_;
+            std::vector< ComponentID > ids_;
+            std::array< index_t, 5 > kind_offsets_{};
+            std::vector< bool > active_;
+        };
+    } // namespace internal
+} // namespace geode
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#pragma once
+
+#include <vector>
+
+#include <absl/types/span.h>
+
+#include <geode/inspector/inspection/common.hpp>
+#include <geode/inspector/inspection/criterion/internal/model_component_indices.hpp>
+
+namespace geode
+{
+    struct ComponentMeshVertex;
+} // namespace geode
+
+namespace geode
+{
+    namespace internal
+    {
+        /*!
+         * Snapshot of the unique vertex of every component mesh vertex of a
+         * model, built in parallel. The unique vertices of all the component
+         * meshes are stored in one array, those of a component being found
+         * through its dense index in a per-component offset table.
+         * The snapshot must be rebuilt if the model is modified.
+         */
+        class opengeode_inspector_inspection_api ModelUniqueVertices
+            : public ModelComponentIndices
+        {
+        public:
+            /*!
+             * Only the meshes of the given component kinds are stored, all of
+             * them if component_kinds is empty. Components of other kinds
+             * keep their dense index but have no stored vertex.
+             */
+            explicit ModelUniqueVertices( const Section& section,
+                absl::Span< const ComponentKind > component_kinds = {} );
+
+            explicit ModelUniqueVertices( const BRep& brep,
+                absl::Span< const ComponentKind > component_kinds = {} );
+
+            /*!
+             * Unique vertex of each vertex of the component mesh, empty if the
+             * component is NO_ID or its kind is not stored.
+             */
+            [[nodiscard]] absl::Span< const index_t > component_unique_vertices(
+                index_t component ) const;
+
+            /*!
+             * Unique vertex of the component mesh vertex, NO_ID if the vertex
+             * is not stored in the snapshot.
+             */
+            [[nodiscard]] index_t unique_vertex(
+                index_t component, index_t vertex ) const;
+
+            [[nodiscard]] index_t unique_vertex(
+                const ComponentMeshVertex& component_mesh_vertex ) const;
+
+        private:
+            template < typename Model >
+            void build( const Model& model,
+                absl::Span< const index_t > nb_vertices,
+                absl::Span< const ComponentKind > component_kinds );
+
+        private:
+            std::vector< index_t > offsets_;
+            std::vector< index_t > unique_vertices_;
+        };
+    } // namespace internal
+} // namespace geode
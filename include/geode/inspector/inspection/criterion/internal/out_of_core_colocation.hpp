@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <geode/inspector/inspection/common.hpp>
+#include <geode/inspector/inspection/information.hpp>
+
+namespace geode
+{
+    FORWARD_DECLARATION_DIMENSION_CLASS( PointSet );
+    struct OutOfCoreColocationParameters;
+} // namespace geode
+
+namespace geode
+{
+    namespace internal
+    {
+        /*!
+         * Out-of-core colocation: the mesh points are streamed in chunks,
+         * each chunk is sorted by its cell in a grid of cell size the
+         * colocation distance and spilled to a scratch file. Sorted runs are
+         * then merged and swept slab by slab along the first axis, a slab
+         * gathering the points of one cell coordinate along this axis. Close
+         * points are merged in a union-find indexed by vertex.
+         * Resident memory is one chunk of points while spilling, a read
+         * buffer per sorted run while merging, the union-find, and two
+         * consecutive slabs. Slabs are not split: points concentrated along
+         * the first axis, like a vertical well or a section normal to this
+         * axis, keep most of their points in a single slab.
+         */
+        template < index_t dimension >
+        [[nodiscard]] bool out_of_core_points_have_colocation(
+            const PointSet< dimension >& mesh,
+            const OutOfCoreColocationParameters& parameters );
+
+        template < index_t dimension >
+        [[nodiscard]] InspectionIssues< std::vector< index_t > >
+            out_of_core_colocated_points_groups(
+                const PointSet< dimension >& mesh,
+                const OutOfCoreColocationParameters& parameters );
+    } // namespace internal
+} // namespace geode
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include <async++.h>
+
+#include <geode/basic/range.hpp>
+
+#include <geode/inspector/inspection/common.hpp>
+
+namespace geode
+{
+    namespace internal
+    {
+        /*!
+         * Sort the given values using all available threads.
+         * Chunks are sorted independently then merged pairwise.
+         */
+        template < typename T, typename Compare >
+        void parallel_sort( std::vector< T >& values, const Compare& compare )
+        {
+            static constexpr index_t MIN_CHUNK_SIZE{ 1 << 14 };
+            const auto nb_values = static_cast< index_t >( values.size() );
+            const auto nb_threads =
+                static_cast< index_t >( async::hardware_concurrency() );
+            const auto nb_chunks =
+                std::min( nb_threads, nb_values / MIN_CHUNK_SIZE );
+            if( nb_chunks < 2 )
+            {
+                std::sort( values.begin(), values.end(), compare );
+                return;
+            }
+            std::vector< index_t > bounds( nb_chunks + 1 );
+            for( const auto chunk : Range{ nb_chunks + 1 } )
+            {
+                bounds[chunk] = static_cast< index_t >(
+                    static_cast< std::size_t >( nb_values ) * chunk
+                    / nb_chunks );
+            }
+            const auto begin = values.begin();
+            async::parallel_for( async::irange( index_t{ 0 }, nb_chunks ),
+                [&bounds, &begin, &compare]( index_t chunk ) {
+                    std::sort( begin + bounds[chunk], begin + bounds[chunk + 1],
+                        compare );
+                } );
+            while( bounds.size() > 2 )
+            {
+                const auto nb_merges =
+                    static_cast< index_t >( ( bounds.size() - 1 ) / 2 );
+                async::parallel_for( async::irange( index_t{ 0 }, nb_merges ),
+                    [&bounds, &begin, &compare]( index_t merge ) {
+                        std::inplace_merge( begin + bounds[2 * merge],
+                            begin + bounds[2 * merge + 1],
+                            begin + bounds[2 * merge + 2], compare );
+                    } );
+                std::vector< index_t > merged_bounds;
+                merged_bounds.reserve( bounds.size() / 2 + 1 );
+                for( index_t bound = 0; bound < bounds.size(); bound += 2 )
+                {
+                    merged_bounds.push_back( bounds[bound] );
+                }
+                if( merged_bounds.back() != nb_values )
+                {
+                    merged_bounds.push_back( nb_values );
+                }
+                bounds = std::move( merged_bounds );
+            }
+        }
+
+        template < typename T >
+        void parallel_sort( std::vector< T >& values )
+        {
+            parallel_sort( values, std::less< T >{} );
+        }
+    } // namespace internal
+} // namespace geode
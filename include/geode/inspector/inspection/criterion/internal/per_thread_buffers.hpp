@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <absl/algorithm/container.h>
+#include <absl/container/flat_hash_map.h>
+
+#include <geode/inspector/inspection/common.hpp>
+
+namespace geode
+{
+    namespace internal
+    {
+        /*!
+         * Values gathered concurrently in one buffer per thread. The mutex is
+         * only taken the first time a thread writes in the buffers, the
+         * following writes go through a thread-local cache without any
+         * synchronization.
+         */
+        template < typename T >
+        class PerThreadBuffers
+        {
+        public:
+            PerThreadBuffers() : id_( new_id() ) {}
+
+            template < typename... Args >
+            void emplace_back( Args&&... args )
+            {
+                local_buffer().emplace_back( std::forward< Args >( args )... );
+            }
+
+            /*!
+             * Concatenates all the buffers and sorts the result so that the
+             * order does not depend on thread scheduling.
+             * Should only be called once all the writing threads are done.
+             */
+            [[nodiscard]] std::vector< T > sorted_values()
+            {
+                std::vector< T > values;
+                std::size_t nb_values{ 0 };
+                for( const auto& buffer : buffers_ )
+                {
+                    nb_values += buffer.second->size();
+                }
+                values.reserve( nb_values );
+                for( auto& buffer : buffers_ )
+                {
+                    absl::c_move(
+                        *buffer.second, std::back_inserter( values ) );
+                    buffer.second->clear();
+                }
+                absl::c_sort( values );
+                return values;
+            }
+
+        private:
+            [[nodiscard]] static std::uint64_t new_id()
+            {
+                static std::atomic< std::uint64_t > counter{ 0 };
+                return ++counter;
+            }
+
+            [[nodiscard]] std::vector< T >& local_buffer()
+            {
+                /* Cache keyed by a never reused id rather than the object
+                 * address, which may be reused by a later instance. */
+                thread_local std::pair< std::uint64_t, std::vector< T >* >
+                    cache{ 0, nullptr };
+                if( cache.first == id_ )
+                {
+                    return *cache.second;
+                }
+                std::lock_guard< std::mutex > lock( mutex_ );
+                auto& buffer = buffers_[std::this_thread::get_id()];
+                if( !buffer )
+                {
+                    buffer = std::make_unique< std::vector< T > >();
+                }
+                cache = { id_, buffer.get() };
+                return *buffer;
+            }
+
+        private:
+            const std::uint64_t id_;
+            std::mutex mutex_;
+            absl::flat_hash_map< std::thread::id,
+                std::unique_ptr< std::vector< T > >,
+                std::hash< std::thread::id > >
+                buffers_;
+        };
+    } // namespace internal
+} // namespace geode
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <absl/types/span.h>
+
+#include <geode/geometry/nn_search.hpp>
+
+#include <geode/inspector/inspection/common.hpp>
+
+namespace geode
+{
+    namespace internal
+    {
+        /*!
+         * Colocation engine bucketing points in a hashed uniform grid whose
+         * cell size is the colocation distance: each point is only compared
+         * with points of its neighboring cells. Grid build and queries run in
+         * parallel.
+         * Points closer than the colocation distance are gathered in the same
+         * group, groups being closed by transitivity. Unique points are
+         * numbered in the order of their smallest point index.
+         */
+        template < index_t dimension >
+        [[nodiscard]] typename NNSearch< dimension >::ColocatedInfo
+            spatial_hash_colocated_index_mapping(
+                absl::Span< const Point< dimension > > points,
+                double colocation_distance );
+
+        template < index_t dimension >
+        [[nodiscard]] bool spatial_hash_has_colocated_points(
+            absl::Span< const Point< dimension > > points,
+            double colocation_distance );
+    } // namespace internal
+} // namespace geode
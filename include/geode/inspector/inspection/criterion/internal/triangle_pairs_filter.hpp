@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <absl/types/span.h>
+
+#include <geode/inspector/inspection/common.hpp>
+
+namespace geode
+{
+    FORWARD_DECLARATION_DIMENSION_CLASS( Point );
+} // namespace geode
+
+namespace geode
+{
+    namespace internal
+    {
+        template < index_t dimension >
+        using TrianglePoints = std::array< const Point< dimension >*, 3 >;
+
+        /*!
+         * Local indices of a vertex shared by two triangles, in the first and
+         * in the second triangle.
+         */
+        using SharedTriangleVertex = std::array< local_index_t, 2 >;
+
+        /*!
+         * Floating-point filter run before the exact triangle-triangle
+         * intersection predicates. A pair is reported as separated only when
+         * orientation signs whose magnitude exceeds their rounding error bound
+         * certify that the triangles only meet at their shared vertices:
+         * - without shared vertex, by a separating plane (3D) or edge line
+         * (2D),
+         * - in 3D, by the other triangle vertices lying strictly on one side
+         * of a triangle plane,
+         * - in 2D with a shared edge, by the third vertices lying strictly on
+         * opposite sides of this edge.
+         * Shared vertices must have the same position in both triangles to be
+         * filtered. A separated pair does not intersect, other pairs must go
+         * through the exact predicates.
+         */
+        template < index_t dimension >
+        [[nodiscard]] bool triangles_are_separated(
+            const TrianglePoints< dimension >& triangle1,
+            const TrianglePoints< dimension >& triangle2,
+            absl::Span< const SharedTriangleVertex > shared_vertices );
+
+        /*!
+         * Batched version of triangles_are_separated: triangle pairs are
+         * stored as structure of arrays and filter() computes each
+         * orientation determinant of the tests in one loop over all the pairs,
+         * before combining the signs of each pair.
+         */
+        template < index_t dimension >
+        class TrianglePairsFilter
+        {
+        public:
+            void clear();
+
+            /*!
+             * Adds a triangle pair to the batch and returns its index.
+             * @param[in] shared_vertices Vertices shared by the triangles.
+             */
+            index_t add_triangle_pair(
+                const TrianglePoints< dimension >& triangle1,
+                const TrianglePoints< dimension >& triangle2,
+                absl::Span< const SharedTriangleVertex > shared_vertices );
+
+            [[nodiscard]] index_t nb_triangle_pairs() const;
+
+            void filter();
+
+            [[nodiscard]] bool are_separated( index_t triangle_pair ) const;
+
+        private:
+            /*!
+             * Coordinates of the six points of each pair, triangle1 points
+             * first: coordinates_[point * dimension + axis][triangle_pair].
+             */
+            std::array< std::vector< double >, 6 * dimension > coordinates_;
+            /*!
+             * Whether each point takes part in the separation tests, shared
+             * vertices being discarded.
+             */
+            std::array< std::vector< std::uint8_t >, 6 > considered_points_;
+            /*!
+             * Certified signs of the orientation determinants, stored
+             * orientation by orientation for all the pairs.
+             */
+            std::vector< std::int8_t > orientation_signs_;
+            std::vector< std::uint8_t > separated_;
+        };
+        ALIAS_2D_AND_3D( TrianglePairsFilter );
+    } // namespace internal
+} // namespace geode
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <geode/inspector/inspection/common.hpp>
+
+namespace geode
+{
+    FORWARD_DECLARATION_DIMENSION_CLASS( SurfaceMesh );
+    FORWARD_DECLARATION_DIMENSION_CLASS( SolidMesh );
+} // namespace geode
+
+namespace geode
+{
+    namespace internal
+    {
+        /*!
+         * Return the sorted indices of the vertices whose star is made of
+         * more than one connected component. Elements around a vertex are
+         * connected when they are adjacent through an edge (for surfaces) or
+         * a facet (for solids) containing this vertex.
+         * Components are labelled in a single parallel pass using a
+         * concurrent union-find over mesh element corners.
+         */
+        template < index_t dimension >
+        [[nodiscard]] std::vector< index_t > vertices_with_disconnected_star(
+            const SurfaceMesh< dimension >& mesh );
+
+        template < index_t dimension >
+        [[nodiscard]] std::vector< index_t > vertices_with_disconnected_star(
+            const SolidMesh< dimension >& mesh );
+    } // namespace internal
+} // namespace geode
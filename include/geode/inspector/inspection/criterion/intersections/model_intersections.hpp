@@ -34,6 +34,12 @@ namespace geode
 {
     class Section;
     class BRep;
+    class SectionMeshesInspector;
+    class BRepMeshesInspector;
+    namespace internal
+    {
+        class ModelUniqueVertices;
+    } // namespace internal
 } // namespace geode
 
 namespace geode
@@ -59,6 +65,8 @@ namespace geode
     class ModelMeshesIntersections
     {
         OPENGEODE_DISABLE_COPY( ModelMeshesIntersections );
+        friend class SectionMeshesInspector;
+        friend class BRepMeshesInspector;
 
     public:
         explicit ModelMeshesIntersections( const Model& model );
@@ -73,6 +81,25 @@ namespace geode
         [[nodiscard]] ElementsIntersectionsInspectionResult
             inspect_surfaces_self_intersections() const;
 
+        /*!
+         * Returns the pairs of polygons from different surfaces that are
+         * closer than the given tolerance without sharing any unique vertex,
+         * e.g. a surface stopping just short of another one.
+         * Intersecting polygons are not reported, they are found by
+         * inspect_intersections. Only triangles are inspected.
+         */
+        [[nodiscard]] ElementsIntersectionsInspectionResult
+            inspect_surfaces_near_misses( double tolerance ) const;
+
+    private:
+        /*!
+         * Inspects the intersections using the unique vertices snapshot
+         * shared by the whole model inspection.
+         */
+        [[nodiscard]] ElementsIntersectionsInspectionResult
+            inspect_intersections(
+                const internal::ModelUniqueVertices& unique_vertices ) const;
+
     private:
         IMPLEMENTATION_MEMBER( impl_ );
     };
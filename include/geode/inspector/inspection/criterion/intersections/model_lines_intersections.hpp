@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <geode/basic/pimpl.hpp>
+
+#include <geode/inspector/inspection/common.hpp>
+#include <geode/inspector/inspection/criterion/intersections/model_intersections.hpp>
+
+namespace geode
+{
+    class Section;
+    class BRep;
+    class SectionMeshesInspector;
+    class BRepMeshesInspector;
+    namespace internal
+    {
+        class ModelUniqueVertices;
+    } // namespace internal
+} // namespace geode
+
+namespace geode
+{
+    /*!
+     * Class for inspecting the intersections between the edges of a Model
+     * lines, both between different lines and within a single line.
+     * Edges sharing a unique vertex are only reported if they overlap.
+     * In 2D, the candidate edge pairs come from a sweep along the x axis
+     * over the edges bounding boxes, the active edges being kept in an
+     * interval tree on the y axis: O( ( n + b ) log( n ) ) for n edges and
+     * b pairs of intersecting boxes. Candidates are then tested with exact
+     * predicates.
+     * In 3D, candidates come from the lines AABB trees, and edges closer
+     * than GLOBAL_EPSILON are considered as intersecting.
+     */
+    template < typename Model >
+    class ModelLinesIntersections
+    {
+        OPENGEODE_DISABLE_COPY( ModelLinesIntersections );
+        friend class SectionMeshesInspector;
+        friend class BRepMeshesInspector;
+
+    public:
+        explicit ModelLinesIntersections( const Model& model );
+
+        ~ModelLinesIntersections();
+
+        [[nodiscard]] bool model_has_intersecting_lines() const;
+
+        [[nodiscard]] ElementsIntersectionsInspectionResult
+            inspect_lines_intersections() const;
+
+    private:
+        /*!
+         * Inspects the lines intersections using the unique vertices snapshot
+         * shared by the whole model inspection.
+         */
+        [[nodiscard]] ElementsIntersectionsInspectionResult
+            inspect_lines_intersections(
+                const internal::ModelUniqueVertices& unique_vertices ) const;
+
+    private:
+        IMPLEMENTATION_MEMBER( impl_ );
+    };
+
+    using SectionLinesIntersections = ModelLinesIntersections< Section >;
+    using BRepLinesIntersections = ModelLinesIntersections< BRep >;
+} // namespace geode
@@ -67,4 +67,41 @@ namespace geode
         IMPLEMENTATION_MEMBER( impl_ );
     };
     ALIAS_2D_AND_3D( SurfaceCurveIntersections );
+
+    /*!
+     * Class for inspecting the intersections of one TriangulatedSurface with
+     * many EdgedCurves. The surface AABB tree is built once at construction
+     * and shared by all the curves, which are inspected in parallel.
+     */
+    template < index_t dimension >
+    class SurfaceCurvesIntersections
+    {
+        OPENGEODE_DISABLE_COPY( SurfaceCurvesIntersections );
+
+    public:
+        explicit SurfaceCurvesIntersections(
+            const TriangulatedSurface< dimension >& surface );
+
+        ~SurfaceCurvesIntersections();
+
+        /* Returns, for each given curve, whether it intersects the surface.
+         * The inspection of a curve stops at its first intersection.
+         */
+        [[nodiscard]] std::vector< bool > curves_have_intersections(
+            absl::Span< const EdgedCurve< dimension >* const > curves ) const;
+
+        /* Returns, for each given curve, all pairs of intersecting triangles
+         * and edges, with the same convention as
+         * SurfaceCurveIntersections::intersecting_elements.
+         */
+        [[nodiscard]] std::vector<
+            InspectionIssues< std::pair< index_t, index_t > > >
+            curves_intersecting_elements(
+                absl::Span< const EdgedCurve< dimension >* const > curves )
+                const;
+
+    private:
+        IMPLEMENTATION_MEMBER( impl_ );
+    };
+    ALIAS_2D_AND_3D( SurfaceCurvesIntersections );
 } // namespace geode
\ No newline at end of file
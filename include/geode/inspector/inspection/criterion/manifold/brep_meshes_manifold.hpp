@@ -39,6 +39,11 @@
 namespace geode
 {
     class BRep;
+    class BRepMeshesInspector;
+    namespace internal
+    {
+        class ModelUniqueVertices;
+    } // namespace internal
 } // namespace geode
 
 namespace geode
@@ -88,6 +93,7 @@ namespace geode
     class opengeode_inspector_inspection_api BRepComponentMeshesManifold
     {
         OPENGEODE_DISABLE_COPY( BRepComponentMeshesManifold );
+        friend class BRepMeshesInspector;
 
     public:
         explicit BRepComponentMeshesManifold( const BRep& brep );
@@ -97,6 +103,14 @@ namespace geode
         [[nodiscard]] BRepMeshesManifoldInspectionResult
             inspect_brep_manifold() const;
 
+    private:
+        /*!
+         * Inspects the manifold property using the unique vertices snapshot
+         * shared by the whole BRep inspection.
+         */
+        [[nodiscard]] BRepMeshesManifoldInspectionResult inspect_brep_manifold(
+            const internal::ModelUniqueVertices& unique_vertices ) const;
+
     private:
         IMPLEMENTATION_MEMBER( impl_ );
     };
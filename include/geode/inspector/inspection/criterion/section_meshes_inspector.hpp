@@ -29,10 +29,20 @@
 #include <geode/inspector/inspection/criterion/colocation/unique_vertices_colocation.hpp>
 #include <geode/inspector/inspection/criterion/degeneration/section_meshes_degeneration.hpp>
 #include <geode/inspector/inspection/criterion/intersections/model_intersections.hpp>
+#include <geode/inspector/inspection/criterion/intersections/model_lines_intersections.hpp>
 #include <geode/inspector/inspection/criterion/manifold/section_meshes_manifold.hpp>
 #include <geode/inspector/inspection/criterion/negative_elements/section_meshes_negative_elements.hpp>
 #include <geode/inspector/inspection/information.hpp>
 
+namespace geode
+{
+    class SectionInspector;
+    namespace internal
+    {
+        class ModelUniqueVertices;
+    } // namespace internal
+} // namespace geode
+
 namespace geode
 {
     struct opengeode_inspector_inspection_api SectionMeshesInspectionResult
@@ -42,6 +52,7 @@ namespace geode
         SectionMeshesAdjacencyInspectionResult meshes_adjacencies;
         SectionMeshesDegenerationInspectionResult meshes_degenerations;
         ElementsIntersectionsInspectionResult meshes_intersections;
+        ElementsIntersectionsInspectionResult lines_intersections;
         SectionMeshesManifoldInspectionResult meshes_non_manifolds;
         SectionMeshesNegativeElementsInspectionResult meshes_negative_elements;
 
@@ -62,14 +73,27 @@ namespace geode
           public SectionComponentMeshesDegeneration,
           public SectionComponentMeshesManifold,
           public SectionComponentMeshesNegativeElements,
-          public SectionMeshesIntersections
+          public SectionMeshesIntersections,
+          public SectionLinesIntersections
     {
         OPENGEODE_DISABLE_COPY( SectionMeshesInspector );
+        friend class SectionInspector;
 
     public:
         explicit SectionMeshesInspector( const Section& section );
 
         [[nodiscard]] SectionMeshesInspectionResult
             inspect_section_meshes() const;
+
+    private:
+        /*!
+         * Inspects the meshes using the unique vertices snapshot shared by
+         * the whole Section inspection.
+         */
+        [[nodiscard]] SectionMeshesInspectionResult inspect_section_meshes(
+            const internal::ModelUniqueVertices& unique_vertices ) const;
+
+    private:
+        const Section& section_;
     };
 } // namespace geode
\ No newline at end of file
@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <iterator>
 #include <string>
 #include <vector>
 
@@ -63,6 +64,22 @@ namespace geode
             messages_.emplace_back( std::move( message ) );
         }
 
+        /*!
+         * Moves the issues of other after these issues, the description
+         * of other is dropped.
+         */
+        void append_issues( InspectionIssues< IssueType >&& other )
+        {
+            issues_.insert( issues_.end(),
+                std::make_move_iterator( other.issues_.begin() ),
+                std::make_move_iterator( other.issues_.end() ) );
+            messages_.insert( messages_.end(),
+                std::make_move_iterator( other.messages_.begin() ),
+                std::make_move_iterator( other.messages_.end() ) );
+            other.issues_.clear();
+            other.messages_.clear();
+        }
+
         [[nodiscard]] std::string_view description() const
         {
             return description_;
@@ -56,5 +56,8 @@ namespace geode
         explicit SectionInspector( const Section& section );
 
         [[nodiscard]] SectionInspectionResult inspect_section() const;
+
+    private:
+        const Section& section_;
     };
 } // namespace geode
\ No newline at end of file
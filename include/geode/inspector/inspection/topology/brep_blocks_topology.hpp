@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <utility>
@@ -39,6 +41,14 @@ namespace geode
     ALIAS_3D( Block );
     struct ComponentMeshVertex;
     class BRep;
+    class BRepTopologyInspector;
+    namespace internal
+    {
+        class ModelRelationships;
+        class ModelUniqueVertices;
+        struct BRepBlocksTopologyContext;
+        struct VertexCMVsByComponent;
+    } // namespace internal
 } // namespace geode
 
 namespace geode
@@ -95,13 +105,20 @@ namespace geode
 
     /*!
      * Class for inspecting the topology of a BRep model blocks through
-     * their unique vertices
+     * their unique vertices.
+     * The checks on a single unique vertex share a snapshot of the BRep
+     * relationships built on first use, the BRep must not be modified
+     * while the inspector is in use.
      */
     class opengeode_inspector_inspection_api BRepBlocksTopology
     {
+        friend class BRepTopologyInspector;
+
     public:
         explicit BRepBlocksTopology( const BRep& brep );
 
+        ~BRepBlocksTopology();
+
         [[nodiscard]] bool brep_blocks_topology_is_valid(
             index_t unique_vertex_index ) const;
 
@@ -135,7 +152,82 @@ namespace geode
 
         [[nodiscard]] BRepBlocksTopologyInspectionResult inspect_blocks() const;
 
+    private:
+        [[nodiscard]] const internal::ModelRelationships&
+            relationships_snapshot() const;
+
+        /*!
+         * Inspects the Blocks themselves, without the checks done on each
+         * unique vertex by add_unique_vertex_blocks_issues.
+         */
+        [[nodiscard]] BRepBlocksTopologyInspectionResult
+            inspect_blocks_components(
+                const internal::ModelUniqueVertices& unique_vertices,
+                const internal::ModelRelationships& relationships ) const;
+
+        [[nodiscard]] internal::BRepBlocksTopologyContext
+            blocks_topology_context(
+                const internal::ModelRelationships& relationships ) const;
+
+        /*!
+         * Adds to the result the Blocks issues of the unique vertex, whose
+         * component mesh vertices are already sorted by component type.
+         */
+        void add_unique_vertex_blocks_issues( index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::VertexCMVsByComponent& unique_vertex_cmvs,
+            const internal::BRepBlocksTopologyContext& context,
+            BRepBlocksTopologyInspectionResult& result ) const;
+
+        [[nodiscard]] bool brep_blocks_topology_is_valid(
+            index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::VertexCMVsByComponent& unique_vertex_cmvs ) const;
+
+        [[nodiscard]] std::optional< std::string >
+            unique_vertex_is_part_of_two_blocks_and_no_boundary_surface(
+                index_t unique_vertex_index,
+                const internal::ModelRelationships& relationships,
+                const internal::VertexCMVsByComponent& unique_vertex_cmvs )
+                const;
+
+        [[nodiscard]] std::optional< std::string >
+            unique_vertex_block_cmvs_count_is_incorrect(
+                index_t unique_vertex_index,
+                const internal::ModelRelationships& relationships,
+                const internal::VertexCMVsByComponent& unique_vertex_cmvs )
+                const;
+
+        [[nodiscard]] std::optional< std::string >
+            vertex_is_part_of_surface_with_wrong_relationships_to_block(
+                index_t unique_vertex_index,
+                const internal::ModelRelationships& relationships,
+                const internal::VertexCMVsByComponent& unique_vertex_cmvs,
+                const internal::BRepBlocksTopologyContext& context ) const;
+
+        [[nodiscard]] std::optional< std::string >
+            vertex_is_part_of_invalid_single_surface(
+                index_t unique_vertex_index,
+                const internal::ModelRelationships& relationships,
+                const internal::VertexCMVsByComponent& unique_vertex_cmvs,
+                const internal::BRepBlocksTopologyContext& context ) const;
+
+        [[nodiscard]] std::optional< std::string >
+            vertex_is_part_of_invalid_multiple_surfaces(
+                index_t unique_vertex_index,
+                const internal::ModelRelationships& relationships,
+                const internal::VertexCMVsByComponent& unique_vertex_cmvs )
+                const;
+
+        [[nodiscard]] internal::BRepBlocksTopologyContext
+            make_blocks_topology_context(
+                const internal::ModelRelationships& relationships,
+                absl::Span< const uuid > not_boundary_surfaces,
+                absl::Span< const uuid > dangling_surfaces ) const;
+
     private:
         const BRep& brep_;
+        mutable std::once_flag relationships_flag_;
+        mutable std::unique_ptr< internal::ModelRelationships > relationships_;
     };
 } // namespace geode
\ No newline at end of file
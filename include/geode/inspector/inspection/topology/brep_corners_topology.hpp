@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 
@@ -36,6 +38,13 @@ namespace geode
     FORWARD_DECLARATION_DIMENSION_CLASS( Corner );
     ALIAS_3D( Corner );
     class BRep;
+    class BRepTopologyInspector;
+    namespace internal
+    {
+        class ModelRelationships;
+        class ModelUniqueVertices;
+        struct VertexCMVsByComponent;
+    } // namespace internal
 } // namespace geode
 
 namespace geode
@@ -75,11 +84,22 @@ namespace geode
         [[nodiscard]] std::string inspection_type() const;
     };
 
+    /*!
+     * Class for inspecting the topology of a BRep model corners through
+     * their unique vertices.
+     * The checks on a single unique vertex share a snapshot of the BRep
+     * relationships built on first use, the BRep must not be modified
+     * while the inspector is in use.
+     */
     class opengeode_inspector_inspection_api BRepCornersTopology
     {
+        friend class BRepTopologyInspector;
+
     public:
         explicit BRepCornersTopology( const BRep& brep );
 
+        ~BRepCornersTopology();
+
         /*!
          * Checks if the brep unique vertices are valid corners, i.e.
          * corners that verify:
@@ -114,7 +134,59 @@ namespace geode
         [[nodiscard]] BRepCornersTopologyInspectionResult
             inspect_corners_topology() const;
 
+    private:
+        [[nodiscard]] const internal::ModelRelationships&
+            relationships_snapshot() const;
+
+        /*!
+         * Inspects the Corners themselves, without the checks done on each
+         * unique vertex by add_unique_vertex_corners_issues.
+         */
+        [[nodiscard]] BRepCornersTopologyInspectionResult
+            inspect_corners_components(
+                const internal::ModelUniqueVertices& unique_vertices ) const;
+
+        /*!
+         * Adds to the result the Corners issues of the unique vertex, whose
+         * component mesh vertices are already sorted by component type.
+         */
+        void add_unique_vertex_corners_issues( index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::VertexCMVsByComponent& unique_vertex_cmvs,
+            BRepCornersTopologyInspectionResult& result ) const;
+
+        [[nodiscard]] bool brep_corner_topology_is_valid(
+            index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::VertexCMVsByComponent& unique_vertex_cmvs ) const;
+
+        [[nodiscard]] std::optional< std::string >
+            unique_vertex_has_multiple_corners( index_t unique_vertex_index,
+                const internal::ModelRelationships& relationships,
+                const internal::VertexCMVsByComponent& unique_vertex_cmvs )
+                const;
+
+        [[nodiscard]] std::optional< std::string > corner_is_multiply_embedded(
+            index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::VertexCMVsByComponent& unique_vertex_cmvs ) const;
+
+        [[nodiscard]] std::optional< std::string >
+            corner_is_not_internal_nor_boundary( index_t unique_vertex_index,
+                const internal::ModelRelationships& relationships,
+                const internal::VertexCMVsByComponent& unique_vertex_cmvs )
+                const;
+
+        [[nodiscard]] std::optional< std::string >
+            corner_is_part_of_line_but_not_boundary(
+                index_t unique_vertex_index,
+                const internal::ModelRelationships& relationships,
+                const internal::VertexCMVsByComponent& unique_vertex_cmvs )
+                const;
+
     private:
         const BRep& brep_;
+        mutable std::once_flag relationships_flag_;
+        mutable std::unique_ptr< internal::ModelRelationships > relationships_;
     };
 } // namespace geode
@@ -22,6 +22,8 @@
  */
 
 #pragma once
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 
@@ -36,6 +38,13 @@ namespace geode
     ALIAS_3D( Line );
     struct ComponentMeshVertex;
     class BRep;
+    class BRepTopologyInspector;
+    namespace internal
+    {
+        class ModelRelationships;
+        class ModelUniqueVertices;
+        struct VertexCMVsByComponent;
+    } // namespace internal
 } // namespace geode
 
 namespace geode
@@ -79,13 +88,20 @@ namespace geode
     };
     /*!
      * Class for inspecting the topology of a BRep model lines through their
-     * unique vertices
+     * unique vertices.
+     * The checks on a single unique vertex share a snapshot of the BRep
+     * relationships built on first use, the BRep must not be modified
+     * while the inspector is in use.
      */
     class opengeode_inspector_inspection_api BRepLinesTopology
     {
+        friend class BRepTopologyInspector;
+
     public:
         explicit BRepLinesTopology( const BRep& brep );
 
+        ~BRepLinesTopology();
+
         /*!
          * Checks if the brep unique vertices are parts of valid lines, i.e.
          * verify:
@@ -127,7 +143,70 @@ namespace geode
         [[nodiscard]] BRepLinesTopologyInspectionResult
             inspect_lines_topology() const;
 
+    private:
+        [[nodiscard]] const internal::ModelRelationships&
+            relationships_snapshot() const;
+
+        /*!
+         * Inspects the Lines themselves, without the checks done on each
+         * unique vertex by add_unique_vertex_lines_issues.
+         */
+        [[nodiscard]] BRepLinesTopologyInspectionResult
+            inspect_lines_components(
+                const internal::ModelUniqueVertices& unique_vertices,
+                const internal::ModelRelationships& relationships ) const;
+
+        /*!
+         * Adds to the result the Lines issues of the unique vertex, whose
+         * component mesh vertices are already sorted by component type.
+         */
+        void add_unique_vertex_lines_issues( index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::VertexCMVsByComponent& unique_vertex_cmvs,
+            BRepLinesTopologyInspectionResult& result ) const;
+
+        [[nodiscard]] bool brep_lines_topology_is_valid(
+            index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::VertexCMVsByComponent& unique_vertex_cmvs ) const;
+
+        [[nodiscard]] std::optional< std::string >
+            vertex_is_part_of_line_with_wrong_relationships_to_surface(
+                index_t unique_vertex_index,
+                const internal::ModelRelationships& relationships,
+                const internal::VertexCMVsByComponent& unique_vertex_cmvs )
+                const;
+
+        [[nodiscard]] std::optional< std::string >
+            vertex_is_part_of_invalid_embedded_line(
+                index_t unique_vertex_index,
+                const internal::ModelRelationships& relationships,
+                const internal::VertexCMVsByComponent& unique_vertex_cmvs )
+                const;
+
+        [[nodiscard]] std::optional< std::string >
+            vertex_is_part_of_invalid_single_line(
+                index_t unique_vertex_index,
+                const internal::ModelRelationships& relationships,
+                const internal::VertexCMVsByComponent& unique_vertex_cmvs )
+                const;
+
+        [[nodiscard]] std::optional< std::string >
+            vertex_has_lines_but_is_not_a_corner(
+                index_t unique_vertex_index,
+                const internal::ModelRelationships& relationships,
+                const internal::VertexCMVsByComponent& unique_vertex_cmvs )
+                const;
+
+        [[nodiscard]] std::optional< std::string >
+            line_edge_has_wrong_component_edges_around(
+                const internal::ModelRelationships& relationships,
+                const Line3D& line,
+                const index_t edge_index ) const;
+
     private:
         const BRep& brep_;
+        mutable std::once_flag relationships_flag_;
+        mutable std::unique_ptr< internal::ModelRelationships > relationships_;
     };
 } // namespace geode
\ No newline at end of file
@@ -22,6 +22,8 @@
  */
 
 #pragma once
+#include <memory>
+#include <mutex>
 #include <optional>
 
 #include <geode/inspector/inspection/common.hpp>
@@ -34,6 +36,13 @@ namespace geode
     FORWARD_DECLARATION_DIMENSION_CLASS( Surface );
     ALIAS_3D( Surface );
     class BRep;
+    class BRepTopologyInspector;
+    namespace internal
+    {
+        class ModelRelationships;
+        class ModelUniqueVertices;
+        struct VertexCMVsByComponent;
+    } // namespace internal
 } // namespace geode
 
 namespace geode
@@ -73,13 +82,20 @@ namespace geode
     };
     /*!
      * Class for inspecting the topology of a BRep model surfaces through
-     * their unique vertices
+     * their unique vertices.
+     * The checks on a single unique vertex share a snapshot of the BRep
+     * relationships built on first use, the BRep must not be modified
+     * while the inspector is in use.
      */
     class opengeode_inspector_inspection_api BRepSurfacesTopology
     {
+        friend class BRepTopologyInspector;
+
     public:
         explicit BRepSurfacesTopology( const BRep& brep );
 
+        ~BRepSurfacesTopology();
+
         /*!
          * Checks if the brep unique vertices are parts of valid surfaces,
          * i.e. verify:
@@ -123,7 +139,63 @@ namespace geode
         [[nodiscard]] BRepSurfacesTopologyInspectionResult
             inspect_surfaces_topology() const;
 
+    private:
+        [[nodiscard]] const internal::ModelRelationships&
+            relationships_snapshot() const;
+
+        /*!
+         * Inspects the Surfaces themselves, without the checks done on each
+         * unique vertex by add_unique_vertex_surfaces_issues.
+         */
+        [[nodiscard]] BRepSurfacesTopologyInspectionResult
+            inspect_surfaces_components(
+                const internal::ModelUniqueVertices& unique_vertices,
+                const internal::ModelRelationships& relationships ) const;
+
+        /*!
+         * Adds to the result the Surfaces issues of the unique vertex, whose
+         * component mesh vertices are already sorted by component type.
+         */
+        void add_unique_vertex_surfaces_issues( index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::VertexCMVsByComponent& unique_vertex_cmvs,
+            BRepSurfacesTopologyInspectionResult& result ) const;
+
+        [[nodiscard]] bool brep_surfaces_topology_is_valid(
+            index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::VertexCMVsByComponent& unique_vertex_cmvs ) const;
+
+        [[nodiscard]] std::optional< std::string >
+            vertex_is_part_of_invalid_embedded_surface(
+                index_t unique_vertex_index,
+                const internal::ModelRelationships& relationships,
+                const internal::VertexCMVsByComponent& unique_vertex_cmvs )
+                const;
+
+        [[nodiscard]] std::optional< std::string >
+            vertex_is_part_of_invalid_multiple_surfaces(
+                index_t unique_vertex_index,
+                const internal::ModelRelationships& relationships,
+                const internal::VertexCMVsByComponent& unique_vertex_cmvs )
+                const;
+
+        [[nodiscard]] std::optional< std::string >
+            vertex_is_part_of_line_and_not_on_surface_border(
+                index_t unique_vertex_index,
+                const internal::ModelRelationships& relationships,
+                const internal::VertexCMVsByComponent& unique_vertex_cmvs )
+                const;
+
+        [[nodiscard]] std::optional< std::string >
+            surface_facet_has_wrong_component_facets_around(
+                const internal::ModelRelationships& relationships,
+                const Surface3D& surface,
+                const index_t facet_index ) const;
+
     private:
         const BRep& brep_;
+        mutable std::once_flag relationships_flag_;
+        mutable std::unique_ptr< internal::ModelRelationships > relationships_;
     };
 } // namespace geode
\ No newline at end of file
@@ -35,6 +35,11 @@
 namespace geode
 {
     class BRep;
+    class BRepInspector;
+    namespace internal
+    {
+        class ModelUniqueVertices;
+    } // namespace internal
 } // namespace geode
 
 namespace geode
@@ -74,6 +79,7 @@ namespace geode
           public BRepBlocksTopology
     {
         OPENGEODE_DISABLE_COPY( BRepTopologyInspector );
+        friend class BRepInspector;
 
     public:
         explicit BRepTopologyInspector( const BRep& brep );
@@ -93,6 +99,14 @@ namespace geode
         [[nodiscard]] BRepTopologyInspectionResult
             inspect_brep_topology() const;
 
+    private:
+        /*!
+         * Inspects the topology using the unique vertices snapshot shared by
+         * the whole BRep inspection.
+         */
+        [[nodiscard]] BRepTopologyInspectionResult inspect_brep_topology(
+            const internal::ModelUniqueVertices& unique_vertices ) const;
+
     private:
         IMPLEMENTATION_MEMBER( impl_ );
     };
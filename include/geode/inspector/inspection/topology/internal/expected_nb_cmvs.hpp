@@ -32,6 +32,11 @@
 namespace geode
 {
     class BRep;
+    namespace internal
+    {
+        class ModelComponentIndices;
+        class ModelRelationships;
+    } // namespace internal
 } // namespace geode
 
 namespace geode
@@ -44,20 +49,36 @@ namespace geode
             std::vector< ComponentMeshVertex > surface_cmvs;
             std::vector< ComponentMeshVertex > line_cmvs;
             std::vector< ComponentMeshVertex > corner_cmvs;
+            /*!
+             * Dense indices of the components of the CMVs above, in the same
+             * order.
+             */
+            std::vector< index_t > blocks;
+            std::vector< index_t > surfaces;
+            std::vector< index_t > lines;
+            std::vector< index_t > corners;
         };
 
-        VertexCMVsByComponent vertex_cmvs_by_component(
-            const BRep& brep, index_t unique_vertex_id );
+        /*!
+         * Sorts the CMVs of the unique vertex by component kind, mapping each
+         * component to its dense index once. CMVs of components unknown to
+         * the snapshot are left out.
+         */
+        VertexCMVsByComponent vertex_cmvs_by_component( const BRep& brep,
+            const ModelComponentIndices& components,
+            index_t unique_vertex_id );
 
         index_t nb_expected_block_cmvs( const BRep& brep,
+            const ModelRelationships& relationships,
             index_t unique_vertex_id,
-            const geode::uuid& block_uuid,
+            index_t block,
             const VertexCMVsByComponent& unique_vertex_cmvs );
 
         std::optional< std::string > wrong_nb_expected_block_cmvs(
             const BRep& brep,
+            const ModelRelationships& relationships,
             index_t unique_vertex_id,
-            const geode::uuid& block_uuid,
+            index_t block,
             const VertexCMVsByComponent& unique_vertex_cmvs );
     } // namespace internal
 } // namespace geode
\ No newline at end of file
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include <absl/types/span.h>
+
+#include <geode/inspector/inspection/common.hpp>
+#include <geode/inspector/inspection/criterion/internal/model_component_indices.hpp>
+
+namespace geode
+{
+    class BRep;
+    class Relationships;
+    class Section;
+} // namespace geode
+
+namespace geode
+{
+    namespace internal
+    {
+        /*!
+         * Snapshot of the relationships between the Corners, Lines, Surfaces
+         * and Blocks of a model, built once for the topology inspections.
+         * Relations are queried through the components dense indices, each
+         * relation type being stored as a compressed adjacency whose rows are
+         * sorted by dense index. Meshed states are stored as bitsets.
+         * Queries on NO_ID, e.g. the index of a component unknown to the
+         * model, behave as for a component without relations.
+         * The snapshot must be rebuilt if the model is modified.
+         */
+        class opengeode_inspector_inspection_api ModelRelationships
+            : public ModelComponentIndices
+        {
+        public:
+            explicit ModelRelationships( const Section& section );
+
+            explicit ModelRelationships( const BRep& brep );
+
+            /*!
+             * Returns true if the mesh of the component has elements of its
+             * own dimension (vertices for Corners, edges for Lines, polygons
+             * for Surfaces and polyhedra for Blocks).
+             */
+            [[nodiscard]] bool is_meshed( index_t component ) const;
+
+            /*!
+             * Returns true if every component of the given kind is meshed.
+             */
+            [[nodiscard]] bool are_meshed( ComponentKind kind ) const;
+
+            [[nodiscard]] absl::Span< const index_t > boundaries(
+                index_t component ) const;
+
+            [[nodiscard]] absl::Span< const index_t > incidences(
+                index_t component ) const;
+
+            [[nodiscard]] absl::Span< const index_t > internals(
+                index_t component ) const;
+
+            [[nodiscard]] absl::Span< const index_t > embeddings(
+                index_t component ) const;
+
+            /*!
+             * Embeddings of the component restricted to the given kind.
+             */
+            [[nodiscard]] absl::Span< const index_t > embeddings(
+                index_t component, ComponentKind kind ) const;
+
+            /*!
+             * Returns true if boundary is a boundary of incidence.
+             */
+            [[nodiscard]] bool is_boundary(
+                index_t boundary, index_t incidence ) const;
+
+            /*!
+             * Returns true if internal is an internal of embedding.
+             */
+            [[nodiscard]] bool is_internal(
+                index_t internal, index_t embedding ) const;
+
+        private:
+            struct Adjacency
+            {
+                [[nodiscard]] absl::Span< const index_t > row(
+                    index_t component ) const;
+
+                [[nodiscard]] bool contains(
+                    index_t component, index_t other ) const;
+
+                std::vector< index_t > offsets;
+                std::vector< index_t > values;
+            };
+
+            template < typename Components >
+            void add_meshed_states(
+                const Components& components, ComponentKind kind );
+
+            void build_relations( const Relationships& relationships );
+
+            [[nodiscard]] absl::Span< const index_t > restrict_to_kind(
+                absl::Span< const index_t > components,
+                ComponentKind kind ) const;
+
+        private:
+            std::vector< bool > meshed_;
+            std::array< bool, 4 > kind_meshed_{ true, true, true, true };
+            Adjacency boundaries_;
+            Adjacency incidences_;
+            Adjacency internals_;
+            Adjacency embeddings_;
+        };
+    } // namespace internal
+} // namespace geode
@@ -29,6 +29,7 @@
 #include <geode/model/mixin/core/component_type.hpp>
 
 #include <geode/inspector/inspection/common.hpp>
+#include <geode/inspector/inspection/criterion/internal/model_unique_vertices.hpp>
 #include <geode/inspector/inspection/information.hpp>
 
 namespace geode
@@ -86,19 +87,18 @@ namespace geode
             return true;
         }
 
-        template < typename Model, typename Mesh >
-        [[nodiscard]] InspectionIssues< index_t >
+        [[nodiscard]] inline InspectionIssues< index_t >
             model_component_vertices_not_associated_to_unique_vertices(
-                const Model& model,
-                const ComponentID& component_id,
-                const Mesh& component_mesh )
+                const ModelUniqueVertices& unique_vertices,
+                const uuid& component_id )
         {
             InspectionIssues< index_t > result;
-            for( const auto vertex_id : Range{ component_mesh.nb_vertices() } )
+            const auto component_unique_vertices =
+                unique_vertices.component_unique_vertices(
+                    unique_vertices.component_index( component_id ) );
+            for( const auto vertex_id : Indices{ component_unique_vertices } )
             {
-                ComponentMeshVertex component_mesh_vertex{ component_id,
-                    vertex_id };
-                if( model.unique_vertex( component_mesh_vertex ) == NO_ID )
+                if( component_unique_vertices[vertex_id] == NO_ID )
                 {
                     result.add_issue(
                         vertex_id, absl::StrCat( "vertex '", vertex_id,
@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include <absl/types/span.h>
+
+#include <async++.h>
+
+#include <geode/basic/range.hpp>
+
+#include <geode/model/mixin/core/vertex_identifier.hpp>
+
+#include <geode/inspector/inspection/common.hpp>
+#include <geode/inspector/inspection/information.hpp>
+#include <geode/inspector/inspection/topology/internal/expected_nb_cmvs.hpp>
+
+namespace geode
+{
+    class Section;
+    struct BRepCornersTopologyInspectionResult;
+    struct BRepLinesTopologyInspectionResult;
+    struct BRepSurfacesTopologyInspectionResult;
+    struct BRepBlocksTopologyInspectionResult;
+    struct SectionCornersTopologyInspectionResult;
+    struct SectionLinesTopologyInspectionResult;
+    struct SectionSurfacesTopologyInspectionResult;
+} // namespace geode
+
+namespace geode
+{
+    namespace internal
+    {
+        class ModelComponentIndices;
+        class ModelUniqueVertices;
+
+        struct SectionVertexCMVsByComponent
+        {
+            std::vector< ComponentMeshVertex > surface_cmvs;
+            std::vector< ComponentMeshVertex > line_cmvs;
+            std::vector< ComponentMeshVertex > corner_cmvs;
+            /*!
+             * Dense indices of the components of the CMVs above, in the same
+             * order.
+             */
+            std::vector< index_t > surfaces;
+            std::vector< index_t > lines;
+            std::vector< index_t > corners;
+        };
+
+        [[nodiscard]] SectionVertexCMVsByComponent vertex_cmvs_by_component(
+            const Section& section,
+            const ModelComponentIndices& components,
+            index_t unique_vertex_id );
+
+        /*!
+         * Surfaces classification used by the unique vertices checks of the
+         * Blocks, computed once per inspection.
+         */
+        struct BRepBlocksTopologyContext
+        {
+            /*!
+             * Flags indexed by the components dense indices of the
+             * relationships snapshot.
+             */
+            std::vector< bool > is_not_boundary_surface;
+            std::vector< bool > is_dangling_surface;
+        };
+
+        /*!
+         * Unique vertices wrongly linked to their component mesh vertices,
+         * gathered before being moved into the model topology result.
+         */
+        struct UniqueVerticesCMVLinkIssues
+        {
+            InspectionIssues< index_t > not_linked_to_any_component;
+            InspectionIssues< index_t > linked_to_inexistant_cmv;
+            InspectionIssues< index_t > nonbijectively_linked_to_cmv;
+        };
+
+        /*!
+         * Sorted and unique dense indices of the given CMVs components.
+         */
+        [[nodiscard]] std::vector< index_t > unique_components(
+            absl::Span< const index_t > components );
+
+        /*!
+         * Checks if the component mesh vertex exists in the model, the dense
+         * index of its component in the snapshot being already known (NO_ID
+         * if the component is not in the model).
+         */
+        [[nodiscard]] bool component_mesh_vertex_exists(
+            const ModelUniqueVertices& unique_vertices,
+            index_t component,
+            const ComponentMeshVertex& component_mesh_vertex );
+
+        [[nodiscard]] bool vertex_is_linked_to_component(
+            const VertexCMVsByComponent& unique_vertex_cmvs,
+            index_t component );
+
+        [[nodiscard]] bool vertex_is_linked_to_component(
+            const SectionVertexCMVsByComponent& unique_vertex_cmvs,
+            index_t component );
+
+        /*!
+         * Moves the unique vertices issues of chunk_result after the ones
+         * of result. Issues stored by component are left untouched.
+         */
+        void append_unique_vertices_issues(
+            BRepCornersTopologyInspectionResult& result,
+            BRepCornersTopologyInspectionResult&& chunk_result );
+
+        void append_unique_vertices_issues(
+            BRepLinesTopologyInspectionResult& result,
+            BRepLinesTopologyInspectionResult&& chunk_result );
+
+        void append_unique_vertices_issues(
+            BRepSurfacesTopologyInspectionResult& result,
+            BRepSurfacesTopologyInspectionResult&& chunk_result );
+
+        void append_unique_vertices_issues(
+            BRepBlocksTopologyInspectionResult& result,
+            BRepBlocksTopologyInspectionResult&& chunk_result );
+
+        void append_unique_vertices_issues(
+            SectionCornersTopologyInspectionResult& result,
+            SectionCornersTopologyInspectionResult&& chunk_result );
+
+        void append_unique_vertices_issues(
+            SectionLinesTopologyInspectionResult& result,
+            SectionLinesTopologyInspectionResult&& chunk_result );
+
+        void append_unique_vertices_issues(
+            SectionSurfacesTopologyInspectionResult& result,
+            SectionSurfacesTopologyInspectionResult&& chunk_result );
+
+        void append_unique_vertices_issues( UniqueVerticesCMVLinkIssues& result,
+            UniqueVerticesCMVLinkIssues&& chunk_result );
+
+        /*!
+         * Calls action( unique_vertex_id, chunk_result ) on every unique
+         * vertex. Consecutive unique vertices are grouped in chunks
+         * processed in parallel, each one filling its own default
+         * constructed Result. Chunk results are then given in chunk order to
+         * merge( result, std::move( chunk_result ) ), so that issues are
+         * reported by increasing unique vertex whatever the scheduling.
+         */
+        template < typename Result, typename Action, typename Merge >
+        void for_each_unique_vertex_chunk( index_t nb_unique_vertices,
+            Result& result,
+            const Action& action,
+            const Merge& merge )
+        {
+            static constexpr index_t CHUNK_SIZE{ 4'096 };
+            const auto nb_chunks =
+                ( nb_unique_vertices + CHUNK_SIZE - 1 ) / CHUNK_SIZE;
+            if( nb_chunks < 2 )
+            {
+                for( const auto unique_vertex_id : Range{ nb_unique_vertices } )
+                {
+                    action( unique_vertex_id, result );
+                }
+                return;
+            }
+            std::vector< Result > chunk_results( nb_chunks );
+            async::parallel_for( async::irange( index_t{ 0 }, nb_chunks ),
+                [&chunk_results, &action, nb_unique_vertices](
+                    index_t chunk_id ) {
+                    const auto begin = chunk_id * CHUNK_SIZE;
+                    const auto end =
+                        std::min( begin + CHUNK_SIZE, nb_unique_vertices );
+                    for( const auto unique_vertex_id : Range{ begin, end } )
+                    {
+                        action( unique_vertex_id, chunk_results[chunk_id] );
+                    }
+                } );
+            for( auto& chunk_result : chunk_results )
+            {
+                merge( result, std::move( chunk_result ) );
+            }
+        }
+
+        /*!
+         * Same as above, chunk results being merged with
+         * append_unique_vertices_issues.
+         */
+        template < typename Result, typename Action >
+        void for_each_unique_vertex_chunk(
+            index_t nb_unique_vertices, Result& result, const Action& action )
+        {
+            for_each_unique_vertex_chunk( nb_unique_vertices, result, action,
+                []( Result& merged_result, Result&& chunk_result ) {
+                    append_unique_vertices_issues(
+                        merged_result, std::move( chunk_result ) );
+                } );
+        }
+    } // namespace internal
+} // namespace geode
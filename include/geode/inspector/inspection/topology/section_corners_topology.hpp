@@ -22,6 +22,8 @@
  */
 
 #pragma once
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 
@@ -35,6 +37,13 @@ namespace geode
     FORWARD_DECLARATION_DIMENSION_CLASS( Corner );
     ALIAS_2D( Corner );
     class Section;
+    class SectionTopologyInspector;
+    namespace internal
+    {
+        class ModelRelationships;
+        class ModelUniqueVertices;
+        struct SectionVertexCMVsByComponent;
+    } // namespace internal
 } // namespace geode
 
 namespace geode
@@ -74,11 +83,22 @@ namespace geode
         [[nodiscard]] std::string inspection_type() const;
     };
 
+    /*!
+     * Class for inspecting the topology of a Section model corners through
+     * their unique vertices.
+     * The checks on a single unique vertex share a snapshot of the Section
+     * relationships built on first use, the Section must not be modified
+     * while the inspector is in use.
+     */
     class opengeode_inspector_inspection_api SectionCornersTopology
     {
+        friend class SectionTopologyInspector;
+
     public:
         explicit SectionCornersTopology( const Section& section );
 
+        ~SectionCornersTopology();
+
         /*!
          * Checks if the section unique vertices are valid corners, i.e.
          * corners that verify:
@@ -113,7 +133,61 @@ namespace geode
         [[nodiscard]] SectionCornersTopologyInspectionResult
             inspect_corners_topology() const;
 
+    private:
+        [[nodiscard]] const internal::ModelRelationships&
+            relationships_snapshot() const;
+
+        /*!
+         * Inspects the Corners themselves, without the checks done on each
+         * unique vertex by add_unique_vertex_corners_issues.
+         */
+        [[nodiscard]] SectionCornersTopologyInspectionResult
+            inspect_corners_components(
+                const internal::ModelUniqueVertices& unique_vertices ) const;
+
+        /*!
+         * Adds to the result the Corners issues of the unique vertex, whose
+         * component mesh vertices are already sorted by component type.
+         */
+        void add_unique_vertex_corners_issues( index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::SectionVertexCMVsByComponent& unique_vertex_cmvs,
+            SectionCornersTopologyInspectionResult& result ) const;
+
+        [[nodiscard]] bool section_corner_topology_is_valid(
+            index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::SectionVertexCMVsByComponent& unique_vertex_cmvs )
+            const;
+
+        [[nodiscard]] std::optional< std::string >
+            unique_vertex_has_multiple_corners( index_t unique_vertex_index,
+                const internal::ModelRelationships& relationships,
+                const internal::SectionVertexCMVsByComponent&
+                    unique_vertex_cmvs ) const;
+
+        [[nodiscard]] std::optional< std::string >
+            corner_has_multiple_embeddings( index_t unique_vertex_index,
+                const internal::ModelRelationships& relationships,
+                const internal::SectionVertexCMVsByComponent&
+                    unique_vertex_cmvs ) const;
+
+        [[nodiscard]] std::optional< std::string >
+            corner_is_not_internal_nor_boundary( index_t unique_vertex_index,
+                const internal::ModelRelationships& relationships,
+                const internal::SectionVertexCMVsByComponent&
+                    unique_vertex_cmvs ) const;
+
+        [[nodiscard]] std::optional< std::string >
+            corner_is_part_of_line_but_not_boundary(
+                index_t unique_vertex_index,
+                const internal::ModelRelationships& relationships,
+                const internal::SectionVertexCMVsByComponent&
+                    unique_vertex_cmvs ) const;
+
     private:
         const Section& section_;
+        mutable std::once_flag relationships_flag_;
+        mutable std::unique_ptr< internal::ModelRelationships > relationships_;
     };
 } // namespace geode
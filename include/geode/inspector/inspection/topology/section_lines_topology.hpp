@@ -21,6 +21,8 @@
  *
  */
 #pragma once
+#include <memory>
+#include <mutex>
 #include <optional>
 
 #include <geode/basic/uuid.hpp>
@@ -33,6 +35,13 @@ namespace geode
     FORWARD_DECLARATION_DIMENSION_CLASS( Line );
     ALIAS_2D( Line );
     class Section;
+    class SectionTopologyInspector;
+    namespace internal
+    {
+        class ModelRelationships;
+        class ModelUniqueVertices;
+        struct SectionVertexCMVsByComponent;
+    } // namespace internal
 } // namespace geode
 
 namespace geode
@@ -73,13 +82,20 @@ namespace geode
     };
     /*!
      * Class for inspecting the topology of a Section model lines through
-     * their unique vertices
+     * their unique vertices.
+     * The checks on a single unique vertex share a snapshot of the Section
+     * relationships built on first use, the Section must not be modified
+     * while the inspector is in use.
      */
     class opengeode_inspector_inspection_api SectionLinesTopology
     {
+        friend class SectionTopologyInspector;
+
     public:
         explicit SectionLinesTopology( const Section& section );
 
+        ~SectionLinesTopology();
+
         /*!
          * Checks if the section unique vertices are parts of valid lines,
          * i.e. verify:
@@ -119,7 +135,64 @@ namespace geode
         [[nodiscard]] SectionLinesTopologyInspectionResult
             inspect_lines_topology() const;
 
+    private:
+        [[nodiscard]] const internal::ModelRelationships&
+            relationships_snapshot() const;
+
+        /*!
+         * Inspects the Lines themselves, without the checks done on each
+         * unique vertex by add_unique_vertex_lines_issues.
+         */
+        [[nodiscard]] SectionLinesTopologyInspectionResult
+            inspect_lines_components(
+                const internal::ModelUniqueVertices& unique_vertices ) const;
+
+        /*!
+         * Adds to the result the Lines issues of the unique vertex, whose
+         * component mesh vertices are already sorted by component type.
+         */
+        void add_unique_vertex_lines_issues( index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::SectionVertexCMVsByComponent& unique_vertex_cmvs,
+            SectionLinesTopologyInspectionResult& result ) const;
+
+        [[nodiscard]] bool section_lines_topology_is_valid(
+            index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::SectionVertexCMVsByComponent& unique_vertex_cmvs )
+            const;
+
+        [[nodiscard]] std::optional< std::string >
+            vertex_is_part_of_line_with_wrong_relationships_to_surface(
+                index_t unique_vertex_index,
+                const internal::ModelRelationships& relationships,
+                const internal::SectionVertexCMVsByComponent&
+                    unique_vertex_cmvs ) const;
+
+        [[nodiscard]] std::optional< std::string >
+            vertex_is_part_of_invalid_embedded_line(
+                index_t unique_vertex_index,
+                const internal::ModelRelationships& relationships,
+                const internal::SectionVertexCMVsByComponent&
+                    unique_vertex_cmvs ) const;
+
+        [[nodiscard]] std::optional< std::string >
+            vertex_is_part_of_invalid_single_line(
+                index_t unique_vertex_index,
+                const internal::ModelRelationships& relationships,
+                const internal::SectionVertexCMVsByComponent&
+                    unique_vertex_cmvs ) const;
+
+        [[nodiscard]] std::optional< std::string >
+            vertex_has_lines_but_is_not_a_corner(
+                index_t unique_vertex_index,
+                const internal::ModelRelationships& relationships,
+                const internal::SectionVertexCMVsByComponent&
+                    unique_vertex_cmvs ) const;
+
     private:
         const Section& section_;
+        mutable std::once_flag relationships_flag_;
+        mutable std::unique_ptr< internal::ModelRelationships > relationships_;
     };
 } // namespace geode
\ No newline at end of file
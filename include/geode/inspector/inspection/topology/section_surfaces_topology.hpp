@@ -22,6 +22,8 @@
  */
 
 #pragma once
+#include <memory>
+#include <mutex>
 #include <optional>
 
 #include <geode/basic/uuid.hpp>
@@ -34,6 +36,13 @@ namespace geode
     FORWARD_DECLARATION_DIMENSION_CLASS( Surface );
     ALIAS_2D( Surface );
     class Section;
+    class SectionTopologyInspector;
+    namespace internal
+    {
+        class ModelRelationships;
+        class ModelUniqueVertices;
+        struct SectionVertexCMVsByComponent;
+    } // namespace internal
 } // namespace geode
 
 namespace geode
@@ -65,13 +74,20 @@ namespace geode
     };
     /*!
      * Class for inspecting the topology of a Section model surfaces through
-     * its unique vertices
+     * its unique vertices.
+     * The checks on a single unique vertex share a snapshot of the Section
+     * relationships built on first use, the Section must not be modified
+     * while the inspector is in use.
      */
     class opengeode_inspector_inspection_api SectionSurfacesTopology
     {
+        friend class SectionTopologyInspector;
+
     public:
         explicit SectionSurfacesTopology( const Section& section );
 
+        ~SectionSurfacesTopology();
+
         /*!
          * Checks if the section unique vertices are parts of valid
          * surfaces, i.e. verify:
@@ -97,7 +113,50 @@ namespace geode
         [[nodiscard]] SectionSurfacesTopologyInspectionResult
             inspect_surfaces() const;
 
+    private:
+        [[nodiscard]] const internal::ModelRelationships&
+            relationships_snapshot() const;
+
+        /*!
+         * Inspects the Surfaces themselves, without the checks done on each
+         * unique vertex by add_unique_vertex_surfaces_issues.
+         */
+        [[nodiscard]] SectionSurfacesTopologyInspectionResult
+            inspect_surfaces_components(
+                const internal::ModelUniqueVertices& unique_vertices ) const;
+
+        /*!
+         * Adds to the result the Surfaces issues of the unique vertex, whose
+         * component mesh vertices are already sorted by component type.
+         */
+        void add_unique_vertex_surfaces_issues( index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::SectionVertexCMVsByComponent& unique_vertex_cmvs,
+            SectionSurfacesTopologyInspectionResult& result ) const;
+
+        [[nodiscard]] bool section_vertex_surfaces_topology_is_valid(
+            index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::SectionVertexCMVsByComponent& unique_vertex_cmvs )
+            const;
+
+        [[nodiscard]] std::optional< std::string >
+            vertex_is_part_of_invalid_embedded_surface(
+                index_t unique_vertex_index,
+                const internal::ModelRelationships& relationships,
+                const internal::SectionVertexCMVsByComponent&
+                    unique_vertex_cmvs ) const;
+
+        [[nodiscard]] std::optional< std::string >
+            vertex_is_part_of_line_and_not_on_surface_border(
+                index_t unique_vertex_index,
+                const internal::ModelRelationships& relationships,
+                const internal::SectionVertexCMVsByComponent&
+                    unique_vertex_cmvs ) const;
+
     private:
         const Section& section_;
+        mutable std::once_flag relationships_flag_;
+        mutable std::unique_ptr< internal::ModelRelationships > relationships_;
     };
 } // namespace geode
\ No newline at end of file
@@ -34,6 +34,11 @@
 namespace geode
 {
     class Section;
+    class SectionInspector;
+    namespace internal
+    {
+        class ModelUniqueVertices;
+    } // namespace internal
 } // namespace geode
 
 namespace geode
@@ -71,6 +76,7 @@ namespace geode
           public SectionSurfacesTopology
     {
         OPENGEODE_DISABLE_COPY( SectionTopologyInspector );
+        friend class SectionInspector;
 
     public:
         explicit SectionTopologyInspector( const Section& section );
@@ -89,6 +95,14 @@ namespace geode
         [[nodiscard]] SectionTopologyInspectionResult
             inspect_section_topology() const;
 
+    private:
+        /*!
+         * Inspects the topology using the unique vertices snapshot shared by
+         * the whole Section inspection.
+         */
+        [[nodiscard]] SectionTopologyInspectionResult inspect_section_topology(
+            const internal::ModelUniqueVertices& unique_vertices ) const;
+
     private:
         IMPLEMENTATION_MEMBER( impl_ );
     };
@@ -30,6 +30,7 @@
 #include <geode/basic/assert.hpp>
 #include <geode/basic/filename.hpp>
 #include <geode/basic/logger.hpp>
+#include <geode/basic/range.hpp>
 
 #include <geode/mesh/core/edged_curve.hpp>
 #include <geode/mesh/core/mesh_factory.hpp>
@@ -51,17 +52,32 @@ ABSL_FLAG( std::string,
     surface,
     "/path/my/surface.og_tsf3d",
     "Input triangulated surface" );
-ABSL_FLAG( std::string, curve, "/path/my/curve.og_edc3d", "Input curve" );
+ABSL_FLAG( std::vector< std::string >,
+    curve,
+    { "/path/my/curve.og_edc3d" },
+    "Input curves, separated by commas" );
 
 template < geode::index_t dimension >
-void inspect_surface_curve(
+void inspect_surface_curves(
     const geode::TriangulatedSurface< dimension >& surface,
-    const geode::EdgedCurve< dimension >& curve )
+    absl::Span< const std::string > filenames_curv )
 {
-    const geode::SurfaceCurveIntersections< dimension > inspector{ surface,
-        curve };
-    const auto result = inspector.intersecting_elements();
-    geode::Logger::info( result.string() );
+    std::vector< std::unique_ptr< geode::EdgedCurve< dimension > > > curves;
+    std::vector< const geode::EdgedCurve< dimension >* > curve_ptrs;
+    curves.reserve( filenames_curv.size() );
+    curve_ptrs.reserve( filenames_curv.size() );
+    for( const auto& filename_curv : filenames_curv )
+    {
+        curves.emplace_back( geode::load_edged_curve< dimension >(
+            filename_curv ) );
+        curve_ptrs.push_back( curves.back().get() );
+    }
+    const geode::SurfaceCurvesIntersections< dimension > inspector{ surface };
+    const auto results = inspector.curves_intersecting_elements( curve_ptrs );
+    for( const auto c : geode::Indices{ results } )
+    {
+        geode::Logger::info( filenames_curv[c], ": ", results[c].string() );
+    }
 }
 
 int main( int argc, char* argv[] )
@@ -71,28 +87,29 @@ int main( int argc, char* argv[] )
         absl::SetProgramUsageMessage( absl::StrCat(
             "Surface-Curve intersections inspector from Geode-solutions.\n",
             "Sample usage:\n", argv[0],
-            " --surface my_surface.og_tsf3d --curve my_curve.og_edc3d\n" ) );
+            " --surface my_surface.og_tsf3d --curve "
+            "my_curve.og_edc3d,my_other_curve.og_edc3d\n" ) );
         absl::ParseCommandLine( argc, argv );
 
         geode::OpenGeodeIOMeshLibrary::initialize();
         geode::OpenGeodeGeosciencesIOMeshLibrary::initialize();
         const auto filename_surf = absl::GetFlag( FLAGS_surface );
-        const auto filename_curv = absl::GetFlag( FLAGS_curve );
+        const auto filenames_curv = absl::GetFlag( FLAGS_curve );
         const auto ext_surf =
             geode::to_string( geode::extension_from_filename( filename_surf ) );
 
         if( geode::TriangulatedSurfaceInputFactory3D::has_creator( ext_surf ) )
         {
-            inspect_surface_curve(
+            inspect_surface_curves(
                 *geode::load_triangulated_surface< 3 >( filename_surf ),
-                *geode::load_edged_curve< 3 >( filename_curv ) );
+                filenames_curv );
         }
         else if( geode::TriangulatedSurfaceInputFactory2D::has_creator(
                      ext_surf ) )
         {
-            inspect_surface_curve(
+            inspect_surface_curves(
                 *geode::load_triangulated_surface< 2 >( filename_surf ),
-                *geode::load_edged_curve< 2 >( filename_curv ) );
+                filenames_curv );
         }
         else
         {
@@ -27,6 +27,8 @@
 
 #include <geode/model/representation/core/brep.hpp>
 
+#include <geode/inspector/inspection/criterion/internal/model_unique_vertices.hpp>
+
 namespace geode
 {
     index_t BRepInspectionResult::nb_issues() const
@@ -47,19 +49,21 @@ namespace geode
     BRepInspector::BRepInspector( const BRep& brep )
         : AddInspectors< BRep, BRepMeshesInspector, BRepTopologyInspector >{
               brep
-          }
+          },
+          brep_( brep )
     {
     }
 
     BRepInspectionResult BRepInspector::inspect_brep() const
     {
         BRepInspectionResult result;
+        const internal::ModelUniqueVertices unique_vertices{ brep_ };
         async::parallel_invoke(
-            [&result, this] {
-                result.meshes = inspect_brep_meshes();
+            [&result, &unique_vertices, this] {
+                result.meshes = inspect_brep_meshes( unique_vertices );
             },
-            [&result, this] {
-                result.topology = inspect_brep_topology();
+            [&result, &unique_vertices, this] {
+                result.topology = inspect_brep_topology( unique_vertices );
             } );
         return result;
     }
@@ -25,6 +25,8 @@
 
 #include <async++.h>
 
+#include <geode/inspector/inspection/criterion/internal/model_unique_vertices.hpp>
+
 namespace geode
 {
     index_t BRepMeshesInspectionResult::nb_issues() const
@@ -33,6 +35,7 @@ namespace geode
                + meshes_colocation.nb_issues() + meshes_adjacencies.nb_issues()
                + meshes_degenerations.nb_issues()
                + meshes_intersections.nb_issues()
+               + ( lines_intersections ? lines_intersections->nb_issues() : 0 )
                + meshes_non_manifolds.nb_issues()
                + meshes_negative_elements.nb_issues();
     }
@@ -42,6 +45,7 @@ namespace geode
         return absl::StrCat( unique_vertices_colocation.string(),
             meshes_colocation.string(), meshes_adjacencies.string(),
             meshes_degenerations.string(), meshes_intersections.string(),
+            lines_intersections ? lines_intersections->string() : "",
             meshes_non_manifolds.string(), meshes_negative_elements.string() );
     }
 
@@ -57,11 +61,25 @@ namespace geode
           BRepComponentMeshesDegeneration( brep ),
           BRepComponentMeshesManifold( brep ),
           BRepComponentMeshesNegativeElements( brep ),
-          BRepMeshesIntersections( brep )
+          BRepMeshesIntersections( brep ),
+          BRepLinesIntersections( brep ),
+          brep_( brep )
     {
     }
 
+    void BRepMeshesInspector::set_lines_intersections_inspection(
+        bool activate )
+    {
+        lines_intersections_inspection_ = activate;
+    }
+
     BRepMeshesInspectionResult BRepMeshesInspector::inspect_brep_meshes() const
+    {
+        return inspect_brep_meshes( internal::ModelUniqueVertices{ brep_ } );
+    }
+
+    BRepMeshesInspectionResult BRepMeshesInspector::inspect_brep_meshes(
+        const internal::ModelUniqueVertices& unique_vertices ) const
     {
         BRepMeshesInspectionResult result;
         async::parallel_invoke(
@@ -77,11 +95,20 @@ namespace geode
             [&result, this] {
                 result.meshes_degenerations = inspect_elements_degeneration();
             },
-            [&result, this] {
-                result.meshes_intersections = inspect_intersections();
+            [&result, &unique_vertices, this] {
+                result.meshes_intersections =
+                    inspect_intersections( unique_vertices );
             },
-            [&result, this] {
-                result.meshes_non_manifolds = inspect_brep_manifold();
+            [&result, &unique_vertices, this] {
+                if( lines_intersections_inspection_ )
+                {
+                    result.lines_intersections =
+                        inspect_lines_intersections( unique_vertices );
+                }
+            },
+            [&result, &unique_vertices, this] {
+                result.meshes_non_manifolds =
+                    inspect_brep_manifold( unique_vertices );
             },
             [&result, this] {
                 result.meshes_negative_elements = inspect_negative_elements();
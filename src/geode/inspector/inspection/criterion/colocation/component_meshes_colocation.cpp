@@ -23,6 +23,13 @@
 
 #include <geode/inspector/inspection/criterion/colocation/component_meshes_colocation.hpp>
 
+#include <optional>
+#include <string_view>
+
+#include <async++.h>
+
+#include <absl/container/flat_hash_set.h>
+
 #include <geode/basic/logger.hpp>
 #include <geode/basic/pimpl_impl.hpp>
 #include <geode/basic/uuid.hpp>
@@ -45,6 +52,14 @@
 
 namespace
 {
+    using ColocationIssues =
+        geode::InspectionIssues< std::vector< geode::index_t > >;
+
+    /*!
+     * Keep one point per unique vertex in each group, by bucketing the group
+     * points on their unique vertex. Groups left with a single unique vertex
+     * are removed.
+     */
     template < typename Model >
     std::vector< std::vector< geode::index_t > >
         filter_colocated_points_with_same_unique_vertex( const Model& model,
@@ -54,126 +69,123 @@ namespace
     {
         std::vector< std::vector< geode::index_t > >
             new_colocated_points_groups;
+        absl::flat_hash_set< geode::index_t > group_unique_vertices;
         for( const auto& point_group : colocated_points_groups )
         {
-            absl::FixedArray< bool > filtered_colocation(
-                point_group.size() - 1, true );
-            for( const auto first_id : geode::Range{ point_group.size() - 1 } )
-            {
-                if( !filtered_colocation[first_id] )
-                {
-                    continue;
-                }
-                const auto first_uv = model.unique_vertex(
-                    { component_id, point_group[first_id] } );
-                for( const auto second_id :
-                    geode::Range{ first_id + 1, point_group.size() } )
-                {
-                    if( first_uv
-                        == model.unique_vertex(
-                            { component_id, point_group[second_id] } ) )
-                    {
-                        filtered_colocation[second_id - 1] = false;
-                    }
-                }
-            }
+            group_unique_vertices.clear();
+            group_unique_vertices.reserve( point_group.size() );
             std::vector< geode::index_t > colocated_points;
-            for( const auto pt_id : geode::Indices{ filtered_colocation } )
+            for( const auto point : point_group )
             {
-                if( filtered_colocation[pt_id] )
+                const auto unique_vertex =
+                    model.unique_vertex( { component_id, point } );
+                if( group_unique_vertices.emplace( unique_vertex ).second )
                 {
-                    colocated_points.push_back( point_group[pt_id + 1] );
+                    colocated_points.push_back( point );
                 }
             }
-            if( !colocated_points.empty() )
+            if( colocated_points.size() < 2 )
             {
-                colocated_points.push_back( point_group[0] );
-                new_colocated_points_groups.emplace_back(
-                    std::move( colocated_points ) );
+                continue;
             }
+            std::rotate( colocated_points.begin(),
+                colocated_points.begin() + 1, colocated_points.end() );
+            new_colocated_points_groups.emplace_back(
+                std::move( colocated_points ) );
         }
         return new_colocated_points_groups;
     }
 
-    template < typename Model >
-    void add_model_components_colocated_points_groups_base( const Model& model,
-        geode::InspectionIssuesMap< std::vector< geode::index_t > >&
-            components_colocated_points )
+    template < typename Inspector, typename Model, typename Component >
+    std::optional< ColocationIssues > component_colocated_points_groups(
+        const Model& model,
+        const Component& component,
+        std::string_view component_type )
     {
-        for( const auto& line : model.active_lines() )
+        const auto& mesh = component.mesh();
+        const Inspector inspector{ mesh };
+        const auto colocated_pts =
+            filter_colocated_points_with_same_unique_vertex< Model >( model,
+                component.component_id(),
+                inspector.colocated_points_groups().issues() );
+        if( colocated_pts.empty() )
         {
-            const geode::EdgedCurveColocation< Model::dim > inspector{
-                line.mesh()
-            };
-            auto colocated_pts =
-                filter_colocated_points_with_same_unique_vertex< Model >( model,
-                    line.component_id(),
-                    inspector.colocated_points_groups().issues() );
-            if( !colocated_pts.empty() )
+            return std::nullopt;
+        }
+        const auto component_name =
+            absl::StrCat( component_type, " ",
+                component.name().value_or( component.id().string() ), " (",
+                component.id().string(), ")" );
+        ColocationIssues component_issues{ absl::StrCat(
+            component_name, " colocated vertices" ) };
+        for( const auto& colocated_points_group : colocated_pts )
+        {
+            std::string point_group_string;
+            for( const auto point_index : colocated_points_group )
             {
-                geode::InspectionIssues< std::vector< geode::index_t > >
-                    line_issues{ absl::StrCat( "Line ",
-                        line.name().value_or( line.id().string() ), " (",
-                        line.id().string(), ") colocated vertices" ) };
-                const auto& line_mesh = line.mesh();
-                for( const auto& colocated_points_group : colocated_pts )
-                {
-                    std::string point_group_string;
-                    for( const auto point_index : colocated_points_group )
-                    {
-                        absl::StrAppend(
-                            &point_group_string, " ", point_index );
-                    }
-                    line_issues.add_issue( colocated_points_group,
-                        absl::StrCat( "Line ",
-                            line.name().value_or( line.id().string() ), " (",
-                            line.id().string(), ") has vertices ",
-                            point_group_string, " colocated at position [",
-                            line_mesh.point( colocated_points_group[0] )
-                                .string(),
-                            "]" ) );
-                }
-                components_colocated_points.add_issues_to_map(
-                    line.id(), std::move( line_issues ) );
+                absl::StrAppend( &point_group_string, " ", point_index );
             }
+            component_issues.add_issue( colocated_points_group,
+                absl::StrCat( component_name, " has vertices ",
+                    point_group_string, " colocated at position [",
+                    mesh.point( colocated_points_group[0] ).string(), "]" ) );
         }
-        for( const auto& surface : model.active_surfaces() )
+        return component_issues;
+    }
+
+    /*!
+     * Per component colocation tasks, run in parallel and gathered in
+     * spawning order.
+     */
+    class ComponentsColocationTasks
+    {
+    public:
+        template < typename Inspector, typename Model, typename Component >
+        void spawn( const Model& model,
+            const Component& component,
+            std::string_view component_type )
+        {
+            components_.push_back( component.id() );
+            tasks_.push_back(
+                async::spawn( [&model, &component, component_type] {
+                    return component_colocated_points_groups< Inspector >(
+                        model, component, component_type );
+                } ) );
+        }
+
+        void add_issues_to_map(
+            geode::InspectionIssuesMap< std::vector< geode::index_t > >&
+                components_colocated_points )
         {
-            const geode::SurfaceMeshColocation< Model::dim > inspector{
-                surface.mesh()
-            };
-            auto colocated_pts =
-                filter_colocated_points_with_same_unique_vertex< Model >( model,
-                    surface.component_id(),
-                    inspector.colocated_points_groups().issues() );
-            if( !colocated_pts.empty() )
+            for( const auto task_id : geode::Indices{ tasks_ } )
             {
-                geode::InspectionIssues< std::vector< geode::index_t > >
-                    surface_issues{ absl::StrCat( "Surface ",
-                        surface.name().value_or( surface.id().string() ), " (",
-                        surface.id().string(), ") colocated vertices" ) };
-                const auto& surface_mesh = surface.mesh();
-                for( const auto& colocated_points_group : colocated_pts )
+                if( auto issues = tasks_[task_id].get() )
                 {
-                    std::string point_group_string;
-                    for( const auto point_index : colocated_points_group )
-                    {
-                        absl::StrAppend(
-                            &point_group_string, " ", point_index );
-                    }
-                    surface_issues.add_issue( colocated_points_group,
-                        absl::StrCat( "Surface ",
-                            surface.name().value_or( surface.id().string() ),
-                            " (", surface.id().string(), ") has vertices ",
-                            point_group_string, " colocated at position [",
-                            surface_mesh.point( colocated_points_group[0] )
-                                .string(),
-                            "]" ) );
+                    components_colocated_points.add_issues_to_map(
+                        components_[task_id], std::move( issues.value() ) );
                 }
-                components_colocated_points.add_issues_to_map(
-                    surface.id(), std::move( surface_issues ) );
             }
         }
+
+    private:
+        std::vector< geode::uuid > components_;
+        std::vector< async::task< std::optional< ColocationIssues > > > tasks_;
+    };
+
+    template < typename Model >
+    void spawn_model_components_colocation_base(
+        const Model& model, ComponentsColocationTasks& tasks )
+    {
+        for( const auto& line : model.active_lines() )
+        {
+            tasks.spawn< geode::EdgedCurveColocation< Model::dim > >(
+                model, line, "Line" );
+        }
+        for( const auto& surface : model.active_surfaces() )
+        {
+            tasks.spawn< geode::SurfaceMeshColocation< Model::dim > >(
+                model, surface, "Surface" );
+        }
     }
 
     void add_model_components_colocated_points_groups(
@@ -181,53 +193,24 @@ namespace
         geode::InspectionIssuesMap< std::vector< geode::index_t > >&
             components_colocated_points )
     {
-        add_model_components_colocated_points_groups_base< geode::Section >(
-            model, components_colocated_points );
+        ComponentsColocationTasks tasks;
+        spawn_model_components_colocation_base( model, tasks );
+        tasks.add_issues_to_map( components_colocated_points );
     }
 
     void add_model_components_colocated_points_groups( const geode::BRep& model,
         geode::InspectionIssuesMap< std::vector< geode::index_t > >&
             components_colocated_points )
     {
-        add_model_components_colocated_points_groups_base< geode::BRep >(
-            model, components_colocated_points );
+        ComponentsColocationTasks tasks;
+        spawn_model_components_colocation_base( model, tasks );
         for( const auto& block : model.active_blocks() )
         {
-            const geode::SolidMeshColocation3D inspector{ block.mesh() };
-            auto colocated_pts =
-                filter_colocated_points_with_same_unique_vertex< geode::BRep >(
-                    model, block.component_id(),
-                    inspector.colocated_points_groups().issues() );
-            if( !colocated_pts.empty() )
-            {
-                geode::InspectionIssues< std::vector< geode::index_t > >
-                    block_issues{ absl::StrCat( "Block ",
-                        block.name().value_or( block.id().string() ), " (",
-                        block.id().string(), ") colocated vertices" ) };
-                const auto& block_mesh = block.mesh();
-                for( const auto& colocated_points_group : colocated_pts )
-                {
-                    std::string point_group_string;
-                    for( const auto point_index : colocated_points_group )
-                    {
-                        absl::StrAppend(
-                            &point_group_string, " ", point_index );
-                    }
-                    block_issues.add_issue( colocated_points_group,
-                        absl::StrCat( "Block ",
-                            block.name().value_or( block.id().string() ), " (",
-                            block.id().string(), ") has vertices ",
-                            point_group_string, " colocated at position [",
-                            block_mesh.point( colocated_points_group[0] )
-                                .string(),
-                            "]" ) );
-                }
-                components_colocated_points.add_issues_to_map(
-                    block.id(), std::move( block_issues ) );
-            }
+            tasks.spawn< geode::SolidMeshColocation3D >(
+                model, block, "Block" );
         }
+        tasks.add_issues_to_map( components_colocated_points );
     }
-
 } // namespace
 
 namespace geode
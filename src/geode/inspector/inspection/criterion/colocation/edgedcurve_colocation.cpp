@@ -66,6 +66,21 @@ namespace geode
         return impl_->colocated_points_groups();
     }
 
+    template < index_t dimension >
+    bool EdgedCurveColocation< dimension >::mesh_has_colocated_points(
+        double colocation_distance ) const
+    {
+        return impl_->mesh_has_colocated_points( colocation_distance );
+    }
+
+    template < index_t dimension >
+    InspectionIssues< std::vector< index_t > >
+        EdgedCurveColocation< dimension >::colocated_points_groups(
+            double colocation_distance ) const
+    {
+        return impl_->colocated_points_groups( colocation_distance );
+    }
+
     template class opengeode_inspector_inspection_api EdgedCurveColocation< 2 >;
     template class opengeode_inspector_inspection_api EdgedCurveColocation< 3 >;
 } // namespace geode
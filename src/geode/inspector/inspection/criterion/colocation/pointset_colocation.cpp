@@ -23,6 +23,7 @@
 
 #include <geode/inspector/inspection/criterion/colocation/pointset_colocation.hpp>
 #include <geode/inspector/inspection/criterion/internal/colocation_impl.hpp>
+#include <geode/inspector/inspection/criterion/internal/out_of_core_colocation.hpp>
 
 #include <geode/basic/logger.hpp>
 #include <geode/basic/pimpl_impl.hpp>
@@ -38,9 +39,32 @@ namespace geode
     public:
         Impl( const PointSet< dimension >& mesh )
             : internal::ColocationImpl< dimension, PointSet< dimension > >(
-                  mesh )
+                  mesh ),
+              mesh_( mesh )
         {
         }
+
+        bool mesh_has_colocated_points(
+            const OutOfCoreColocationParameters& parameters ) const
+        {
+            return internal::out_of_core_points_have_colocation(
+                mesh_, parameters );
+        }
+
+        InspectionIssues< std::vector< index_t > > colocated_points_groups(
+            const OutOfCoreColocationParameters& parameters ) const
+        {
+            return internal::out_of_core_colocated_points_groups(
+                mesh_, parameters );
+        }
+
+        using internal::ColocationImpl< dimension,
+            PointSet< dimension > >::mesh_has_colocated_points;
+        using internal::ColocationImpl< dimension,
+            PointSet< dimension > >::colocated_points_groups;
+
+    private:
+        const PointSet< dimension >& mesh_;
     };
 
     template < index_t dimension >
@@ -66,6 +90,36 @@ namespace geode
         return impl_->colocated_points_groups();
     }
 
+    template < index_t dimension >
+    bool PointSetColocation< dimension >::mesh_has_colocated_points(
+        double colocation_distance ) const
+    {
+        return impl_->mesh_has_colocated_points( colocation_distance );
+    }
+
+    template < index_t dimension >
+    InspectionIssues< std::vector< index_t > >
+        PointSetColocation< dimension >::colocated_points_groups(
+            double colocation_distance ) const
+    {
+        return impl_->colocated_points_groups( colocation_distance );
+    }
+
+    template < index_t dimension >
+    bool PointSetColocation< dimension >::mesh_has_colocated_points(
+        const OutOfCoreColocationParameters& parameters ) const
+    {
+        return impl_->mesh_has_colocated_points( parameters );
+    }
+
+    template < index_t dimension >
+    InspectionIssues< std::vector< index_t > >
+        PointSetColocation< dimension >::colocated_points_groups(
+            const OutOfCoreColocationParameters& parameters ) const
+    {
+        return impl_->colocated_points_groups( parameters );
+    }
+
     template class opengeode_inspector_inspection_api PointSetColocation< 2 >;
     template class opengeode_inspector_inspection_api PointSetColocation< 3 >;
 } // namespace geode
@@ -66,6 +66,21 @@ namespace geode
         return impl_->colocated_points_groups();
     }
 
+    template < index_t dimension >
+    bool SurfaceMeshColocation< dimension >::mesh_has_colocated_points(
+        double colocation_distance ) const
+    {
+        return impl_->mesh_has_colocated_points( colocation_distance );
+    }
+
+    template < index_t dimension >
+    InspectionIssues< std::vector< index_t > >
+        SurfaceMeshColocation< dimension >::colocated_points_groups(
+            double colocation_distance ) const
+    {
+        return impl_->colocated_points_groups( colocation_distance );
+    }
+
     template class opengeode_inspector_inspection_api
         SurfaceMeshColocation< 2 >;
     template class opengeode_inspector_inspection_api
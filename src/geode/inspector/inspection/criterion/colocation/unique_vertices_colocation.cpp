@@ -23,14 +23,18 @@
 
 #include <geode/inspector/inspection/criterion/colocation/unique_vertices_colocation.hpp>
 
+#include <atomic>
+#include <variant>
+#include <vector>
+
 #include <async++.h>
 
 #include <geode/basic/logger.hpp>
 #include <geode/basic/pimpl_impl.hpp>
+#include <geode/basic/uuid.hpp>
 
 #include <geode/geometry/point.hpp>
 
-#include <geode/mesh/builder/point_set_builder.hpp>
 #include <geode/mesh/core/edged_curve.hpp>
 #include <geode/mesh/core/point_set.hpp>
 #include <geode/mesh/core/solid_mesh.hpp>
@@ -43,130 +47,129 @@
 #include <geode/model/representation/core/brep.hpp>
 #include <geode/model/representation/core/section.hpp>
 
-#include <geode/inspector/inspection/criterion/colocation/pointset_colocation.hpp>
+#include <geode/inspector/inspection/criterion/internal/colocation_impl.hpp>
+#include <geode/inspector/inspection/criterion/internal/model_component_indices.hpp>
 
 namespace
 {
     template < typename Model >
-    bool model_cmv_is_colocated_on_point_base( const Model& model,
-        const geode::ComponentMeshVertex& cmv,
-        const geode::Point< Model::dim >& point )
-    {
-        if( cmv.component_id.type()
-            == geode::Line< Model::dim >::component_type_static() )
-        {
-            return point.inexact_equal( model.line( cmv.component_id.id() )
-                    .mesh()
-                    .point( cmv.vertex ) );
-        }
-        else if( cmv.component_id.type()
-                 == geode::Surface< Model::dim >::component_type_static() )
-        {
-            return point.inexact_equal( model.surface( cmv.component_id.id() )
-                    .mesh()
-                    .point( cmv.vertex ) );
-        }
-        return point.inexact_equal(
-            model.corner( cmv.component_id.id() ).mesh().point( cmv.vertex ) );
-    }
+    struct ComponentMeshPointer;
 
-    bool model_cmv_is_colocated_on_point( const geode::Section& model,
-        const geode::ComponentMeshVertex& cmv,
-        const geode::Point2D& point )
+    template <>
+    struct ComponentMeshPointer< geode::Section >
     {
-        return model_cmv_is_colocated_on_point_base< geode::Section >(
-            model, cmv, point );
-    }
+        using type = std::variant< const geode::PointSet2D*,
+            const geode::EdgedCurve2D*,
+            const geode::SurfaceMesh2D* >;
+    };
 
-    bool model_cmv_is_colocated_on_point( const geode::BRep& model,
-        const geode::ComponentMeshVertex& cmv,
-        const geode::Point3D& point )
+    template <>
+    struct ComponentMeshPointer< geode::BRep >
     {
-        if( cmv.component_id.type() == geode::Block3D::component_type_static() )
-        {
-            return point.inexact_equal( model.block( cmv.component_id.id() )
-                    .mesh()
-                    .point( cmv.vertex ) );
-        }
-        return model_cmv_is_colocated_on_point_base< geode::BRep >(
-            model, cmv, point );
-    }
+        using type = std::variant< const geode::PointSet3D*,
+            const geode::EdgedCurve3D*,
+            const geode::SurfaceMesh3D*,
+            const geode::SolidMesh3D* >;
+    };
 
+    /*!
+     * Array from the dense index of each component to its mesh, so that
+     * component mesh vertex points are resolved without going through the
+     * model component lookups.
+     */
     template < typename Model >
-    bool model_cmvs_are_colocated_on_point( const Model& model,
-        absl::Span< const geode::ComponentMeshVertex > cmvs,
-        const geode::Point< Model::dim >& point )
+    class ComponentMeshPoints
     {
-        for( const auto& cmv : cmvs )
+    public:
+        explicit ComponentMeshPoints( const Model& model )
+            : components_( model ), meshes_( components_.nb_components() )
         {
-            if( !model.component( cmv.component_id.id() ).is_active() )
+            for( const auto& corner : model.active_corners() )
             {
-                continue;
+                add_mesh( corner.id(), corner.mesh() );
             }
-            if( !model_cmv_is_colocated_on_point( model, cmv, point ) )
+            for( const auto& line : model.active_lines() )
             {
-                return false;
+                add_mesh( line.id(), line.mesh() );
+            }
+            for( const auto& surface : model.active_surfaces() )
+            {
+                add_mesh( surface.id(), surface.mesh() );
             }
+            add_block_meshes( model );
         }
-        return true;
-    }
 
-    template < typename Model >
-    geode::Point< Model::dim > model_cmv_point(
-        const Model& model, const geode::ComponentMeshVertex& cmv )
-    {
-        if( cmv.component_id.type()
-            == geode::Line< Model::dim >::component_type_static() )
+        /*!
+         * Return nullptr if the component is not active.
+         */
+        const geode::Point< Model::dim >* point(
+            const geode::ComponentMeshVertex& cmv ) const
         {
-            return model.line( cmv.component_id.id() )
-                .mesh()
-                .point( cmv.vertex );
+            const auto component =
+                components_.component_index( cmv.component_id.id() );
+            if( !components_.is_active( component ) )
+            {
+                return nullptr;
+            }
+            return std::visit(
+                [&cmv]( const auto* component_mesh ) {
+                    return &component_mesh->point( cmv.vertex );
+                },
+                meshes_[component] );
         }
-        if( cmv.component_id.type()
-            == geode::Surface< Model::dim >::component_type_static() )
+
+    private:
+        template < typename Mesh >
+        void add_mesh( const geode::uuid& component_id, const Mesh& mesh )
         {
-            return model.surface( cmv.component_id.id() )
-                .mesh()
-                .point( cmv.vertex );
+            meshes_[components_.component_index( component_id )] = &mesh;
         }
-        return model.corner( cmv.component_id.id() ).mesh().point( cmv.vertex );
-    }
 
-    std::optional< geode::Point2D > model_unique_vertex_point(
-        const geode::Section& model,
-        absl::Span< const geode::ComponentMeshVertex > cmvs )
+        void add_block_meshes( const geode::Section& /*unused*/ ) {}
+
+        void add_block_meshes( const geode::BRep& model )
+        {
+            for( const auto& block : model.active_blocks() )
+            {
+                add_mesh( block.id(), block.mesh() );
+            }
+        }
+
+    private:
+        geode::internal::ModelComponentIndices components_;
+        std::vector< typename ComponentMeshPointer< Model >::type > meshes_;
+    };
+
+    template < typename Model >
+    bool model_cmvs_are_colocated_on_point(
+        const ComponentMeshPoints< Model >& mesh_points,
+        absl::Span< const geode::ComponentMeshVertex > cmvs,
+        const geode::Point< Model::dim >& point )
     {
         for( const auto& cmv : cmvs )
         {
-            if( !model.component( cmv.component_id.id() ).is_active() )
+            const auto* cmv_point = mesh_points.point( cmv );
+            if( cmv_point && !point.inexact_equal( *cmv_point ) )
             {
-                continue;
+                return false;
             }
-            return model_cmv_point< geode::Section >( model, cmv );
         }
-        return std::nullopt;
+        return true;
     }
 
-    std::optional< geode::Point3D > model_unique_vertex_point(
-        const geode::BRep& model,
+    template < typename Model >
+    const geode::Point< Model::dim >* model_unique_vertex_point(
+        const ComponentMeshPoints< Model >& mesh_points,
         absl::Span< const geode::ComponentMeshVertex > cmvs )
     {
         for( const auto& cmv : cmvs )
         {
-            if( !model.component( cmv.component_id.id() ).is_active() )
+            if( const auto* cmv_point = mesh_points.point( cmv ) )
             {
-                continue;
+                return cmv_point;
             }
-            if( cmv.component_id.type()
-                == geode::Block3D::component_type_static() )
-            {
-                return model.block( cmv.component_id.id() )
-                    .mesh()
-                    .point( cmv.vertex );
-            }
-            return model_cmv_point< geode::BRep >( model, cmv );
         }
-        return std::nullopt;
+        return nullptr;
     }
 } // namespace
 
@@ -195,81 +198,96 @@ namespace geode
     public:
         Impl( const Model& model )
             : model_( model ),
-              active_uv_pointset_{ PointSet< Model::dim >::create() }
+              mesh_points_( model ),
+              uv_to_active_uv_( model.nb_unique_vertices(), NO_ID )
         {
-            auto builder =
-                PointSetBuilder< Model::dim >::create( *active_uv_pointset_ );
-            builder->create_vertices( model.nb_unique_vertices() );
-            std::vector< bool > not_assigned(
-                model.nb_unique_vertices(), true );
+            active_uv_points_.resize( model.nb_unique_vertices() );
+            async::parallel_for(
+                async::irange( index_t{ 0 }, model.nb_unique_vertices() ),
+                [&model, this]( index_t unique_vertex_id ) {
+                    const auto& cmvs =
+                        model.component_mesh_vertices( unique_vertex_id );
+                    if( const auto* point =
+                            model_unique_vertex_point( mesh_points_, cmvs ) )
+                    {
+                        active_uv_points_[unique_vertex_id] = *point;
+                        uv_to_active_uv_[unique_vertex_id] = unique_vertex_id;
+                    }
+                } );
             for( const auto unique_vertex_id :
                 Range{ model.nb_unique_vertices() } )
             {
-                if( auto point = model_unique_vertex_point( model,
-                        model.component_mesh_vertices( unique_vertex_id ) ) )
+                if( uv_to_active_uv_[unique_vertex_id] == NO_ID )
                 {
-                    builder->set_point( unique_vertex_id, point.value() );
-                    not_assigned[unique_vertex_id] = false;
+                    continue;
                 }
+                const auto active_uv_id = active_uv_to_uv_.size();
+                uv_to_active_uv_[unique_vertex_id] = active_uv_id;
+                active_uv_to_uv_.push_back( unique_vertex_id );
+                active_uv_points_[active_uv_id] =
+                    active_uv_points_[unique_vertex_id];
             }
-            const auto old2new = builder->delete_vertices( not_assigned );
-            for( const auto old_index : Indices{ old2new } )
-            {
-                uv_to_active_uv_.map( old_index, old2new[old_index] );
-            }
+            active_uv_points_.resize( active_uv_to_uv_.size() );
         }
 
         bool model_has_unique_vertices_linked_to_different_points() const
         {
-            for( const auto unique_vertex_id :
-                Range{ model_.nb_unique_vertices() } )
-            {
-                const auto active_uv_id =
-                    uv_to_active_uv_.in2out( unique_vertex_id ).at( 0 );
-                if( active_uv_id == NO_ID )
-                {
-                    continue;
-                }
-                if( !model_cmvs_are_colocated_on_point( model_,
-                        model_.component_mesh_vertices( unique_vertex_id ),
-                        active_uv_pointset_->point( active_uv_id ) ) )
-                {
-                    return true;
-                }
-            }
-            return false;
+            std::atomic< bool > found{ false };
+            async::parallel_for( async::irange( index_t{ 0 },
+                                     model_.nb_unique_vertices() ),
+                [this, &found]( index_t unique_vertex_id ) {
+                    if( found.load( std::memory_order_relaxed ) )
+                    {
+                        return;
+                    }
+                    if( is_linked_to_different_points( unique_vertex_id ) )
+                    {
+                        found.store( true, std::memory_order_relaxed );
+                    }
+                } );
+            return found.load();
         }
 
         bool model_has_colocated_unique_vertices() const
         {
-            const PointSetColocation< Model::dim > pointset_inspector{
-                *active_uv_pointset_
-            };
-            const auto has_colocation =
-                pointset_inspector.mesh_has_colocated_points();
-            return has_colocation;
+            return internal::points_have_colocation< Model::dim >(
+                active_uv_points_, GLOBAL_EPSILON );
         }
 
         void add_unique_vertices_linked_to_different_points(
             InspectionIssues< index_t >& vertices_issues ) const
         {
-            for( const auto unique_vertex_id :
-                Range{ model_.nb_unique_vertices() } )
+            const auto nb_unique_vertices = model_.nb_unique_vertices();
+            const auto nb_chunks = std::max( index_t{ 1 },
+                static_cast< index_t >( async::hardware_concurrency() ) );
+            std::vector< std::vector< index_t > > chunks_unique_vertices(
+                nb_chunks );
+            async::parallel_for( async::irange( index_t{ 0 }, nb_chunks ),
+                [this, &chunks_unique_vertices, nb_unique_vertices,
+                    nb_chunks]( index_t chunk ) {
+                    const auto begin = static_cast< index_t >(
+                        static_cast< std::size_t >( nb_unique_vertices )
+                        * chunk / nb_chunks );
+                    const auto end = static_cast< index_t >(
+                        static_cast< std::size_t >( nb_unique_vertices )
+                        * ( chunk + 1 ) / nb_chunks );
+                    for( const auto unique_vertex_id : Range{ begin, end } )
+                    {
+                        if( is_linked_to_different_points( unique_vertex_id ) )
+                        {
+                            chunks_unique_vertices[chunk].push_back(
+                                unique_vertex_id );
+                        }
+                    }
+                } );
+            for( const auto& chunk_unique_vertices : chunks_unique_vertices )
             {
-                const auto active_uv_id =
-                    uv_to_active_uv_.in2out( unique_vertex_id ).at( 0 );
-                if( active_uv_id == NO_ID )
-                {
-                    continue;
-                }
-                if( !model_cmvs_are_colocated_on_point( model_,
-                        model_.component_mesh_vertices( unique_vertex_id ),
-                        active_uv_pointset_->point( active_uv_id ) ) )
+                for( const auto unique_vertex_id : chunk_unique_vertices )
                 {
                     vertices_issues.add_issue( unique_vertex_id,
                         absl::StrCat( "unique vertex ", unique_vertex_id,
-                            " is linked to several mesh vertices on different "
-                            "positions" ) );
+                            " is linked to several mesh vertices on "
+                            "different positions" ) );
                 }
             }
         }
@@ -277,11 +295,9 @@ namespace geode
         void add_colocated_unique_vertices_groups(
             InspectionIssues< std::vector< index_t > >& vertices_issues ) const
         {
-            const PointSetColocation< Model::dim > pointset_inspector{
-                *active_uv_pointset_
-            };
             const auto colocated_pts_groups =
-                pointset_inspector.colocated_points_groups();
+                internal::colocated_points_groups< Model::dim >(
+                    active_uv_points_, GLOBAL_EPSILON );
             for( const auto& point_group : colocated_pts_groups.issues() )
             {
                 std::vector< index_t > fixed_point_group;
@@ -289,22 +305,37 @@ namespace geode
                 for( const auto active_uv_index : point_group )
                 {
                     const auto model_uv_index =
-                        uv_to_active_uv_.out2in( active_uv_index ).at( 0 );
+                        active_uv_to_uv_[active_uv_index];
                     fixed_point_group.push_back( model_uv_index );
                     absl::StrAppend( &point_group_string, " ", model_uv_index );
                 }
                 vertices_issues.add_issue( fixed_point_group,
                     absl::StrCat( "unique vertices ", point_group_string,
                         " are colocated at the position [",
-                        active_uv_pointset_->point( point_group[0] ).string(),
+                        active_uv_points_[point_group[0]].string(),
                         "]" ) );
             }
         }
 
+    private:
+        bool is_linked_to_different_points( index_t unique_vertex_id ) const
+        {
+            const auto active_uv_id = uv_to_active_uv_[unique_vertex_id];
+            if( active_uv_id == NO_ID )
+            {
+                return false;
+            }
+            return !model_cmvs_are_colocated_on_point( mesh_points_,
+                model_.component_mesh_vertices( unique_vertex_id ),
+                active_uv_points_[active_uv_id] );
+        }
+
     private:
         const Model& model_;
-        std::unique_ptr< PointSet< Model::dim > > active_uv_pointset_;
-        geode::GenericMapping< index_t > uv_to_active_uv_;
+        ComponentMeshPoints< Model > mesh_points_;
+        std::vector< Point< Model::dim > > active_uv_points_;
+        std::vector< index_t > active_uv_to_uv_;
+        std::vector< index_t > uv_to_active_uv_;
     };
 
     template < typename Model >
@@ -23,6 +23,8 @@
 
 #include <geode/inspector/inspection/criterion/internal/colocation_impl.hpp>
 
+#include <async++.h>
+
 #include <geode/basic/logger.hpp>
 
 #include <geode/mesh/core/edged_curve.hpp>
@@ -32,63 +34,78 @@
 
 #include <geode/geometry/point.hpp>
 
+#include <geode/inspector/inspection/criterion/internal/spatial_hash_colocation.hpp>
+
 namespace
 {
-    template < geode::index_t dimension, typename Mesh >
+    template < geode::index_t dimension >
     typename geode::NNSearch< dimension >::ColocatedInfo
-        mesh_points_colocated_info(
-            const Mesh& mesh, double colocation_distance )
+        points_colocated_info( std::vector< geode::Point< dimension > > points,
+            double colocation_distance )
     {
-        std::vector< geode::Point< dimension > > mesh_points(
-            mesh.nb_vertices() );
-        for( const auto point_index : geode::Range{ mesh.nb_vertices() } )
-        {
-            mesh_points[point_index] = mesh.point( point_index );
-        }
-        const geode::NNSearch< dimension > nnsearch{ mesh_points };
+        const geode::NNSearch< dimension > nnsearch{ std::move( points ) };
         return nnsearch.colocated_index_mapping( colocation_distance );
     }
 
-    template < geode::index_t dimension, typename Mesh >
+    /*!
+     * Gather colocated points by counting sort in a single CSR array:
+     * only groups of at least two points get their own storage.
+     */
+    template < geode::index_t dimension >
     geode::InspectionIssues< std::vector< geode::index_t > >
-        colocated_points_groups( const Mesh& mesh, double colocation_distance )
+        colocation_info_groups(
+            const typename geode::NNSearch< dimension >::ColocatedInfo&
+                colocation_info )
     {
-        const auto mesh_colocation_info =
-            mesh_points_colocated_info< dimension, Mesh >(
-                mesh, colocation_distance );
-        std::vector< std::vector< geode::index_t > > colocated_points_indices(
-            mesh_colocation_info.nb_unique_points() );
-        for( const auto point_index :
-            geode::Indices{ mesh_colocation_info.colocated_mapping } )
+        const auto& colocated_mapping = colocation_info.colocated_mapping;
+        std::vector< geode::index_t > unique_point_cursors(
+            colocation_info.nb_unique_points(), 0 );
+        for( const auto unique_point : colocated_mapping )
+        {
+            unique_point_cursors[unique_point]++;
+        }
+        std::vector< geode::index_t > groups_unique_point;
+        std::vector< geode::index_t > group_offsets{ 0 };
+        for( const auto unique_point : geode::Indices{ unique_point_cursors } )
+        {
+            const auto group_size = unique_point_cursors[unique_point];
+            if( group_size < 2 )
+            {
+                unique_point_cursors[unique_point] = geode::NO_ID;
+                continue;
+            }
+            unique_point_cursors[unique_point] = group_offsets.back();
+            groups_unique_point.push_back( unique_point );
+            group_offsets.push_back( group_offsets.back() + group_size );
+        }
+        std::vector< geode::index_t > groups_points( group_offsets.back() );
+        for( const auto point_index : geode::Indices{ colocated_mapping } )
         {
-            colocated_points_indices[mesh_colocation_info
-                                         .colocated_mapping[point_index]]
-                .push_back( point_index );
+            auto& cursor = unique_point_cursors[colocated_mapping[point_index]];
+            if( cursor != geode::NO_ID )
+            {
+                groups_points[cursor++] = point_index;
+            }
         }
-        const auto colocated_points_groups_end = std::remove_if(
-            colocated_points_indices.begin(), colocated_points_indices.end(),
-            []( const std::vector< geode::index_t >& colocated_points_group ) {
-                return colocated_points_group.size() < 2;
-            } );
-        colocated_points_indices.erase(
-            colocated_points_groups_end, colocated_points_indices.end() );
 
         geode::InspectionIssues< std::vector< geode::index_t > >
             groups_of_colocated_points{ "groups of colocated points" };
-        for( const auto& colocated_points_group : colocated_points_indices )
+        for( const auto group : geode::Indices{ groups_unique_point } )
         {
+            std::vector< geode::index_t > colocated_points_group(
+                groups_points.begin() + group_offsets[group],
+                groups_points.begin() + group_offsets[group + 1] );
             std::string point_group_string;
             for( const auto point_index : colocated_points_group )
             {
                 absl::StrAppend( &point_group_string, " ", point_index );
             }
-            groups_of_colocated_points.add_issue( colocated_points_group,
+            const auto& position =
+                colocation_info.unique_points[groups_unique_point[group]];
+            groups_of_colocated_points.add_issue(
+                std::move( colocated_points_group ),
                 absl::StrCat( "vertices ", point_group_string,
-                    " are colocated at the position [",
-                    mesh_colocation_info
-                        .unique_points[mesh_colocation_info
-                                .colocated_mapping[colocated_points_group[0]]]
-                        .string(),
+                    " are colocated at the position [", position.string(),
                     "]" ) );
         }
         return groups_of_colocated_points;
@@ -99,6 +116,42 @@ namespace geode
 {
     namespace internal
     {
+        /*!
+         * Gather the mesh points in a single parallel pass, ready to be
+         * moved into the search structure.
+         */
+        template < index_t dimension, typename Mesh >
+        std::vector< Point< dimension > > mesh_points( const Mesh& mesh )
+        {
+            std::vector< Point< dimension > > points( mesh.nb_vertices() );
+            async::parallel_for(
+                async::irange( index_t{ 0 }, mesh.nb_vertices() ),
+                [&mesh, &points]( index_t point_index ) {
+                    points[point_index] = mesh.point( point_index );
+                } );
+            return points;
+        }
+
+        template < index_t dimension >
+        bool points_have_colocation( std::vector< Point< dimension > > points,
+            double colocation_distance )
+        {
+            return points_colocated_info< dimension >(
+                       std::move( points ), colocation_distance )
+                       .nb_colocated_points()
+                   > 0;
+        }
+
+        template < index_t dimension >
+        InspectionIssues< std::vector< index_t > > colocated_points_groups(
+            std::vector< Point< dimension > > points,
+            double colocation_distance )
+        {
+            return colocation_info_groups< dimension >(
+                points_colocated_info< dimension >(
+                    std::move( points ), colocation_distance ) );
+        }
+
         template < index_t dimension, typename Mesh >
         ColocationImpl< dimension, Mesh >::ColocationImpl( const Mesh& mesh )
             : mesh_( mesh )
@@ -109,22 +162,49 @@ namespace geode
         bool
             ColocationImpl< dimension, Mesh >::mesh_has_colocated_points() const
         {
-            return mesh_points_colocated_info< dimension, Mesh >(
-                       mesh_, GLOBAL_EPSILON )
-                       .nb_colocated_points()
-                   > 0;
+            return points_have_colocation< dimension >(
+                mesh_points< dimension >( mesh_ ), GLOBAL_EPSILON );
         }
 
         template < index_t dimension, typename Mesh >
         InspectionIssues< std::vector< index_t > >
             ColocationImpl< dimension, Mesh >::colocated_points_groups() const
         {
-            const auto colocated_points_indices =
-                ::colocated_points_groups< dimension, Mesh >(
-                    mesh_, GLOBAL_EPSILON );
-            return colocated_points_indices;
+            return internal::colocated_points_groups< dimension >(
+                mesh_points< dimension >( mesh_ ), GLOBAL_EPSILON );
+        }
+
+        template < index_t dimension, typename Mesh >
+        bool ColocationImpl< dimension, Mesh >::mesh_has_colocated_points(
+            double colocation_distance ) const
+        {
+            const auto points = mesh_points< dimension >( mesh_ );
+            return spatial_hash_has_colocated_points< dimension >(
+                points, colocation_distance );
         }
 
+        template < index_t dimension, typename Mesh >
+        InspectionIssues< std::vector< index_t > >
+            ColocationImpl< dimension, Mesh >::colocated_points_groups(
+                double colocation_distance ) const
+        {
+            const auto points = mesh_points< dimension >( mesh_ );
+            return colocation_info_groups< dimension >(
+                spatial_hash_colocated_index_mapping< dimension >(
+                    points, colocation_distance ) );
+        }
+
+        template opengeode_inspector_inspection_api bool
+            points_have_colocation( std::vector< Point2D >, double );
+        template opengeode_inspector_inspection_api bool
+            points_have_colocation( std::vector< Point3D >, double );
+        template opengeode_inspector_inspection_api
+            InspectionIssues< std::vector< index_t > >
+            colocated_points_groups( std::vector< Point2D >, double );
+        template opengeode_inspector_inspection_api
+            InspectionIssues< std::vector< index_t > >
+            colocated_points_groups( std::vector< Point3D >, double );
+
         template class opengeode_inspector_inspection_api
             ColocationImpl< 2, PointSet2D >;
         template class opengeode_inspector_inspection_api
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#include <geode/inspector/inspection/criterion/internal/model_component_indices.hpp>
+
+#include <algorithm>
+
+#include <geode/model/mixin/core/block.hpp>
+#include <geode/model/mixin/core/corner.hpp>
+#include <geode/model/mixin/core/line.hpp>
+#include <geode/model/mixin/core/surface.hpp>
+#include <geode/model/representation/core/brep.hpp>
+#include <geode/model/representation/core/section.hpp>
+
+namespace geode
+{
+    namespace internal
+    {
+        ModelComponentIndices::ModelComponentIndices( const Section& section )
+        {
+            add_components( section.corners(), ComponentKind::corner );
+            add_components( section.lines(), ComponentKind::line );
+            add_components( section.surfaces(), ComponentKind::surface );
+        }
+
+        ModelComponentIndices::ModelComponentIndices( const BRep& brep )
+        {
+            add_components( brep.corners(), ComponentKind::corner );
+            add_components( brep.lines(), ComponentKind::line );
+            add_components( brep.surfaces(), ComponentKind::surface );
+            add_components( brep.blocks(), ComponentKind::block );
+        }
+
+        template < typename Components >
+        void ModelComponentIndices::add_components(
+            const Components& components, ComponentKind kind )
+        {
+            const auto kind_id = static_cast< index_t >( kind );
+            kind_offsets_[kind_id] = ids_.size();
+            for( const auto& component : components )
+            {
+                indices_.emplace( component.id(), ids_.size() );
+                ids_.push_back( component.component_id() );
+                active_.push_back( component.is_active() );
+            }
+            for( const auto next_kind :
+                Range{ kind_id + 1, static_cast< index_t >(
+                                        kind_offsets_.size() ) } )
+            {
+                kind_offsets_[next_kind] = ids_.size();
+            }
+        }
+
+        index_t ModelComponentIndices::nb_components() const
+        {
+            return ids_.size();
+        }
+
+        Range ModelComponentIndices::components( ComponentKind kind ) const
+        {
+            const auto kind_id = static_cast< local_index_t >( kind );
+            return Range{ kind_offsets_[kind_id], kind_offsets_[kind_id + 1] };
+        }
+
+        index_t ModelComponentIndices::component_index(
+            const uuid& component_id ) const
+        {
+            const auto it = indices_.find( component_id );
+            if( it == indices_.end() )
+            {
+                return NO_ID;
+            }
+            return it->second;
+        }
+
+        const ComponentID& ModelComponentIndices::component_id(
+            index_t component ) const
+        {
+            return ids_[component];
+        }
+
+        ModelComponentIndices::ComponentKind ModelComponentIndices::kind(
+            index_t component ) const
+        {
+            const auto next_kind = std::upper_bound(
+                kind_offsets_.begin(), kind_offsets_.end(), component );
+            return static_cast< ComponentKind >(
+                std::distance( kind_offsets_.begin(), next_kind ) - 1 );
+        }
+
+        bool ModelComponentIndices::is_active( index_t component ) const
+        {
+            return component < active_.size() && active_[component];
+        }
+
+        std::pair< index_t, index_t > ModelComponentIndices::kind_bounds(
+            ComponentKind kind ) const
+        {
+            const auto kind_id = static_cast< local_index_t >( kind );
+            return { kind_offsets_[kind_id], kind_offsets_[kind_id + 1] };
+        }
+    } // namespace internal
+} // namespace geode
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#include <geode/inspector/inspection/criterion/internal/model_unique_vertices.hpp>
+
+#include <async++.h>
+
+#include <absl/algorithm/container.h>
+
+#include <geode/mesh/core/edged_curve.hpp>
+#include <geode/mesh/core/point_set.hpp>
+#include <geode/mesh/core/solid_mesh.hpp>
+#include <geode/mesh/core/surface_mesh.hpp>
+
+#include <geode/model/mixin/core/block.hpp>
+#include <geode/model/mixin/core/corner.hpp>
+#include <geode/model/mixin/core/line.hpp>
+#include <geode/model/mixin/core/surface.hpp>
+#include <geode/model/mixin/core/vertex_identifier.hpp>
+#include <geode/model/representation/core/brep.hpp>
+#include <geode/model/representation/core/section.hpp>
+
+namespace
+{
+    template < typename Model >
+    std::vector< geode::index_t > model_components_nb_vertices_base(
+        const Model& model )
+    {
+        std::vector< geode::index_t > nb_vertices;
+        nb_vertices.reserve(
+            model.nb_corners() + model.nb_lines() + model.nb_surfaces() );
+        for( const auto& corner : model.corners() )
+        {
+            nb_vertices.push_back( corner.mesh().nb_vertices() );
+        }
+        for( const auto& line : model.lines() )
+        {
+            nb_vertices.push_back( line.mesh().nb_vertices() );
+        }
+        for( const auto& surface : model.surfaces() )
+        {
+            nb_vertices.push_back( surface.mesh().nb_vertices() );
+        }
+        return nb_vertices;
+    }
+} // namespace
+
+namespace geode
+{
+    namespace internal
+    {
+        ModelUniqueVertices::ModelUniqueVertices( const Section& section,
+            absl::Span< const ComponentKind > component_kinds )
+            : ModelComponentIndices( section )
+        {
+            build( section, model_components_nb_vertices_base( section ),
+                component_kinds );
+        }
+
+        ModelUniqueVertices::ModelUniqueVertices( const BRep& brep,
+            absl::Span< const ComponentKind > component_kinds )
+            : ModelComponentIndices( brep )
+        {
+            auto nb_vertices = model_components_nb_vertices_base( brep );
+            nb_vertices.reserve( nb_vertices.size() + brep.nb_blocks() );
+            for( const auto& block : brep.blocks() )
+            {
+                nb_vertices.push_back( block.mesh().nb_vertices() );
+            }
+            build( brep, nb_vertices, component_kinds );
+        }
+
+        template < typename Model >
+        void ModelUniqueVertices::build( const Model& model,
+            absl::Span< const index_t > nb_vertices,
+            absl::Span< const ComponentKind > component_kinds )
+        {
+            offsets_.reserve( nb_components() + 1 );
+            offsets_.push_back( 0 );
+            for( const auto component : Range{ nb_components() } )
+            {
+                const auto is_stored =
+                    component_kinds.empty()
+                    || absl::c_linear_search(
+                        component_kinds, kind( component ) );
+                offsets_.push_back( offsets_.back()
+                                    + ( is_stored ? nb_vertices[component]
+                                                  : 0 ) );
+            }
+            unique_vertices_.resize( offsets_.back() );
+            async::parallel_for(
+                async::irange( index_t{ 0 }, nb_components() ),
+                [this, &model]( index_t component ) {
+                    const auto begin = offsets_[component];
+                    const auto& id = component_id( component );
+                    async::parallel_for(
+                        async::irange(
+                            index_t{ 0 }, offsets_[component + 1] - begin ),
+                        [this, &model, &id, begin]( index_t vertex ) {
+                            unique_vertices_[begin + vertex] =
+                                model.unique_vertex( { id, vertex } );
+                        } );
+                } );
+        }
+
+        absl::Span< const index_t >
+            ModelUniqueVertices::component_unique_vertices(
+                index_t component ) const
+        {
+            if( component >= nb_components() )
+            {
+                return {};
+            }
+            return absl::MakeConstSpan( unique_vertices_ )
+                .subspan( offsets_[component],
+                    offsets_[component + 1] - offsets_[component] );
+        }
+
+        index_t ModelUniqueVertices::unique_vertex(
+            index_t component, index_t vertex ) const
+        {
+            const auto unique_vertices = component_unique_vertices( component );
+            if( vertex >= unique_vertices.size() )
+            {
+                return NO_ID;
+            }
+            return unique_vertices[vertex];
+        }
+
+        index_t ModelUniqueVertices::unique_vertex(
+            const ComponentMeshVertex& component_mesh_vertex ) const
+        {
+            return unique_vertex(
+                component_index( component_mesh_vertex.component_id.id() ),
+                component_mesh_vertex.vertex );
+        }
+    } // namespace internal
+} // namespace geode
@@ -0,0 +1,601 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/inspector/inspection/criterion/internal/out_of_core_colocation.hpp>
+
+#include <atomic>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <queue>
+
+#include <async++.h>
+
+#include <absl/container/flat_hash_map.h>
+
+#include <geode/basic/uuid.hpp>
+
+#include <geode/geometry/point.hpp>
+
+#include <geode/mesh/core/point_set.hpp>
+
+#include <geode/inspector/inspection/criterion/colocation/pointset_colocation.hpp>
+#include <geode/inspector/inspection/criterion/internal/concurrent_union_find.hpp>
+#include <geode/inspector/inspection/criterion/internal/grid_cell.hpp>
+#include <geode/inspector/inspection/criterion/internal/parallel_sort.hpp>
+
+namespace
+{
+    constexpr geode::index_t READ_BUFFER_SIZE{ 1 << 16 };
+
+    template < geode::index_t dimension >
+    using Cell = std::array< std::int64_t, dimension >;
+
+    /*!
+     * Mesh point with its grid cell, computed once before the sort and kept
+     * in the scratch files for the merge and the slab sweep.
+     */
+    template < geode::index_t dimension >
+    struct SpilledPoint
+    {
+        bool operator<( const SpilledPoint& other ) const
+        {
+            if( cell != other.cell )
+            {
+                return cell < other.cell;
+            }
+            return vertex < other.vertex;
+        }
+
+        Cell< dimension > cell;
+        std::array< double, dimension > coordinates;
+        geode::index_t vertex;
+    };
+
+    template < geode::index_t dimension >
+    double distance2( const SpilledPoint< dimension >& point0,
+        const SpilledPoint< dimension >& point1 )
+    {
+        double result{ 0 };
+        for( const auto d : geode::LRange{ dimension } )
+        {
+            const auto diff = point0.coordinates[d] - point1.coordinates[d];
+            result += diff * diff;
+        }
+        return result;
+    }
+
+    class ScratchFiles
+    {
+    public:
+        explicit ScratchFiles( const std::string& directory )
+            : directory_{ directory.empty()
+                              ? std::filesystem::temp_directory_path()
+                              : std::filesystem::path{ directory } },
+              prefix_{ absl::StrCat(
+                  "geode_colocation_", geode::uuid{}.string() ) }
+        {
+            geode::OpenGeodeInspectorInspectionException::test(
+                std::filesystem::is_directory( directory_ ),
+                "[OutOfCoreColocation] Scratch directory ",
+                directory_.string(), " does not exist" );
+        }
+
+        ~ScratchFiles()
+        {
+            for( const auto& file : files_ )
+            {
+                std::error_code error;
+                std::filesystem::remove( file, error );
+            }
+        }
+
+        const std::filesystem::path& new_file()
+        {
+            files_.push_back( directory_
+                              / absl::StrCat( prefix_, "_", files_.size() ) );
+            return files_.back();
+        }
+
+        const std::vector< std::filesystem::path >& files() const
+        {
+            return files_;
+        }
+
+    private:
+        std::filesystem::path directory_;
+        std::string prefix_;
+        std::vector< std::filesystem::path > files_;
+    };
+
+    template < geode::index_t dimension >
+    void write_sorted_runs( const geode::PointSet< dimension >& mesh,
+        const geode::OutOfCoreColocationParameters& parameters,
+        ScratchFiles& scratch_files )
+    {
+        const auto nb_vertices = mesh.nb_vertices();
+        const auto cell_size = parameters.colocation_distance;
+        std::vector< SpilledPoint< dimension > > chunk;
+        chunk.reserve( std::min( parameters.chunk_size, nb_vertices ) );
+        for( geode::index_t begin = 0; begin < nb_vertices; )
+        {
+            const auto end =
+                nb_vertices - begin > parameters.chunk_size
+                    ? begin + parameters.chunk_size
+                    : nb_vertices;
+            chunk.resize( end - begin );
+            std::atomic< bool > finite_points{ true };
+            async::parallel_for( async::irange( begin, end ),
+                [&mesh, &chunk, &finite_points, begin, cell_size](
+                    geode::index_t vertex ) {
+                    auto& spilled_point = chunk[vertex - begin];
+                    const auto& point = mesh.point( vertex );
+                    for( const auto d : geode::LRange{ dimension } )
+                    {
+                        const auto coordinate = point.value( d );
+                        if( !std::isfinite( coordinate ) )
+                        {
+                            finite_points.store(
+                                false, std::memory_order_relaxed );
+                        }
+                        spilled_point.coordinates[d] = coordinate;
+                        spilled_point.cell[d] =
+                            geode::internal::grid_cell_coordinate(
+                                coordinate, cell_size );
+                    }
+                    spilled_point.vertex = vertex;
+                } );
+            geode::OpenGeodeInspectorInspectionException::test(
+                finite_points.load(),
+                "[OutOfCoreColocation] Mesh points should have finite "
+                "coordinates" );
+            geode::internal::parallel_sort(
+                chunk, std::less< SpilledPoint< dimension > >{} );
+            const auto& file_path = scratch_files.new_file();
+            std::ofstream file{ file_path, std::ios::binary };
+            file.write( reinterpret_cast< const char* >( chunk.data() ),
+                chunk.size() * sizeof( SpilledPoint< dimension > ) );
+            file.close();
+            geode::OpenGeodeInspectorInspectionException::test( !file.fail(),
+                "[OutOfCoreColocation] Failed to write scratch file ",
+                file_path.string() );
+            begin = end;
+        }
+    }
+
+    template < geode::index_t dimension >
+    class SortedRunReader
+    {
+    public:
+        explicit SortedRunReader( const std::filesystem::path& file_path )
+            : file_path_{ file_path.string() },
+              file_{ file_path, std::ios::binary },
+              buffer_( READ_BUFFER_SIZE )
+        {
+            geode::OpenGeodeInspectorInspectionException::test(
+                file_.is_open(),
+                "[OutOfCoreColocation] Failed to read scratch file ",
+                file_path.string() );
+        }
+
+        bool next( SpilledPoint< dimension >& point )
+        {
+            if( current_ == nb_buffered_ )
+            {
+                file_.read( reinterpret_cast< char* >( buffer_.data() ),
+                    buffer_.size() * sizeof( SpilledPoint< dimension > ) );
+                const auto nb_bytes =
+                    static_cast< std::size_t >( file_.gcount() );
+                geode::OpenGeodeInspectorInspectionException::test(
+                    !file_.bad() && ( !file_.fail() || file_.eof() )
+                        && nb_bytes % sizeof( SpilledPoint< dimension > ) == 0,
+                    "[OutOfCoreColocation] Failed to read scratch file ",
+                    file_path_ );
+                nb_buffered_ = static_cast< geode::index_t >(
+                    nb_bytes / sizeof( SpilledPoint< dimension > ) );
+                current_ = 0;
+                if( nb_buffered_ == 0 )
+                {
+                    return false;
+                }
+            }
+            point = buffer_[current_++];
+            return true;
+        }
+
+    private:
+        std::string file_path_;
+        std::ifstream file_;
+        std::vector< SpilledPoint< dimension > > buffer_;
+        geode::index_t current_{ 0 };
+        geode::index_t nb_buffered_{ 0 };
+    };
+
+    template < geode::index_t dimension >
+    class SortedRunsMerger
+    {
+        struct Head
+        {
+            bool operator>( const Head& other ) const
+            {
+                return other.point < point;
+            }
+
+            SpilledPoint< dimension > point;
+            geode::index_t run;
+        };
+
+    public:
+        explicit SortedRunsMerger(
+            const std::vector< std::filesystem::path >& runs )
+        {
+            readers_.reserve( runs.size() );
+            for( const auto run : geode::Indices{ runs } )
+            {
+                readers_.emplace_back( runs[run] );
+                push_next( run );
+            }
+        }
+
+        bool next( SpilledPoint< dimension >& point )
+        {
+            if( heads_.empty() )
+            {
+                return false;
+            }
+            const auto head = heads_.top();
+            heads_.pop();
+            point = head.point;
+            push_next( head.run );
+            return true;
+        }
+
+    private:
+        void push_next( geode::index_t run )
+        {
+            SpilledPoint< dimension > point;
+            if( readers_[run].next( point ) )
+            {
+                heads_.push( { point, run } );
+            }
+        }
+
+    private:
+        std::vector< SortedRunReader< dimension > > readers_;
+        std::priority_queue< Head, std::vector< Head >, std::greater< Head > >
+            heads_;
+    };
+
+    /*!
+     * Points sharing the same cell coordinate along the first axis, sorted
+     * by cell. Points of a cell are contiguous.
+     */
+    template < geode::index_t dimension >
+    class Slab
+    {
+        using SubCell = std::array< std::int64_t, dimension - 1 >;
+
+    public:
+        static constexpr geode::index_t NB_NEIGHBOR_SUBCELLS{ dimension == 2
+                                                                  ? 3
+                                                                  : 9 };
+
+        std::int64_t coordinate() const
+        {
+            return coordinate_;
+        }
+
+        bool empty() const
+        {
+            return points_.empty();
+        }
+
+        geode::index_t nb_points() const
+        {
+            return static_cast< geode::index_t >( points_.size() );
+        }
+
+        const SpilledPoint< dimension >& point( geode::index_t position ) const
+        {
+            return points_[position];
+        }
+
+        void add_point( const SpilledPoint< dimension >& point )
+        {
+            coordinate_ = point.cell[0];
+            const auto position = nb_points();
+            points_.push_back( point );
+            cells_.try_emplace( sub_cell( point.cell ), position, position )
+                .first->second.second = position + 1;
+        }
+
+        void clear()
+        {
+            points_.clear();
+            cells_.clear();
+        }
+
+        /*!
+         * Positions range of the points of the given neighbor sub cell.
+         */
+        std::pair< geode::index_t, geode::index_t > neighbor_points(
+            const Cell< dimension >& cell, geode::index_t neighbor ) const
+        {
+            auto neighbor_cell = sub_cell( cell );
+            for( const auto d : geode::LRange{ dimension - 1 } )
+            {
+                neighbor_cell[d] +=
+                    static_cast< std::int64_t >( neighbor % 3 ) - 1;
+                neighbor /= 3;
+            }
+            const auto it = cells_.find( neighbor_cell );
+            if( it == cells_.end() )
+            {
+                return { 0, 0 };
+            }
+            return it->second;
+        }
+
+    private:
+        static SubCell sub_cell( const Cell< dimension >& cell )
+        {
+            SubCell result;
+            for( const auto d : geode::LRange{ dimension - 1 } )
+            {
+                result[d] = cell[d + 1];
+            }
+            return result;
+        }
+
+    private:
+        std::int64_t coordinate_{ 0 };
+        std::vector< SpilledPoint< dimension > > points_;
+        absl::flat_hash_map< SubCell,
+            std::pair< geode::index_t, geode::index_t > >
+            cells_;
+    };
+
+    /*!
+     * Call action( vertex0, vertex1 ) on every pair of close points involving
+     * a point of the current slab and a point of the current or the previous
+     * slab. Returns true if an action returned true to stop the search.
+     */
+    template < geode::index_t dimension, typename Action >
+    bool process_slab( const Slab< dimension >& previous,
+        const Slab< dimension >& current,
+        double colocation_distance,
+        const Action& action )
+    {
+        const auto max_distance2 = colocation_distance * colocation_distance;
+        const auto adjacent_slabs =
+            !previous.empty()
+            && previous.coordinate() + 1 == current.coordinate();
+        std::atomic< bool > stop{ false };
+        async::parallel_for(
+            async::irange( geode::index_t{ 0 }, current.nb_points() ),
+            [&]( geode::index_t position ) {
+                if( stop.load( std::memory_order_relaxed ) )
+                {
+                    return;
+                }
+                const auto& point = current.point( position );
+                const auto& cell = point.cell;
+                for( const auto neighbor :
+                    geode::Range{ Slab< dimension >::NB_NEIGHBOR_SUBCELLS } )
+                {
+                    const auto current_range =
+                        current.neighbor_points( cell, neighbor );
+                    for( const auto other : geode::Range{
+                             std::max( current_range.first, position + 1 ),
+                             std::max(
+                                 current_range.second, position + 1 ) } )
+                    {
+                        const auto& other_point = current.point( other );
+                        if( distance2( point, other_point ) <= max_distance2
+                            && action( point.vertex, other_point.vertex ) )
+                        {
+                            stop.store( true, std::memory_order_relaxed );
+                            return;
+                        }
+                    }
+                    if( !adjacent_slabs )
+                    {
+                        continue;
+                    }
+                    const auto previous_range =
+                        previous.neighbor_points( cell, neighbor );
+                    for( const auto other : geode::Range{
+                             previous_range.first, previous_range.second } )
+                    {
+                        const auto& other_point = previous.point( other );
+                        if( distance2( point, other_point ) <= max_distance2
+                            && action( point.vertex, other_point.vertex ) )
+                        {
+                            stop.store( true, std::memory_order_relaxed );
+                            return;
+                        }
+                    }
+                }
+            } );
+        return stop.load();
+    }
+
+    /*!
+     * Spill the sorted runs of mesh points, merge them and sweep the
+     * resulting stream slab by slab to find all pairs of close points.
+     */
+    template < geode::index_t dimension, typename Action >
+    void for_each_close_points_pair( const geode::PointSet< dimension >& mesh,
+        const geode::OutOfCoreColocationParameters& parameters,
+        const Action& action )
+    {
+        geode::OpenGeodeInspectorInspectionException::test(
+            std::isfinite( parameters.colocation_distance )
+                && parameters.colocation_distance > 0,
+            "[OutOfCoreColocation] Colocation distance should be finite and "
+            "strictly positive" );
+        geode::OpenGeodeInspectorInspectionException::test(
+            parameters.chunk_size > 0,
+            "[OutOfCoreColocation] Chunk size should be strictly positive" );
+        ScratchFiles scratch_files{ parameters.scratch_directory };
+        write_sorted_runs( mesh, parameters, scratch_files );
+        SortedRunsMerger< dimension > merger{ scratch_files.files() };
+        Slab< dimension > previous;
+        Slab< dimension > current;
+        SpilledPoint< dimension > point;
+        while( merger.next( point ) )
+        {
+            if( !current.empty() && point.cell[0] != current.coordinate() )
+            {
+                if( process_slab( previous, current,
+                        parameters.colocation_distance, action ) )
+                {
+                    return;
+                }
+                std::swap( previous, current );
+                current.clear();
+            }
+            current.add_point( point );
+        }
+        if( !current.empty() )
+        {
+            process_slab(
+                previous, current, parameters.colocation_distance, action );
+        }
+    }
+
+    /*!
+     * Pairs (root, vertex) of every vertex which is not the root of its set,
+     * sorted by root then vertex.
+     */
+    std::vector< std::pair< geode::index_t, geode::index_t > >
+        colocated_vertices( geode::internal::ConcurrentUnionFind& union_find,
+            geode::index_t nb_vertices )
+    {
+        const auto nb_chunks = std::max( geode::index_t{ 1 },
+            static_cast< geode::index_t >( async::hardware_concurrency() ) );
+        std::vector<
+            std::vector< std::pair< geode::index_t, geode::index_t > > >
+            chunks_vertices( nb_chunks );
+        async::parallel_for( async::irange( geode::index_t{ 0 }, nb_chunks ),
+            [&union_find, &chunks_vertices, nb_vertices, nb_chunks](
+                geode::index_t chunk ) {
+                const auto begin = static_cast< geode::index_t >(
+                    static_cast< std::size_t >( nb_vertices ) * chunk
+                    / nb_chunks );
+                const auto end = static_cast< geode::index_t >(
+                    static_cast< std::size_t >( nb_vertices ) * ( chunk + 1 )
+                    / nb_chunks );
+                for( const auto vertex : geode::Range{ begin, end } )
+                {
+                    const auto root = union_find.find( vertex );
+                    if( root != vertex )
+                    {
+                        chunks_vertices[chunk].emplace_back( root, vertex );
+                    }
+                }
+            } );
+        std::vector< std::pair< geode::index_t, geode::index_t > > result;
+        for( auto& chunk_vertices : chunks_vertices )
+        {
+            result.insert(
+                result.end(), chunk_vertices.begin(), chunk_vertices.end() );
+        }
+        geode::internal::parallel_sort( result );
+        return result;
+    }
+} // namespace
+
+namespace geode
+{
+    namespace internal
+    {
+        template < index_t dimension >
+        bool out_of_core_points_have_colocation(
+            const PointSet< dimension >& mesh,
+            const OutOfCoreColocationParameters& parameters )
+        {
+            std::atomic< bool > colocation_found{ false };
+            for_each_close_points_pair( mesh, parameters,
+                [&colocation_found]( index_t /*unused*/, index_t /*unused*/ ) {
+                    colocation_found.store( true, std::memory_order_relaxed );
+                    return true;
+                } );
+            return colocation_found.load();
+        }
+
+        template < index_t dimension >
+        InspectionIssues< std::vector< index_t > >
+            out_of_core_colocated_points_groups(
+                const PointSet< dimension >& mesh,
+                const OutOfCoreColocationParameters& parameters )
+        {
+            ConcurrentUnionFind union_find{ mesh.nb_vertices() };
+            for_each_close_points_pair( mesh, parameters,
+                [&union_find]( index_t vertex0, index_t vertex1 ) {
+                    union_find.unite( vertex0, vertex1 );
+                    return false;
+                } );
+            const auto vertices =
+                colocated_vertices( union_find, mesh.nb_vertices() );
+            InspectionIssues< std::vector< index_t > >
+                groups_of_colocated_points{ "groups of colocated points" };
+            for( index_t begin = 0; begin < vertices.size(); )
+            {
+                const auto root = vertices[begin].first;
+                std::vector< index_t > colocated_points_group{ root };
+                std::string point_group_string{ absl::StrCat( " ", root ) };
+                auto end = begin;
+                for( ; end < vertices.size() && vertices[end].first == root;
+                     end++ )
+                {
+                    colocated_points_group.push_back( vertices[end].second );
+                    absl::StrAppend(
+                        &point_group_string, " ", vertices[end].second );
+                }
+                groups_of_colocated_points.add_issue(
+                    std::move( colocated_points_group ),
+                    absl::StrCat( "vertices ", point_group_string,
+                        " are colocated at the position [",
+                        mesh.point( root ).string(), "]" ) );
+                begin = end;
+            }
+            return groups_of_colocated_points;
+        }
+
+        template opengeode_inspector_inspection_api bool
+            out_of_core_points_have_colocation(
+                const PointSet2D&, const OutOfCoreColocationParameters& );
+        template opengeode_inspector_inspection_api bool
+            out_of_core_points_have_colocation(
+                const PointSet3D&, const OutOfCoreColocationParameters& );
+        template opengeode_inspector_inspection_api
+            InspectionIssues< std::vector< index_t > >
+            out_of_core_colocated_points_groups(
+                const PointSet2D&, const OutOfCoreColocationParameters& );
+        template opengeode_inspector_inspection_api
+            InspectionIssues< std::vector< index_t > >
+            out_of_core_colocated_points_groups(
+                const PointSet3D&, const OutOfCoreColocationParameters& );
+    } // namespace internal
+} // namespace geode
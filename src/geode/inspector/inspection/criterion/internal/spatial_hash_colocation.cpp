@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/inspector/inspection/criterion/internal/spatial_hash_colocation.hpp>
+
+#include <atomic>
+#include <numeric>
+
+#include <async++.h>
+
+#include <absl/hash/hash.h>
+
+#include <geode/geometry/point.hpp>
+
+#include <geode/inspector/inspection/criterion/internal/concurrent_union_find.hpp>
+#include <geode/inspector/inspection/criterion/internal/grid_cell.hpp>
+
+namespace
+{
+    template < geode::index_t dimension >
+    class PointsGrid
+    {
+        using Cell = std::array< std::int64_t, dimension >;
+
+    public:
+        PointsGrid( absl::Span< const geode::Point< dimension > > points,
+            double cell_size )
+            : points_( points ),
+              cell_size_( cell_size ),
+              nb_buckets_( nb_buckets( points.size() ) ),
+              offsets_( nb_buckets_ + 1, 0 ),
+              bucket_points_( points.size() )
+        {
+            geode::OpenGeodeInspectorInspectionException::test( cell_size > 0,
+                "[PointsGrid] Colocation distance should be strictly "
+                "positive" );
+            std::vector< geode::index_t > point_buckets( points.size() );
+            std::vector< std::atomic< geode::index_t > > cursors( nb_buckets_ );
+            async::parallel_for(
+                async::irange( geode::index_t{ 0 }, nb_buckets_ ),
+                [&cursors]( geode::index_t bucket ) {
+                    cursors[bucket].store( 0, std::memory_order_relaxed );
+                } );
+            async::parallel_for( async::irange( geode::index_t{ 0 },
+                                     static_cast< geode::index_t >(
+                                         points.size() ) ),
+                [this, &point_buckets, &cursors]( geode::index_t point ) {
+                    const auto point_bucket = bucket( cell( points_[point] ) );
+                    point_buckets[point] = point_bucket;
+                    cursors[point_bucket].fetch_add(
+                        1, std::memory_order_relaxed );
+                } );
+            async::parallel_for(
+                async::irange( geode::index_t{ 0 }, nb_buckets_ ),
+                [this, &cursors]( geode::index_t bucket ) {
+                    offsets_[bucket + 1] =
+                        cursors[bucket].load( std::memory_order_relaxed );
+                } );
+            std::partial_sum(
+                offsets_.begin(), offsets_.end(), offsets_.begin() );
+            async::parallel_for(
+                async::irange( geode::index_t{ 0 }, nb_buckets_ ),
+                [this, &cursors]( geode::index_t bucket ) {
+                    cursors[bucket].store(
+                        offsets_[bucket], std::memory_order_relaxed );
+                } );
+            async::parallel_for( async::irange( geode::index_t{ 0 },
+                                     static_cast< geode::index_t >(
+                                         points.size() ) ),
+                [this, &point_buckets, &cursors]( geode::index_t point ) {
+                    const auto position =
+                        cursors[point_buckets[point]].fetch_add(
+                            1, std::memory_order_relaxed );
+                    bucket_points_[position] = point;
+                } );
+        }
+
+        /*!
+         * Call action( other ) on every point of greater index closer than
+         * the cell size. Iteration stops when action returns true.
+         * Returns true if an action returned true.
+         */
+        template < typename Action >
+        bool for_each_close_point(
+            geode::index_t point, const Action& action ) const
+        {
+            const auto& position = points_[point];
+            const auto center = cell( position );
+            const auto max_distance2 = cell_size_ * cell_size_;
+            for( const auto neighbor : geode::Range{ NB_NEIGHBOR_CELLS } )
+            {
+                auto neighbor_cell = center;
+                auto code = neighbor;
+                for( const auto d : geode::LRange{ dimension } )
+                {
+                    neighbor_cell[d] += static_cast< std::int64_t >( code % 3 )
+                                        - 1;
+                    code /= 3;
+                }
+                const auto neighbor_bucket = bucket( neighbor_cell );
+                for( const auto entry : geode::Range{
+                         offsets_[neighbor_bucket],
+                         offsets_[neighbor_bucket + 1] } )
+                {
+                    const auto other = bucket_points_[entry];
+                    if( other <= point
+                        || distance2( position, points_[other] )
+                               > max_distance2 )
+                    {
+                        continue;
+                    }
+                    if( action( other ) )
+                    {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+    private:
+        static geode::index_t nb_buckets( std::size_t nb_points )
+        {
+            geode::OpenGeodeInspectorInspectionException::test(
+                nb_points < geode::NO_ID,
+                "[PointsGrid] Too many points to be indexed" );
+            std::size_t nb{ 1 };
+            while( nb < nb_points && nb < MAX_NB_BUCKETS )
+            {
+                nb *= 2;
+            }
+            return static_cast< geode::index_t >( nb );
+        }
+
+        Cell cell( const geode::Point< dimension >& point ) const
+        {
+            Cell result;
+            for( const auto d : geode::LRange{ dimension } )
+            {
+                result[d] = geode::internal::grid_cell_coordinate(
+                    point.value( d ), cell_size_ );
+            }
+            return result;
+        }
+
+        geode::index_t bucket( const Cell& cell ) const
+        {
+            return static_cast< geode::index_t >(
+                absl::Hash< Cell >{}( cell ) & ( nb_buckets_ - 1 ) );
+        }
+
+        static double distance2( const geode::Point< dimension >& point0,
+            const geode::Point< dimension >& point1 )
+        {
+            double result{ 0 };
+            for( const auto d : geode::LRange{ dimension } )
+            {
+                const auto diff = point0.value( d ) - point1.value( d );
+                result += diff * diff;
+            }
+            return result;
+        }
+
+    private:
+        static constexpr geode::index_t NB_NEIGHBOR_CELLS{ dimension == 2
+                                                               ? 9
+                                                               : 27 };
+        static constexpr std::size_t MAX_NB_BUCKETS{ std::size_t{ 1 } << 31 };
+        absl::Span< const geode::Point< dimension > > points_;
+        double cell_size_;
+        geode::index_t nb_buckets_;
+        std::vector< geode::index_t > offsets_;
+        std::vector< geode::index_t > bucket_points_;
+    };
+} // namespace
+
+namespace geode
+{
+    namespace internal
+    {
+        template < index_t dimension >
+        typename NNSearch< dimension >::ColocatedInfo
+            spatial_hash_colocated_index_mapping(
+                absl::Span< const Point< dimension > > points,
+                double colocation_distance )
+        {
+            const auto nb_points = static_cast< index_t >( points.size() );
+            const PointsGrid< dimension > grid{ points, colocation_distance };
+            ConcurrentUnionFind colocated_points{ nb_points };
+            async::parallel_for( async::irange( index_t{ 0 }, nb_points ),
+                [&grid, &colocated_points]( index_t point ) {
+                    grid.for_each_close_point(
+                        point, [&colocated_points, point]( index_t other ) {
+                            colocated_points.unite( point, other );
+                            return false;
+                        } );
+                } );
+            std::vector< index_t > colocated_mapping( nb_points );
+            async::parallel_for( async::irange( index_t{ 0 }, nb_points ),
+                [&colocated_points, &colocated_mapping]( index_t point ) {
+                    colocated_mapping[point] = colocated_points.find( point );
+                } );
+            std::vector< Point< dimension > > unique_points;
+            for( const auto point : Range{ nb_points } )
+            {
+                const auto root = colocated_mapping[point];
+                if( root == point )
+                {
+                    colocated_mapping[point] =
+                        static_cast< index_t >( unique_points.size() );
+                    unique_points.push_back( points[point] );
+                }
+                else
+                {
+                    colocated_mapping[point] = colocated_mapping[root];
+                }
+            }
+            return typename NNSearch< dimension >::ColocatedInfo{
+                std::move( colocated_mapping ), std::move( unique_points )
+            };
+        }
+
+        template < index_t dimension >
+        bool spatial_hash_has_colocated_points(
+            absl::Span< const Point< dimension > > points,
+            double colocation_distance )
+        {
+            const PointsGrid< dimension > grid{ points, colocation_distance };
+            std::atomic< bool > colocation_found{ false };
+            async::parallel_for( async::irange( index_t{ 0 },
+                                     static_cast< index_t >( points.size() ) ),
+                [&grid, &colocation_found]( index_t point ) {
+                    if( colocation_found.load( std::memory_order_relaxed ) )
+                    {
+                        return;
+                    }
+                    if( grid.for_each_close_point( point, []( index_t ) {
+                            return true;
+                        } ) )
+                    {
+                        colocation_found.store(
+                            true, std::memory_order_relaxed );
+                    }
+                } );
+            return colocation_found.load();
+        }
+
+        template opengeode_inspector_inspection_api
+            typename NNSearch< 2 >::ColocatedInfo
+            spatial_hash_colocated_index_mapping(
+                absl::Span< const Point2D >, double );
+        template opengeode_inspector_inspection_api
+            typename NNSearch< 3 >::ColocatedInfo
+            spatial_hash_colocated_index_mapping(
+                absl::Span< const Point3D >, double );
+        template opengeode_inspector_inspection_api bool
+            spatial_hash_has_colocated_points(
+                absl::Span< const Point2D >, double );
+        template opengeode_inspector_inspection_api bool
+            spatial_hash_has_colocated_points(
+                absl::Span< const Point3D >, double );
+    } // namespace internal
+} // namespace geode
@@ -0,0 +1,468 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/inspector/inspection/criterion/internal/triangle_pairs_filter.hpp>
+
+#include <cmath>
+#include <limits>
+
+#include <geode/basic/range.hpp>
+
+#include <geode/geometry/point.hpp>
+
+namespace
+{
+    constexpr auto EPSILON = std::numeric_limits< double >::epsilon();
+    /*!
+     * Rounding error bounds of the orientation determinants relative to their
+     * permanent, from Shewchuk's adaptive predicates (taken with twice his
+     * machine epsilon to stay conservative).
+     */
+    constexpr auto ORIENT_2D_ERROR_BOUND = ( 3. + 16. * EPSILON ) * EPSILON;
+    constexpr auto ORIENT_3D_ERROR_BOUND = ( 7. + 56. * EPSILON ) * EPSILON;
+
+    /*!
+     * Orientation determinants needed by the separation tests of a triangle
+     * pair, as local indices among its six points (triangle1 points first):
+     * - in 3D, each triangle plane against each point of the other triangle,
+     * - in 2D, each triangle edge line against the triangle third point, then
+     * against each point of the other triangle.
+     */
+    template < geode::index_t dimension >
+    constexpr geode::index_t NB_ORIENTATIONS = dimension == 2 ? 24 : 6;
+
+    template < geode::index_t dimension >
+    using OrientationPoints = std::array< geode::local_index_t, dimension + 1 >;
+
+    template < geode::index_t dimension >
+    using Orientations = std::array< OrientationPoints< dimension >,
+        NB_ORIENTATIONS< dimension > >;
+
+    template < geode::index_t dimension >
+    using OrientationSigns =
+        std::array< std::int8_t, NB_ORIENTATIONS< dimension > >;
+
+    template < geode::index_t dimension >
+    using OrientationCoordinates =
+        std::array< std::array< double, dimension >, dimension + 1 >;
+
+    template < geode::index_t dimension >
+    [[nodiscard]] constexpr Orientations< dimension > orientations();
+
+    template <>
+    constexpr Orientations< 3 > orientations< 3 >()
+    {
+        Orientations< 3 > result{};
+        for( geode::local_index_t triangle = 0; triangle < 2; triangle++ )
+        {
+            const geode::local_index_t first = triangle * 3;
+            const geode::local_index_t other = ( 1 - triangle ) * 3;
+            const geode::local_index_t second = first + 1;
+            const geode::local_index_t third = first + 2;
+            for( geode::local_index_t v = 0; v < 3; v++ )
+            {
+                const geode::local_index_t point = other + v;
+                result[first + v] = { first, second, third, point };
+            }
+        }
+        return result;
+    }
+
+    [[nodiscard]] constexpr geode::local_index_t edge_line_orientation(
+        geode::local_index_t triangle,
+        geode::local_index_t edge,
+        geode::local_index_t vertex )
+    {
+        return 6 + ( triangle * 3 + edge ) * 3 + vertex;
+    }
+
+    template <>
+    constexpr Orientations< 2 > orientations< 2 >()
+    {
+        Orientations< 2 > result{};
+        for( geode::local_index_t triangle = 0; triangle < 2; triangle++ )
+        {
+            const geode::local_index_t first = triangle * 3;
+            const geode::local_index_t other = ( 1 - triangle ) * 3;
+            for( geode::local_index_t e = 0; e < 3; e++ )
+            {
+                const geode::local_index_t a = first + e;
+                const geode::local_index_t b = first + ( e + 1 ) % 3;
+                const geode::local_index_t c = first + ( e + 2 ) % 3;
+                result[first + e] = { a, b, c };
+                for( geode::local_index_t v = 0; v < 3; v++ )
+                {
+                    const geode::local_index_t point = other + v;
+                    result[edge_line_orientation( triangle, e, v )] = { a, b,
+                        point };
+                }
+            }
+        }
+        return result;
+    }
+
+    template < geode::index_t dimension >
+    constexpr auto ORIENTATIONS = orientations< dimension >();
+
+    /*!
+     * Sign of the determinant, 0 when the rounding error may change it.
+     */
+    [[nodiscard]] std::int8_t certified_sign(
+        double determinant, double error_bound )
+    {
+        return static_cast< std::int8_t >( ( determinant > error_bound )
+                                           - ( determinant < -error_bound ) );
+    }
+
+    [[nodiscard]] std::int8_t orientation_sign(
+        const OrientationCoordinates< 2 >& points )
+    {
+        const auto& pa = points[0];
+        const auto& pb = points[1];
+        const auto& pc = points[2];
+        const auto left = ( pa[0] - pc[0] ) * ( pb[1] - pc[1] );
+        const auto right = ( pa[1] - pc[1] ) * ( pb[0] - pc[0] );
+        const auto permanent = std::fabs( left ) + std::fabs( right );
+        return certified_sign( left - right, ORIENT_2D_ERROR_BOUND * permanent );
+    }
+
+    [[nodiscard]] std::int8_t orientation_sign(
+        const OrientationCoordinates< 3 >& points )
+    {
+        std::array< std::array< double, 3 >, 3 > diff;
+        for( const auto axis : geode::LRange{ 3 } )
+        {
+            const auto pd = points[3][axis];
+            diff[0][axis] = points[0][axis] - pd;
+            diff[1][axis] = points[1][axis] - pd;
+            diff[2][axis] = points[2][axis] - pd;
+        }
+        const auto& ad = diff[0];
+        const auto& bd = diff[1];
+        const auto& cd = diff[2];
+        const auto bdxcdy = bd[0] * cd[1];
+        const auto cdxbdy = cd[0] * bd[1];
+        const auto cdxady = cd[0] * ad[1];
+        const auto adxcdy = ad[0] * cd[1];
+        const auto adxbdy = ad[0] * bd[1];
+        const auto bdxady = bd[0] * ad[1];
+        const auto determinant = ad[2] * ( bdxcdy - cdxbdy )
+                                 + bd[2] * ( cdxady - adxcdy )
+                                 + cd[2] * ( adxbdy - bdxady );
+        const auto permanent =
+            ( std::fabs( bdxcdy ) + std::fabs( cdxbdy ) ) * std::fabs( ad[2] )
+            + ( std::fabs( cdxady ) + std::fabs( adxcdy ) ) * std::fabs( bd[2] )
+            + ( std::fabs( adxbdy ) + std::fabs( bdxady ) )
+                  * std::fabs( cd[2] );
+        return certified_sign( determinant, ORIENT_3D_ERROR_BOUND * permanent );
+    }
+
+    template < geode::index_t dimension >
+    [[nodiscard]] std::array< bool, 6 > considered_points(
+        const geode::internal::TrianglePoints< dimension >& triangle1,
+        const geode::internal::TrianglePoints< dimension >& triangle2,
+        absl::Span< const geode::internal::SharedTriangleVertex >
+            shared_vertices )
+    {
+        std::array< bool, 6 > considered;
+        considered.fill( true );
+        for( const auto& shared : shared_vertices )
+        {
+            if( *triangle1[shared[0]] != *triangle2[shared[1]] )
+            {
+                considered.fill( false );
+                return considered;
+            }
+            considered[shared[0]] = false;
+            considered[3 + shared[1]] = false;
+        }
+        return considered;
+    }
+
+    template < geode::index_t dimension >
+    [[nodiscard]] bool pair_separated(
+        const OrientationSigns< dimension >& signs,
+        const std::array< bool, 6 >& considered );
+
+    /*!
+     * A triangle plane separates the pair if all the considered points of
+     * the other triangle are strictly on the same side: the other triangle
+     * only touches the plane at the shared vertices.
+     */
+    template <>
+    bool pair_separated< 3 >( const OrientationSigns< 3 >& signs,
+        const std::array< bool, 6 >& considered )
+    {
+        for( const auto triangle : geode::LRange{ 2 } )
+        {
+            const geode::local_index_t first = triangle * 3;
+            const geode::local_index_t other = ( 1 - triangle ) * 3;
+            geode::index_t nb_considered{ 0 };
+            geode::index_t nb_positive{ 0 };
+            geode::index_t nb_negative{ 0 };
+            for( const auto v : geode::LRange{ 3 } )
+            {
+                const auto sign = signs[first + v];
+                const geode::index_t is_considered = considered[other + v];
+                nb_considered += is_considered;
+                nb_positive += is_considered * ( sign > 0 );
+                nb_negative += is_considered * ( sign < 0 );
+            }
+            if( nb_considered > 0
+                && ( nb_positive == nb_considered
+                     || nb_negative == nb_considered ) )
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    [[nodiscard]] bool edge_line_separates(
+        const OrientationSigns< 2 >& signs, geode::local_index_t triangle )
+    {
+        for( const auto e : geode::LRange{ 3 } )
+        {
+            const auto inner_side = signs[triangle * 3 + e];
+            if( inner_side == 0 )
+            {
+                continue;
+            }
+            bool separating{ true };
+            for( const auto v : geode::LRange{ 3 } )
+            {
+                separating &=
+                    signs[edge_line_orientation( triangle, e, v )]
+                    == -inner_side;
+            }
+            if( separating )
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /*!
+     * Without shared vertex, an edge line of a triangle separates the pair
+     * if the three points of the other triangle are strictly on the opposite
+     * side of the triangle third point. With a shared edge, the third points
+     * must be strictly on opposite sides of this edge.
+     */
+    template <>
+    bool pair_separated< 2 >( const OrientationSigns< 2 >& signs,
+        const std::array< bool, 6 >& considered )
+    {
+        geode::index_t nb_considered1{ 0 };
+        geode::index_t nb_considered2{ 0 };
+        for( const auto v : geode::LRange{ 3 } )
+        {
+            nb_considered1 += considered[v] ? 1 : 0;
+            nb_considered2 += considered[3 + v] ? 1 : 0;
+        }
+        if( nb_considered1 == 3 && nb_considered2 == 3 )
+        {
+            return edge_line_separates( signs, 0 )
+                   || edge_line_separates( signs, 1 );
+        }
+        if( nb_considered1 != 1 || nb_considered2 != 1 )
+        {
+            return false;
+        }
+        geode::local_index_t third1{ 0 };
+        geode::local_index_t third2{ 0 };
+        for( const auto v : geode::LRange{ 3 } )
+        {
+            if( considered[v] )
+            {
+                third1 = v;
+            }
+            if( considered[3 + v] )
+            {
+                third2 = v;
+            }
+        }
+        const geode::local_index_t shared_edge = ( third1 + 1 ) % 3;
+        const auto side1 = signs[shared_edge];
+        return side1 != 0
+               && signs[edge_line_orientation( 0, shared_edge, third2 )]
+                      == -side1;
+    }
+} // namespace
+
+namespace geode
+{
+    namespace internal
+    {
+        template < index_t dimension >
+        bool triangles_are_separated(
+            const TrianglePoints< dimension >& triangle1,
+            const TrianglePoints< dimension >& triangle2,
+            absl::Span< const SharedTriangleVertex > shared_vertices )
+        {
+            const auto considered =
+                considered_points( triangle1, triangle2, shared_vertices );
+            const auto point = [&triangle1, &triangle2]( local_index_t p ) {
+                return p < 3 ? triangle1[p] : triangle2[p - 3];
+            };
+            OrientationSigns< dimension > signs;
+            for( const auto o : LRange{ NB_ORIENTATIONS< dimension > } )
+            {
+                OrientationCoordinates< dimension > coordinates;
+                for( const auto p : LRange{ dimension + 1 } )
+                {
+                    for( const auto axis : LRange{ dimension } )
+                    {
+                        coordinates[p][axis] =
+                            point( ORIENTATIONS< dimension >[o][p] )
+                                ->value( axis );
+                    }
+                }
+                signs[o] = orientation_sign( coordinates );
+            }
+            return pair_separated< dimension >( signs, considered );
+        }
+
+        template < index_t dimension >
+        void TrianglePairsFilter< dimension >::clear()
+        {
+            for( auto& coordinates : coordinates_ )
+            {
+                coordinates.clear();
+            }
+            for( auto& considered : considered_points_ )
+            {
+                considered.clear();
+            }
+            orientation_signs_.clear();
+            separated_.clear();
+        }
+
+        template < index_t dimension >
+        index_t TrianglePairsFilter< dimension >::add_triangle_pair(
+            const TrianglePoints< dimension >& triangle1,
+            const TrianglePoints< dimension >& triangle2,
+            absl::Span< const SharedTriangleVertex > shared_vertices )
+        {
+            const auto triangle_pair = nb_triangle_pairs();
+            for( const auto v : LRange{ 3 } )
+            {
+                for( const auto axis : LRange{ dimension } )
+                {
+                    coordinates_[v * dimension + axis].push_back(
+                        triangle1[v]->value( axis ) );
+                    coordinates_[( v + 3 ) * dimension + axis].push_back(
+                        triangle2[v]->value( axis ) );
+                }
+            }
+            const auto considered =
+                considered_points( triangle1, triangle2, shared_vertices );
+            for( const auto p : LRange{ 6 } )
+            {
+                considered_points_[p].push_back( considered[p] ? 1 : 0 );
+            }
+            return triangle_pair;
+        }
+
+        template < index_t dimension >
+        index_t TrianglePairsFilter< dimension >::nb_triangle_pairs() const
+        {
+            return static_cast< index_t >( coordinates_[0].size() );
+        }
+
+        template < index_t dimension >
+        void TrianglePairsFilter< dimension >::filter()
+        {
+            const auto nb_pairs = nb_triangle_pairs();
+            orientation_signs_.resize(
+                NB_ORIENTATIONS< dimension > * nb_pairs );
+            for( const auto o : LRange{ NB_ORIENTATIONS< dimension > } )
+            {
+                std::array< const double*, ( dimension + 1 ) * dimension >
+                    columns;
+                for( const auto p : LRange{ dimension + 1 } )
+                {
+                    for( const auto axis : LRange{ dimension } )
+                    {
+                        columns[p * dimension + axis] =
+                            coordinates_[ORIENTATIONS< dimension >[o][p]
+                                             * dimension
+                                         + axis]
+                                .data();
+                    }
+                }
+                auto* signs = orientation_signs_.data() + o * nb_pairs;
+                for( const auto triangle_pair : Range{ nb_pairs } )
+                {
+                    OrientationCoordinates< dimension > coordinates;
+                    for( const auto p : LRange{ dimension + 1 } )
+                    {
+                        for( const auto axis : LRange{ dimension } )
+                        {
+                            coordinates[p][axis] =
+                                columns[p * dimension + axis][triangle_pair];
+                        }
+                    }
+                    signs[triangle_pair] = orientation_sign( coordinates );
+                }
+            }
+            separated_.resize( nb_pairs );
+            for( const auto triangle_pair : Range{ nb_pairs } )
+            {
+                OrientationSigns< dimension > signs;
+                for( const auto o : LRange{ NB_ORIENTATIONS< dimension > } )
+                {
+                    signs[o] = orientation_signs_[o * nb_pairs + triangle_pair];
+                }
+                std::array< bool, 6 > considered;
+                for( const auto p : LRange{ 6 } )
+                {
+                    considered[p] = considered_points_[p][triangle_pair] != 0;
+                }
+                separated_[triangle_pair] =
+                    pair_separated< dimension >( signs, considered ) ? 1 : 0;
+            }
+        }
+
+        template < index_t dimension >
+        bool TrianglePairsFilter< dimension >::are_separated(
+            index_t triangle_pair ) const
+        {
+            return separated_[triangle_pair] != 0;
+        }
+
+        template opengeode_inspector_inspection_api bool
+            triangles_are_separated( const TrianglePoints< 2 >&,
+                const TrianglePoints< 2 >&,
+                absl::Span< const SharedTriangleVertex > );
+        template opengeode_inspector_inspection_api bool
+            triangles_are_separated( const TrianglePoints< 3 >&,
+                const TrianglePoints< 3 >&,
+                absl::Span< const SharedTriangleVertex > );
+
+        template class opengeode_inspector_inspection_api
+            TrianglePairsFilter< 2 >;
+        template class opengeode_inspector_inspection_api
+            TrianglePairsFilter< 3 >;
+    } // namespace internal
+} // namespace geode
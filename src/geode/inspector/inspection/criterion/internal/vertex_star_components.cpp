@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/inspector/inspection/criterion/internal/vertex_star_components.hpp>
+
+#include <atomic>
+#include <numeric>
+
+#include <async++.h>
+
+#include <absl/algorithm/container.h>
+
+#include <geode/mesh/core/solid_mesh.hpp>
+#include <geode/mesh/core/surface_mesh.hpp>
+
+#include <geode/inspector/inspection/criterion/internal/concurrent_union_find.hpp>
+
+namespace
+{
+    constexpr auto NON_MANIFOLD = geode::NO_ID - 1;
+
+    template < typename NbElementVertices >
+    std::vector< geode::index_t > corners_offsets( geode::index_t nb_elements,
+        const NbElementVertices& nb_element_vertices )
+    {
+        std::vector< geode::index_t > offsets( nb_elements + 1, 0 );
+        async::parallel_for( async::irange( geode::index_t{ 0 }, nb_elements ),
+            [&offsets, &nb_element_vertices]( geode::index_t element ) {
+                offsets[element + 1] = nb_element_vertices( element );
+            } );
+        std::partial_sum( offsets.begin(), offsets.end(), offsets.begin() );
+        return offsets;
+    }
+
+    /*!
+     * Each vertex records the root of its first corner. Vertices with
+     * corners in another component are tagged as non manifold.
+     */
+    template < typename ElementVertex >
+    std::vector< geode::index_t > vertices_with_several_roots(
+        geode::index_t nb_vertices,
+        absl::Span< const geode::index_t > offsets,
+        geode::internal::ConcurrentUnionFind& corners,
+        const ElementVertex& element_vertex )
+    {
+        std::vector< std::atomic< geode::index_t > > vertex_roots(
+            nb_vertices );
+        async::parallel_for( async::irange( geode::index_t{ 0 }, nb_vertices ),
+            [&vertex_roots]( geode::index_t vertex ) {
+                vertex_roots[vertex].store(
+                    geode::NO_ID, std::memory_order_relaxed );
+            } );
+        const auto nb_elements =
+            static_cast< geode::index_t >( offsets.size() - 1 );
+        async::parallel_for( async::irange( geode::index_t{ 0 }, nb_elements ),
+            [&]( geode::index_t element ) {
+                for( const auto corner :
+                    geode::Range{ offsets[element], offsets[element + 1] } )
+                {
+                    const auto root = corners.find( corner );
+                    auto& vertex_root = vertex_roots[element_vertex(
+                        element, corner - offsets[element] )];
+                    auto expected =
+                        vertex_root.load( std::memory_order_relaxed );
+                    while( expected != root && expected != NON_MANIFOLD )
+                    {
+                        const auto desired =
+                            expected == geode::NO_ID ? root : NON_MANIFOLD;
+                        if( vertex_root.compare_exchange_weak(
+                                expected, desired, std::memory_order_relaxed ) )
+                        {
+                            break;
+                        }
+                    }
+                }
+            } );
+        std::vector< geode::index_t > result;
+        for( const auto vertex : geode::Range{ nb_vertices } )
+        {
+            if( vertex_roots[vertex].load( std::memory_order_relaxed )
+                == NON_MANIFOLD )
+            {
+                result.push_back( vertex );
+            }
+        }
+        return result;
+    }
+
+    template < typename Vertices >
+    geode::local_index_t vertex_position(
+        const Vertices& vertices, geode::index_t vertex )
+    {
+        const auto position = absl::c_find( vertices, vertex );
+        if( position == vertices.end() )
+        {
+            return geode::NO_LID;
+        }
+        return static_cast< geode::local_index_t >(
+            position - vertices.begin() );
+    }
+} // namespace
+
+namespace geode
+{
+    namespace internal
+    {
+        template < index_t dimension >
+        std::vector< index_t > vertices_with_disconnected_star(
+            const SurfaceMesh< dimension >& mesh )
+        {
+            const auto offsets = corners_offsets(
+                mesh.nb_polygons(), [&mesh]( index_t polygon ) {
+                    return mesh.nb_polygon_vertices( polygon );
+                } );
+            ConcurrentUnionFind corners{ offsets.back() };
+            async::parallel_for(
+                async::irange( index_t{ 0 }, mesh.nb_polygons() ),
+                [&mesh, &offsets, &corners]( index_t polygon ) {
+                    const auto vertices = mesh.polygon_vertices( polygon );
+                    for( const auto edge : LRange{ vertices.size() } )
+                    {
+                        const auto adjacent =
+                            mesh.polygon_adjacent( { polygon, edge } );
+                        if( !adjacent )
+                        {
+                            continue;
+                        }
+                        const auto adjacent_vertices =
+                            mesh.polygon_vertices( adjacent.value() );
+                        const local_index_t next =
+                            edge + 1u == vertices.size() ? 0 : edge + 1;
+                        for( const auto corner : { edge, next } )
+                        {
+                            const auto adjacent_corner = vertex_position(
+                                adjacent_vertices, vertices[corner] );
+                            if( adjacent_corner == NO_LID )
+                            {
+                                continue;
+                            }
+                            corners.unite( offsets[polygon] + corner,
+                                offsets[adjacent.value()] + adjacent_corner );
+                        }
+                    }
+                } );
+            return vertices_with_several_roots( mesh.nb_vertices(), offsets,
+                corners, [&mesh]( index_t polygon, local_index_t vertex ) {
+                    return mesh.polygon_vertex( { polygon, vertex } );
+                } );
+        }
+
+        template < index_t dimension >
+        std::vector< index_t > vertices_with_disconnected_star(
+            const SolidMesh< dimension >& mesh )
+        {
+            const auto offsets = corners_offsets(
+                mesh.nb_polyhedra(), [&mesh]( index_t polyhedron ) {
+                    return mesh.nb_polyhedron_vertices( polyhedron );
+                } );
+            ConcurrentUnionFind corners{ offsets.back() };
+            async::parallel_for(
+                async::irange( index_t{ 0 }, mesh.nb_polyhedra() ),
+                [&mesh, &offsets, &corners]( index_t polyhedron ) {
+                    const auto vertices =
+                        mesh.polyhedron_vertices( polyhedron );
+                    for( const auto facet :
+                        LRange{ mesh.nb_polyhedron_facets( polyhedron ) } )
+                    {
+                        const auto adjacent =
+                            mesh.polyhedron_adjacent( { polyhedron, facet } );
+                        if( !adjacent )
+                        {
+                            continue;
+                        }
+                        const auto adjacent_vertices =
+                            mesh.polyhedron_vertices( adjacent.value() );
+                        for( const auto vertex : mesh.polyhedron_facet_vertices(
+                                 { polyhedron, facet } ) )
+                        {
+                            const auto corner =
+                                vertex_position( vertices, vertex );
+                            const auto adjacent_corner =
+                                vertex_position( adjacent_vertices, vertex );
+                            if( corner == NO_LID || adjacent_corner == NO_LID )
+                            {
+                                continue;
+                            }
+                            corners.unite( offsets[polyhedron] + corner,
+                                offsets[adjacent.value()] + adjacent_corner );
+                        }
+                    }
+                } );
+            return vertices_with_several_roots( mesh.nb_vertices(), offsets,
+                corners, [&mesh]( index_t polyhedron, local_index_t vertex ) {
+                    return mesh.polyhedron_vertex( { polyhedron, vertex } );
+                } );
+        }
+
+        template std::vector< index_t > opengeode_inspector_inspection_api
+            vertices_with_disconnected_star( const SurfaceMesh< 2 >& );
+        template std::vector< index_t > opengeode_inspector_inspection_api
+            vertices_with_disconnected_star( const SurfaceMesh< 3 >& );
+        template std::vector< index_t > opengeode_inspector_inspection_api
+            vertices_with_disconnected_star( const SolidMesh< 3 >& );
+    } // namespace internal
+} // namespace geode
@@ -23,16 +23,25 @@
 
 #include <geode/inspector/inspection/criterion/intersections/model_intersections.hpp>
 
+#include <array>
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <optional>
+
 #include <async++.h>
 
 #include <absl/algorithm/container.h>
+#include <absl/container/flat_hash_map.h>
 
 #include <geode/basic/logger.hpp>
 #include <geode/basic/pimpl_impl.hpp>
 
 #include <geode/geometry/aabb.hpp>
+#include <geode/geometry/bounding_box.hpp>
 #include <geode/geometry/basic_objects/segment.hpp>
 #include <geode/geometry/basic_objects/triangle.hpp>
+#include <geode/geometry/distance.hpp>
 #include <geode/geometry/information.hpp>
 #include <geode/geometry/intersection_detection.hpp>
 #include <geode/geometry/position.hpp>
@@ -47,6 +56,10 @@
 #include <geode/model/representation/core/brep.hpp>
 #include <geode/model/representation/core/section.hpp>
 
+#include <geode/inspector/inspection/criterion/internal/model_unique_vertices.hpp>
+#include <geode/inspector/inspection/criterion/internal/parallel_sort.hpp>
+#include <geode/inspector/inspection/criterion/internal/triangle_pairs_filter.hpp>
+
 namespace
 {
     struct ComponentOverlap
@@ -62,6 +75,199 @@ namespace
             component_pairs;
     };
 
+    constexpr std::array< geode::internal::ModelUniqueVertices::ComponentKind,
+        1 >
+        SURFACE_KIND{
+            geode::internal::ModelUniqueVertices::ComponentKind::surface
+        };
+
+    /*!
+     * Minimum number of polygons of a surface part traversed by one task.
+     */
+    constexpr geode::index_t MIN_SURFACE_PART_SIZE{ 50'000 };
+    /*!
+     * Number of surface parts per thread aimed at for the largest surfaces,
+     * leaving room to the work stealing pool for load balancing.
+     */
+    constexpr geode::index_t SURFACE_PARTS_PER_THREAD{ 4 };
+
+    /*!
+     * Minimum estimated cost of the jobs run by one task, cheaper jobs being
+     * grouped to limit the scheduling overhead.
+     */
+    constexpr std::uint64_t MIN_TASK_COST{ 20'000 };
+    /*!
+     * Number of tasks per thread aimed at when grouping jobs.
+     */
+    constexpr std::uint64_t TASKS_PER_THREAD{ 4 };
+
+    [[nodiscard]] geode::index_t nb_worker_threads()
+    {
+        return std::max( geode::index_t{ 1 },
+            static_cast< geode::index_t >( async::hardware_concurrency() ) );
+    }
+
+    /*!
+     * Part of a surface mesh with its own AABB tree, traversed by one task.
+     * An empty polygon list means the part is the whole surface, tree
+     * elements being the surface polygons.
+     */
+    template < geode::index_t dimension >
+    struct SurfacePart
+    {
+        [[nodiscard]] geode::index_t polygon( geode::index_t element ) const
+        {
+            return polygons.empty() ? element : polygons[element];
+        }
+
+        const geode::AABBTree< dimension >& tree;
+        absl::Span< const geode::index_t > polygons;
+    };
+
+    /*!
+     * Traversal of a pair of surface parts, or of one part with itself.
+     */
+    template < geode::index_t dimension >
+    struct PartsIntersectionJob
+    {
+        /*!
+         * Number of elements of the traversed trees, the traversal cost
+         * being roughly proportional to it.
+         */
+        [[nodiscard]] std::uint64_t estimated_cost() const
+        {
+            if( self_traversal )
+            {
+                return part1.tree.nb_bboxes();
+            }
+            return static_cast< std::uint64_t >( part1.tree.nb_bboxes() )
+                   + part2.tree.nb_bboxes();
+        }
+
+        geode::uuid surface_id1;
+        geode::uuid surface_id2;
+        SurfacePart< dimension > part1;
+        SurfacePart< dimension > part2;
+        bool self_traversal;
+    };
+
+    /*!
+     * Large surface split into slabs of polygons sorted along the longest
+     * axis of the surface bounding box, each slab having its own AABB tree.
+     */
+    template < geode::index_t dimension >
+    class SurfaceSlabs
+    {
+    public:
+        SurfaceSlabs( const geode::SurfaceMesh< dimension >& mesh,
+            geode::index_t nb_slabs )
+            : trees_( nb_slabs ), polygons_( nb_slabs )
+        {
+            const auto nb_polygons = mesh.nb_polygons();
+            const auto axis = longest_axis( mesh.bounding_box() );
+            std::vector< geode::BoundingBox< dimension > > boxes(
+                nb_polygons );
+            std::vector< std::pair< double, geode::index_t > > sorted_polygons(
+                nb_polygons );
+            async::parallel_for( async::irange( geode::index_t{ 0 },
+                                     nb_polygons ),
+                [&mesh, &boxes, &sorted_polygons, axis](
+                    geode::index_t polygon ) {
+                    for( const auto vertex :
+                        mesh.polygon_vertices( polygon ) )
+                    {
+                        boxes[polygon].add_point( mesh.point( vertex ) );
+                    }
+                    const auto& box = boxes[polygon];
+                    sorted_polygons[polygon] = {
+                        box.min().value( axis ) + box.max().value( axis ),
+                        polygon
+                    };
+                } );
+            geode::internal::parallel_sort( sorted_polygons );
+            async::parallel_for(
+                async::irange( geode::index_t{ 0 }, nb_slabs ),
+                [this, &boxes, &sorted_polygons, nb_polygons, nb_slabs](
+                    geode::index_t slab ) {
+                    const auto begin = static_cast< geode::index_t >(
+                        static_cast< std::uint64_t >( nb_polygons ) * slab
+                        / nb_slabs );
+                    const auto end = static_cast< geode::index_t >(
+                        static_cast< std::uint64_t >( nb_polygons )
+                        * ( slab + 1 ) / nb_slabs );
+                    auto& slab_polygons = polygons_[slab];
+                    slab_polygons.reserve( end - begin );
+                    std::vector< geode::BoundingBox< dimension > > slab_boxes;
+                    slab_boxes.reserve( end - begin );
+                    for( const auto sorted : geode::Range{ begin, end } )
+                    {
+                        const auto polygon = sorted_polygons[sorted].second;
+                        slab_polygons.push_back( polygon );
+                        slab_boxes.push_back( boxes[polygon] );
+                    }
+                    trees_[slab] = geode::AABBTree< dimension >{ slab_boxes };
+                } );
+        }
+
+        [[nodiscard]] std::vector< SurfacePart< dimension > > parts() const
+        {
+            std::vector< SurfacePart< dimension > > parts;
+            parts.reserve( trees_.size() );
+            for( const auto slab : geode::Indices{ trees_ } )
+            {
+                parts.push_back( { trees_[slab], polygons_[slab] } );
+            }
+            return parts;
+        }
+
+    private:
+        [[nodiscard]] static geode::local_index_t longest_axis(
+            const geode::BoundingBox< dimension >& box )
+        {
+            geode::local_index_t axis{ 0 };
+            for( const auto other : geode::LRange{ 1, dimension } )
+            {
+                if( box.max().value( other ) - box.min().value( other )
+                    > box.max().value( axis ) - box.min().value( axis ) )
+                {
+                    axis = other;
+                }
+            }
+            return axis;
+        }
+
+    private:
+        std::vector< geode::AABBTree< dimension > > trees_;
+        std::vector< std::vector< geode::index_t > > polygons_;
+    };
+
+    /*!
+     * Forwards the intersections between elements of two surface parts to
+     * an action working on the surface polygons.
+     */
+    template < typename Action, geode::index_t dimension >
+    class SurfacePartsAction
+    {
+    public:
+        SurfacePartsAction( Action& action,
+            const SurfacePart< dimension >& part1,
+            const SurfacePart< dimension >& part2 )
+            : action_( action ), part1_( part1 ), part2_( part2 )
+        {
+        }
+
+        bool operator()( geode::index_t element1, geode::index_t element2 )
+        {
+            return action_(
+                part1_.polygon( element1 ), part2_.polygon( element2 ) );
+        }
+
+    private:
+        Action& action_;
+        const SurfacePart< dimension >& part1_;
+        const SurfacePart< dimension >& part2_;
+    };
+
     [[nodiscard]] absl::InlinedVector< geode::PolygonVertices, 1 >
         polygon_fan_triangles(
             const geode::PolygonVertices& polygon, geode::local_index_t apex )
@@ -160,42 +366,150 @@ namespace
             intersecting_surface_polygon_line_edge_;
     };
 
+    /*!
+     * Number of candidate polygon pairs tested together by the narrow phase.
+     */
+    constexpr geode::index_t NARROW_PHASE_BATCH_SIZE{ 512 };
+
+    /*!
+     * Surfaces intersection detection in two phases: the AABB traversal
+     * (broad phase) only collects candidate polygon pairs, then the narrow
+     * phase sorts them and tests their triangles by batches. Triangle pairs
+     * are first classified by their shared unique vertices from the snapshot
+     * tables, then a floating-point filter discards certainly separated
+     * triangles, disjoint or neighboring, before the exact predicates.
+     * When stopping at the first intersection, candidates are tested as soon
+     * as a batch is full and the stop flag shared by all the traversals is
+     * raised on the first hit.
+     */
     template < typename Model >
     class ModelSurfacesIntersectionBase
     {
+        struct TrianglePair
+        {
+            geode::index_t candidate;
+            geode::PolygonVertices triangle1;
+            geode::PolygonVertices triangle2;
+            absl::InlinedVector< std::array< geode::index_t, 2 >, 3 >
+                common_vertices;
+            geode::index_t filter_id;
+        };
+
     public:
         ModelSurfacesIntersectionBase( const Model& model,
+            const geode::internal::ModelUniqueVertices& unique_vertices,
             const geode::uuid& surface_id1,
-            const geode::uuid& surface_id2 )
-            : model_( model ),
-              same_surface_{ surface_id1 == surface_id2 },
+            const geode::uuid& surface_id2,
+            std::atomic< bool >& stop_flag,
+            bool stop_at_first_intersection )
+            : same_surface_{ surface_id1 == surface_id2 },
+              stop_at_first_intersection_{ stop_at_first_intersection },
+              stop_flag_( stop_flag ),
               surface1_( model.surface( surface_id1 ) ),
               surface2_( model.surface( surface_id2 ) ),
               mesh1_( surface1_.mesh() ),
-              mesh2_( same_surface_ ? mesh1_ : surface2_.mesh() )
+              mesh2_( same_surface_ ? mesh1_ : surface2_.mesh() ),
+              unique_vertices1_( unique_vertices.component_unique_vertices(
+                  unique_vertices.component_index( surface_id1 ) ) ),
+              unique_vertices2_( unique_vertices.component_unique_vertices(
+                  unique_vertices.component_index( surface_id2 ) ) )
         {
         }
 
         [[nodiscard]] std::vector< std::pair< geode::index_t, geode::index_t > >
             intersecting_polygons()
         {
+            test_candidates();
             return std::move( intersecting_polygons_ );
         }
 
     protected:
-        [[nodiscard]] bool polygons_intersect(
-            geode::index_t p1_id, geode::index_t p2_id ) const
+        /*!
+         * Returns true if the traversal should stop.
+         */
+        bool add_candidate( geode::index_t p1_id, geode::index_t p2_id )
         {
-            const auto p1_vertices = this->mesh1().polygon_vertices( p1_id );
-            const auto p2_vertices = this->mesh2().polygon_vertices( p2_id );
-            if( p1_vertices.size() < 3 || p2_vertices.size() < 3 )
+            if( !stop_at_first_intersection_ )
             {
+                candidates_.emplace_back( p1_id, p2_id );
                 return false;
             }
-            if( p1_vertices.size() == 3 && p2_vertices.size() == 3 )
+            if( stopped() )
+            {
+                return true;
+            }
+            candidates_.emplace_back( p1_id, p2_id );
+            if( candidates_.size() >= NARROW_PHASE_BATCH_SIZE )
+            {
+                test_candidates();
+                return stopped();
+            }
+            return false;
+        }
+
+    private:
+        [[nodiscard]] bool stopped() const
+        {
+            return stop_flag_.load( std::memory_order_relaxed );
+        }
+
+        void test_candidates()
+        {
+            absl::c_sort( candidates_ );
+            const auto nb_candidates =
+                static_cast< geode::index_t >( candidates_.size() );
+            for( geode::index_t batch_begin = 0; batch_begin < nb_candidates;
+                batch_begin += NARROW_PHASE_BATCH_SIZE )
+            {
+                if( stop_at_first_intersection_ && stopped() )
+                {
+                    break;
+                }
+                const auto batch_end = std::min(
+                    batch_begin + NARROW_PHASE_BATCH_SIZE, nb_candidates );
+                test_candidates_batch( batch_begin, batch_end );
+            }
+            candidates_.clear();
+        }
+
+        void test_candidates_batch(
+            geode::index_t batch_begin, geode::index_t batch_end )
+        {
+            filter_.clear();
+            triangle_pairs_.clear();
+            for( const auto candidate : geode::Range{ batch_begin, batch_end } )
             {
-                return triangles_intersection_detection(
-                    p1_vertices, p2_vertices );
+                add_candidate_triangle_pairs( candidate );
+            }
+            filter_.filter();
+            auto last_intersecting = geode::NO_ID;
+            for( const auto& triangle_pair : triangle_pairs_ )
+            {
+                if( triangle_pair.candidate == last_intersecting
+                    || !triangles_intersection_detection( triangle_pair ) )
+                {
+                    continue;
+                }
+                last_intersecting = triangle_pair.candidate;
+                intersecting_polygons_.push_back(
+                    candidates_[triangle_pair.candidate] );
+                if( stop_at_first_intersection_ )
+                {
+                    stop_flag_.store( true, std::memory_order_relaxed );
+                    return;
+                }
+            }
+        }
+
+        void add_candidate_triangle_pairs( geode::index_t candidate )
+        {
+            const auto p1_vertices =
+                this->mesh1().polygon_vertices( candidates_[candidate].first );
+            const auto p2_vertices =
+                this->mesh2().polygon_vertices( candidates_[candidate].second );
+            if( p1_vertices.size() < 3 || p2_vertices.size() < 3 )
+            {
+                return;
             }
             const auto p1_triangles = polygon_fan_triangles( p1_vertices, 0 );
             const auto p2_triangles = polygon_fan_triangles( p2_vertices, 0 );
@@ -203,25 +517,38 @@ namespace
             {
                 for( const auto& p2_triangle : p2_triangles )
                 {
-                    if( triangles_intersection_detection(
-                            p1_triangle, p2_triangle ) )
+                    auto common_vertices =
+                        triangles_common_vertices( p1_triangle, p2_triangle );
+                    auto filter_id = geode::NO_ID;
+                    if( common_vertices.size() < 3 )
                     {
-                        return true;
+                        filter_id = filter_.add_triangle_pair(
+                            triangle_points( mesh1_, p1_triangle ),
+                            triangle_points( mesh2_, p2_triangle ),
+                            shared_triangle_vertices(
+                                p1_triangle, p2_triangle, common_vertices ) );
                     }
+                    triangle_pairs_.push_back( { candidate, p1_triangle,
+                        p2_triangle, std::move( common_vertices ),
+                        filter_id } );
                 }
             }
-            return false;
         }
 
         [[nodiscard]] bool triangles_intersection_detection(
-            const geode::PolygonVertices& t1_vertices,
-            const geode::PolygonVertices& t2_vertices ) const
+            const TrianglePair& triangle_pair ) const
         {
-            const auto common_vertices =
-                this->triangles_common_vertices( t1_vertices, t2_vertices );
-            return common_vertices.size() == 3
-                   || this->triangles_intersect(
-                       t1_vertices, t2_vertices, common_vertices );
+            if( triangle_pair.common_vertices.size() == 3 )
+            {
+                return true;
+            }
+            if( triangle_pair.filter_id != geode::NO_ID
+                && filter_.are_separated( triangle_pair.filter_id ) )
+            {
+                return false;
+            }
+            return this->triangles_intersect( triangle_pair.triangle1,
+                triangle_pair.triangle2, triangle_pair.common_vertices );
         }
 
         [[nodiscard]] absl::InlinedVector< std::array< geode::index_t, 2 >, 3 >
@@ -233,13 +560,10 @@ namespace
                 common_vertices;
             for( const auto v1_id : t1_vertices )
             {
-                const auto v1_unique_vertex =
-                    model_.unique_vertex( { surface1_.component_id(), v1_id } );
+                const auto v1_unique_vertex = unique_vertices1_[v1_id];
                 for( const auto v2_id : t2_vertices )
                 {
-                    if( v1_unique_vertex
-                        == model_.unique_vertex(
-                            { surface2_.component_id(), v2_id } ) )
+                    if( v1_unique_vertex == unique_vertices2_[v2_id] )
                     {
                         common_vertices.push_back( { v1_id, v2_id } );
                         break;
@@ -249,17 +573,52 @@ namespace
             return common_vertices;
         }
 
+        [[nodiscard]] static absl::InlinedVector<
+            geode::internal::SharedTriangleVertex,
+            3 >
+            shared_triangle_vertices( const geode::PolygonVertices& t1_vertices,
+                const geode::PolygonVertices& t2_vertices,
+                absl::Span< const std::array< geode::index_t, 2 > >
+                    common_vertices )
+        {
+            absl::InlinedVector< geode::internal::SharedTriangleVertex, 3 >
+                shared_vertices;
+            for( const auto& common_vertex : common_vertices )
+            {
+                geode::internal::SharedTriangleVertex shared_vertex{
+                    geode::NO_LID, geode::NO_LID
+                };
+                for( const auto v : geode::LRange{ 3 } )
+                {
+                    if( t1_vertices[v] == common_vertex[0] )
+                    {
+                        shared_vertex[0] = v;
+                    }
+                    if( t2_vertices[v] == common_vertex[1] )
+                    {
+                        shared_vertex[1] = v;
+                    }
+                }
+                shared_vertices.push_back( shared_vertex );
+            }
+            return shared_vertices;
+        }
+
+        [[nodiscard]] static geode::internal::TrianglePoints< Model::dim >
+            triangle_points( const geode::SurfaceMesh< Model::dim >& mesh,
+                const geode::PolygonVertices& triangle_vertices )
+        {
+            return { &mesh.point( triangle_vertices[0] ),
+                &mesh.point( triangle_vertices[1] ),
+                &mesh.point( triangle_vertices[2] ) };
+        }
+
         [[nodiscard]] bool triangles_intersect(
             const geode::PolygonVertices& t1_vertices,
             const geode::PolygonVertices& t2_vertices,
             absl::Span< const std::array< geode::index_t, 2 > >
                 common_vertices ) const;
 
-        void emplace( geode::index_t p1_id, geode::index_t p2_id )
-        {
-            intersecting_polygons_.emplace_back( p1_id, p2_id );
-        }
-
         [[nodiscard]] const geode::SurfaceMesh< Model::dim >& mesh1() const
         {
             return mesh1_;
@@ -280,12 +639,18 @@ namespace
         }
 
     private:
-        const Model& model_;
         bool same_surface_;
+        bool stop_at_first_intersection_;
+        std::atomic< bool >& stop_flag_;
         const geode::Surface< Model::dim >& surface1_;
         const geode::Surface< Model::dim >& surface2_;
         const geode::SurfaceMesh< Model::dim >& mesh1_;
         const geode::SurfaceMesh< Model::dim >& mesh2_;
+        absl::Span< const geode::index_t > unique_vertices1_;
+        absl::Span< const geode::index_t > unique_vertices2_;
+        std::vector< std::pair< geode::index_t, geode::index_t > > candidates_;
+        geode::internal::TrianglePairsFilter< Model::dim > filter_;
+        std::vector< TrianglePair > triangle_pairs_;
         std::vector< std::pair< geode::index_t, geode::index_t > >
             intersecting_polygons_;
     };
@@ -296,10 +661,16 @@ namespace
     {
     public:
         OneModelSurfacesIntersection( const Model& model,
+            const geode::internal::ModelUniqueVertices& unique_vertices,
             const geode::uuid& surface_id1,
-            const geode::uuid& surface_id2 )
-            : ModelSurfacesIntersectionBase< Model >(
-                  model, surface_id1, surface_id2 ),
+            const geode::uuid& surface_id2,
+            std::atomic< bool >& stop_flag )
+            : ModelSurfacesIntersectionBase< Model >( model,
+                  unique_vertices,
+                  surface_id1,
+                  surface_id2,
+                  stop_flag,
+                  true ),
               same_surface_{ surface_id1 == surface_id2 }
         {
         }
@@ -310,12 +681,7 @@ namespace
             {
                 return false;
             }
-            if( this->polygons_intersect( p1_id, p2_id ) )
-            {
-                this->emplace( p1_id, p2_id );
-                return true;
-            }
-            return false;
+            return this->add_candidate( p1_id, p2_id );
         }
 
     private:
@@ -328,10 +694,16 @@ namespace
     {
     public:
         AllModelSurfacesIntersection( const Model& model,
+            const geode::internal::ModelUniqueVertices& unique_vertices,
             const geode::uuid& surface_id1,
-            const geode::uuid& surface_id2 )
-            : ModelSurfacesIntersectionBase< Model >(
-                  model, surface_id1, surface_id2 ),
+            const geode::uuid& surface_id2,
+            std::atomic< bool >& stop_flag )
+            : ModelSurfacesIntersectionBase< Model >( model,
+                  unique_vertices,
+                  surface_id1,
+                  surface_id2,
+                  stop_flag,
+                  false ),
               same_surface_{ surface_id1 == surface_id2 }
         {
         }
@@ -342,10 +714,7 @@ namespace
             {
                 return false;
             }
-            if( this->polygons_intersect( p1_id, p2_id ) )
-            {
-                this->emplace( p1_id, p2_id );
-            }
+            this->add_candidate( p1_id, p2_id );
             return false;
         }
 
@@ -359,10 +728,16 @@ namespace
     {
     public:
         AllModelSurfacesAutoIntersection( const Model& model,
+            const geode::internal::ModelUniqueVertices& unique_vertices,
             const geode::uuid& surface_id1,
-            const geode::uuid& surface_id2 )
-            : ModelSurfacesIntersectionBase< Model >(
-                  model, surface_id1, surface_id2 ),
+            const geode::uuid& surface_id2,
+            std::atomic< bool >& stop_flag )
+            : ModelSurfacesIntersectionBase< Model >( model,
+                  unique_vertices,
+                  surface_id1,
+                  surface_id2,
+                  stop_flag,
+                  false ),
               same_surface_{ surface_id1 == surface_id2 }
         {
         }
@@ -371,16 +746,13 @@ namespace
         {
             if( !same_surface_ )
             {
-                return false;
+                return true;
             }
-            if( same_surface_ && p1_id == p2_id )
+            if( p1_id == p2_id )
             {
                 return false;
             }
-            if( this->polygons_intersect( p1_id, p2_id ) )
-            {
-                this->emplace( p1_id, p2_id );
-            }
+            this->add_candidate( p1_id, p2_id );
             return false;
         }
 
@@ -562,6 +934,152 @@ namespace
                || triangle_intersects_other( triangle2, triangle1, t2_vertices,
                    t1_vertices, common_vertices, 0 );
     }
+
+    /*!
+     * Number of polygons of the first surface of a pair handled by one
+     * near-miss task.
+     */
+    constexpr geode::index_t NEAR_MISS_CHUNK_SIZE{ 4'096 };
+
+    struct PolygonsNearMiss
+    {
+        geode::ComponentMeshElement polygon1;
+        geode::ComponentMeshElement polygon2;
+        double distance;
+    };
+
+    template < geode::index_t dimension >
+    [[nodiscard]] geode::BoundingBox< dimension > polygon_bounding_box(
+        const geode::SurfaceMesh< dimension >& mesh, geode::index_t polygon )
+    {
+        geode::BoundingBox< dimension > box;
+        for( const auto vertex : mesh.polygon_vertices( polygon ) )
+        {
+            box.add_point( mesh.point( vertex ) );
+        }
+        return box;
+    }
+
+    /*!
+     * Polygons whose bounding boxes intersect an expanded query box. Their
+     * bounds are stored axis by axis so that the lower bounds of their
+     * distances to the query polygon are computed in vectorizable loops,
+     * before any exact distance computation.
+     */
+    template < geode::index_t dimension >
+    class NearMissCandidates
+    {
+    public:
+        bool operator()( geode::index_t polygon )
+        {
+            polygons_.push_back( polygon );
+            return false;
+        }
+
+        void clear()
+        {
+            polygons_.clear();
+        }
+
+        /*!
+         * Keeps, in increasing order, the candidates whose bounding box is
+         * not farther than tolerance from the given box.
+         */
+        void filter_by_box_distance(
+            const geode::SurfaceMesh< dimension >& mesh,
+            const geode::BoundingBox< dimension >& box,
+            double tolerance )
+        {
+            const auto nb_candidates = polygons_.size();
+            for( const auto axis : geode::LRange{ dimension } )
+            {
+                lower_[axis].resize( nb_candidates );
+                upper_[axis].resize( nb_candidates );
+            }
+            for( const auto candidate : geode::Indices{ polygons_ } )
+            {
+                const auto candidate_box =
+                    polygon_bounding_box( mesh, polygons_[candidate] );
+                for( const auto axis : geode::LRange{ dimension } )
+                {
+                    lower_[axis][candidate] = candidate_box.min().value( axis );
+                    upper_[axis][candidate] = candidate_box.max().value( axis );
+                }
+            }
+            squared_distances_.assign( nb_candidates, 0. );
+            for( const auto axis : geode::LRange{ dimension } )
+            {
+                const auto box_lower = box.min().value( axis );
+                const auto box_upper = box.max().value( axis );
+                const auto* lower = lower_[axis].data();
+                const auto* upper = upper_[axis].data();
+                auto* squared_distances = squared_distances_.data();
+                for( std::size_t candidate = 0; candidate < nb_candidates;
+                    candidate++ )
+                {
+                    const auto gap =
+                        std::max( { 0., lower[candidate] - box_upper,
+                            box_lower - upper[candidate] } );
+                    squared_distances[candidate] += gap * gap;
+                }
+            }
+            const auto squared_tolerance = tolerance * tolerance;
+            std::size_t nb_kept{ 0 };
+            for( const auto candidate : geode::Indices{ polygons_ } )
+            {
+                if( squared_distances_[candidate] <= squared_tolerance )
+                {
+                    polygons_[nb_kept++] = polygons_[candidate];
+                }
+            }
+            polygons_.resize( nb_kept );
+            absl::c_sort( polygons_ );
+        }
+
+        [[nodiscard]] absl::Span< const geode::index_t > polygons() const
+        {
+            return polygons_;
+        }
+
+    private:
+        std::vector< geode::index_t > polygons_;
+        std::array< std::vector< double >, dimension > lower_;
+        std::array< std::vector< double >, dimension > upper_;
+        std::vector< double > squared_distances_;
+    };
+
+    [[nodiscard]] double triangles_distance(
+        const geode::Triangle3D& triangle1, const geode::Triangle3D& triangle2 )
+    {
+        return std::get< 0 >(
+            geode::triangle_triangle_distance( triangle1, triangle2 ) );
+    }
+
+    /*!
+     * In 2D, the gap between two triangles is measured between their edges,
+     * overlapping triangles being reported by the intersections inspection.
+     */
+    [[nodiscard]] double triangles_distance(
+        const geode::Triangle2D& triangle1, const geode::Triangle2D& triangle2 )
+    {
+        const auto& vertices1 = triangle1.vertices();
+        const auto& vertices2 = triangle2.vertices();
+        auto distance = std::numeric_limits< double >::max();
+        for( const auto e1 : geode::LRange{ 3 } )
+        {
+            const geode::Segment2D edge1{ vertices1[e1].get(),
+                vertices1[( e1 + 1 ) % 3].get() };
+            for( const auto e2 : geode::LRange{ 3 } )
+            {
+                const geode::Segment2D edge2{ vertices2[e2].get(),
+                    vertices2[( e2 + 1 ) % 3].get() };
+                distance = std::min( distance,
+                    std::get< 0 >(
+                        geode::segment_segment_distance( edge1, edge2 ) ) );
+            }
+        }
+        return distance;
+    }
 } // namespace
 
 namespace geode
@@ -591,19 +1109,35 @@ namespace geode
         {
         }
 
-        [[nodiscard]] bool model_has_intersecting_surfaces() const
+        /*!
+         * Surfaces unique vertices used when no snapshot is given by the
+         * caller, built on first use.
+         */
+        [[nodiscard]] const internal::ModelUniqueVertices&
+            surfaces_unique_vertices() const
+        {
+            std::call_once( unique_vertices_flag_, [this] {
+                unique_vertices_.emplace( model_,
+                    absl::MakeConstSpan( SURFACE_KIND ) );
+            } );
+            return unique_vertices_.value();
+        }
+
+        [[nodiscard]] bool model_has_intersecting_surfaces(
+            const internal::ModelUniqueVertices& unique_vertices ) const
         {
             const auto intersections = intersecting_polygons<
-                OneModelSurfacesIntersection< Model > >();
+                OneModelSurfacesIntersection< Model > >( unique_vertices );
             return !intersections.empty();
         }
 
         void add_intersecting_surfaces_elements(
+            const internal::ModelUniqueVertices& unique_vertices,
             InspectionIssues< std::pair< ComponentMeshElement,
                 ComponentMeshElement > >& intersection_issues ) const
         {
             const auto intersections = intersecting_polygons<
-                AllModelSurfacesIntersection< Model > >();
+                AllModelSurfacesIntersection< Model > >( unique_vertices );
             for( const auto& polygon_pair : intersections )
             {
                 const auto& surface1 =
@@ -623,12 +1157,40 @@ namespace geode
             }
         }
 
+        void add_surfaces_near_misses_elements(
+            const internal::ModelUniqueVertices& unique_vertices,
+            double tolerance,
+            InspectionIssues< std::pair< ComponentMeshElement,
+                ComponentMeshElement > >& near_miss_issues ) const
+        {
+            for( const auto& near_miss :
+                near_miss_polygons( unique_vertices, tolerance ) )
+            {
+                const auto& surface1 =
+                    model_.surface( near_miss.polygon1.component_id.id() );
+                const auto& surface2 =
+                    model_.surface( near_miss.polygon2.component_id.id() );
+                near_miss_issues.add_issue(
+                    std::make_pair( near_miss.polygon1, near_miss.polygon2 ),
+                    absl::StrCat( "Surfaces ",
+                        surface1.name().value_or( surface1.id().string() ),
+                        " (", surface1.id().string(), ") and ",
+                        surface2.name().value_or( surface2.id().string() ),
+                        " (", surface2.id().string(),
+                        ") are closer than ", tolerance, " on polygons ",
+                        near_miss.polygon1.element_id, " and ",
+                        near_miss.polygon2.element_id, " (distance ",
+                        near_miss.distance, ")" ) );
+            }
+        }
+
         void add_surface_auto_intersecting_elements(
+            const internal::ModelUniqueVertices& unique_vertices,
             InspectionIssues< std::pair< ComponentMeshElement,
                 ComponentMeshElement > >& intersection_issues ) const
         {
             const auto intersections = intersecting_polygons<
-                AllModelSurfacesAutoIntersection< Model > >();
+                AllModelSurfacesAutoIntersection< Model > >( unique_vertices );
             for( const auto& polygon_pair : intersections )
             {
                 const auto& surface =
@@ -675,12 +1237,207 @@ namespace geode
         using IntersectionResult =
             std::pair< ComponentMeshElement, ComponentMeshElement >;
         using IntersectionsResult = std::vector< IntersectionResult >;
+        using Task = async::task< IntersectionsResult >;
+
+        /*!
+         * Slabs of the large surfaces, built on the first traversal so that
+         * inspections without surface traversal do not pay for them.
+         */
+        [[nodiscard]] const absl::flat_hash_map< uuid,
+            SurfaceSlabs< Model::dim > >&
+            surface_slabs() const
+        {
+            std::call_once( surface_slabs_flag_, [this] {
+                build_surface_slabs();
+            } );
+            return surface_slabs_;
+        }
+
+        void build_surface_slabs() const
+        {
+            index_t nb_polygons{ 0 };
+            for( const auto& surface : model_.active_surfaces() )
+            {
+                nb_polygons += surface.mesh().nb_polygons();
+            }
+            const auto part_size = std::max( MIN_SURFACE_PART_SIZE,
+                nb_polygons
+                    / ( nb_worker_threads() * SURFACE_PARTS_PER_THREAD ) );
+            for( const auto& surface : model_.active_surfaces() )
+            {
+                const auto& mesh = surface.mesh();
+                if( mesh.nb_polygons() > part_size )
+                {
+                    surface_slabs_.try_emplace( surface.id(), mesh,
+                        ( mesh.nb_polygons() + part_size - 1 ) / part_size );
+                }
+            }
+        }
+
+        [[nodiscard]] std::vector< SurfacePart< Model::dim > > surface_parts(
+            const uuid& surface_id ) const
+        {
+            const auto& surface_slabs = this->surface_slabs();
+            const auto slabs = surface_slabs.find( surface_id );
+            if( slabs != surface_slabs.end() )
+            {
+                return slabs->second.parts();
+            }
+            const auto tree_id =
+                surfaces_model_tree_.mesh_tree_ids_.at( surface_id );
+            return { { surfaces_model_tree_.mesh_trees_[tree_id], {} } };
+        }
+
+        template < typename Action >
+        [[nodiscard]] IntersectionsResult parts_intersections(
+            const internal::ModelUniqueVertices& unique_vertices,
+            const PartsIntersectionJob< Model::dim >& job,
+            std::atomic< bool >& stop_flag ) const
+        {
+            Action surfaces_intersection_action{ model_, unique_vertices,
+                job.surface_id1, job.surface_id2, stop_flag };
+            SurfacePartsAction< Action, Model::dim > parts_action{
+                surfaces_intersection_action, job.part1, job.part2
+            };
+            if( job.self_traversal )
+            {
+                job.part1.tree.compute_self_element_bbox_intersections(
+                    parts_action );
+            }
+            else
+            {
+                job.part1.tree.compute_other_element_bbox_intersections(
+                    job.part2.tree, parts_action );
+            }
+            IntersectionsResult result;
+            const auto component_id1 =
+                model_.surface( job.surface_id1 ).component_id();
+            const auto component_id2 =
+                model_.surface( job.surface_id2 ).component_id();
+            for( const auto& [polygon1, polygon2] :
+                surfaces_intersection_action.intersecting_polygons() )
+            {
+                result.emplace_back(
+                    ComponentMeshElement{ component_id1, polygon1 },
+                    ComponentMeshElement{ component_id2, polygon2 } );
+            }
+            return result;
+        }
+
+        /*!
+         * Adds one job per pair of surface parts whose bounding boxes
+         * overlap, so that large surfaces are traversed by several threads.
+         */
+        void add_surfaces_intersection_jobs( const uuid& surface_id1,
+            const uuid& surface_id2,
+            std::vector< PartsIntersectionJob< Model::dim > >& jobs ) const
+        {
+            const auto parts1 = surface_parts( surface_id1 );
+            if( surface_id1 == surface_id2 )
+            {
+                for( const auto part : Indices{ parts1 } )
+                {
+                    jobs.push_back( { surface_id1, surface_id2, parts1[part],
+                        parts1[part], true } );
+                    for( const auto other : Range{ part + 1,
+                             static_cast< index_t >( parts1.size() ) } )
+                    {
+                        if( parts1[part].tree.bounding_box().intersects(
+                                parts1[other].tree.bounding_box() ) )
+                        {
+                            jobs.push_back( { surface_id1, surface_id2,
+                                parts1[part], parts1[other], false } );
+                        }
+                    }
+                }
+                return;
+            }
+            const auto parts2 = surface_parts( surface_id2 );
+            for( const auto& part1 : parts1 )
+            {
+                for( const auto& part2 : parts2 )
+                {
+                    if( part1.tree.bounding_box().intersects(
+                            part2.tree.bounding_box() ) )
+                    {
+                        jobs.push_back(
+                            { surface_id1, surface_id2, part1, part2, false } );
+                    }
+                }
+            }
+        }
+
+        /*!
+         * Runs the jobs in tasks of similar estimated costs: consecutive
+         * cheap jobs are grouped in the same task while expensive jobs get
+         * their own task. Results are returned in jobs order.
+         * Once the stop flag is raised by an action, the jobs that have not
+         * started yet are skipped.
+         */
+        template < typename Action >
+        [[nodiscard]] IntersectionsResult run_intersection_jobs(
+            const internal::ModelUniqueVertices& unique_vertices,
+            absl::Span< const PartsIntersectionJob< Model::dim > > jobs ) const
+        {
+            std::atomic< bool > stop_flag{ false };
+            std::uint64_t total_cost{ 0 };
+            for( const auto& job : jobs )
+            {
+                total_cost += job.estimated_cost();
+            }
+            const auto task_cost = std::max( MIN_TASK_COST,
+                total_cost / ( nb_worker_threads() * TASKS_PER_THREAD ) );
+            std::vector< Task > tasks;
+            const auto spawn_jobs = [this, &unique_vertices, &jobs, &tasks,
+                                        &stop_flag](
+                                        index_t begin, index_t end ) {
+                tasks.emplace_back( async::spawn(
+                    [this, &unique_vertices, &jobs, &stop_flag, begin, end] {
+                        IntersectionsResult result;
+                        for( const auto job : Range{ begin, end } )
+                        {
+                            if( stop_flag.load( std::memory_order_relaxed ) )
+                            {
+                                break;
+                            }
+                            absl::c_move(
+                                parts_intersections< Action >(
+                                    unique_vertices, jobs[job], stop_flag ),
+                                std::back_inserter( result ) );
+                        }
+                        return result;
+                    } ) );
+            };
+            index_t begin{ 0 };
+            std::uint64_t cost{ 0 };
+            for( const auto job : Indices{ jobs } )
+            {
+                cost += jobs[job].estimated_cost();
+                if( cost >= task_cost )
+                {
+                    spawn_jobs( begin, job + 1 );
+                    begin = job + 1;
+                    cost = 0;
+                }
+            }
+            if( begin < jobs.size() )
+            {
+                spawn_jobs( begin, jobs.size() );
+            }
+            IntersectionsResult intersections;
+            for( auto& task : async::when_all( tasks ).get() )
+            {
+                absl::c_move( task.get(), std::back_inserter( intersections ) );
+            }
+            return intersections;
+        }
+
         template < typename Action >
         [[nodiscard]] std::vector<
             std::pair< ComponentMeshElement, ComponentMeshElement > >
-            intersecting_polygons() const
+            intersecting_polygons(
+                const internal::ModelUniqueVertices& unique_vertices ) const
         {
-            IntersectionsResult component_intersections;
             for( const auto& surface : model_.active_surfaces() )
             {
                 if( surface.mesh().nb_polygons() == 0 )
@@ -690,129 +1447,288 @@ namespace geode
                         "compute the AABBTree used for detecting the mesh "
                         "intersections, no intersections will be "
                         "computed." );
-                    return component_intersections;
+                    return {};
                 }
             }
-            using Task = async::task< IntersectionsResult >;
-            std::vector< Task > tasks;
+            std::vector< PartsIntersectionJob< Model::dim > > jobs;
             for( const auto& surface : model_.active_surfaces() )
             {
-                tasks.emplace_back( async::spawn( [this, &surface] {
-                    Action surfaces_intersection_action{ model_, surface.id(),
-                        surface.id() };
-                    surfaces_model_tree_
-                        .mesh_trees_[surfaces_model_tree_.mesh_tree_ids_.at(
-                            surface.id() )]
-                        .compute_self_element_bbox_intersections(
-                            surfaces_intersection_action );
-                    IntersectionsResult result;
-                    const auto surface_id = surface.component_id();
-                    for( const auto& [polygon1, polygon2] :
-                        surfaces_intersection_action.intersecting_polygons() )
-                    {
-                        result.emplace_back(
-                            ComponentMeshElement{ surface_id, polygon1 },
-                            ComponentMeshElement{ surface_id, polygon2 } );
-                    }
-                    return result;
-                } ) );
+                add_surfaces_intersection_jobs(
+                    surface.id(), surface.id(), jobs );
             }
             ComponentOverlap surfaces_overlap;
             surfaces_model_tree_.components_tree_
                 .compute_self_element_bbox_intersections( surfaces_overlap );
+            absl::c_sort( surfaces_overlap.component_pairs );
             for( const auto& components : surfaces_overlap.component_pairs )
             {
-                tasks.emplace_back( async::spawn( [this, &components] {
-                    const auto surface_uuid1 =
-                        surfaces_model_tree_.uuids_[components.first];
-                    const auto surface_uuid2 =
-                        surfaces_model_tree_.uuids_[components.second];
-                    Action surfaces_intersection_action{ model_, surface_uuid1,
-                        surface_uuid2 };
-                    surfaces_model_tree_.mesh_trees_[components.first]
-                        .compute_other_element_bbox_intersections(
-                            surfaces_model_tree_.mesh_trees_[components.second],
-                            surfaces_intersection_action );
-                    IntersectionsResult result;
-                    const auto component_id1 =
-                        model_.surface( surface_uuid1 ).component_id();
-                    const auto component_id2 =
-                        model_.surface( surface_uuid2 ).component_id();
-                    for( const auto& [polygon1, polygon2] :
-                        surfaces_intersection_action.intersecting_polygons() )
+                add_surfaces_intersection_jobs(
+                    surfaces_model_tree_.uuids_[components.first],
+                    surfaces_model_tree_.uuids_[components.second], jobs );
+            }
+            return run_intersection_jobs< Action >( unique_vertices, jobs );
+        }
+
+        [[nodiscard]] bool is_near_miss_inspected(
+            const uuid& surface_id ) const
+        {
+            const auto& surface = model_.surface( surface_id );
+            return surface.is_active() && surface.mesh().nb_polygons() != 0;
+        }
+
+        /*!
+         * Pairs of distinct surfaces whose bounding boxes are closer than
+         * tolerance, given as indices in the surfaces model tree.
+         */
+        [[nodiscard]] std::vector< std::pair< index_t, index_t > >
+            near_miss_surface_pairs( double tolerance ) const
+        {
+            const auto& tree = surfaces_model_tree_;
+            std::vector< std::pair< index_t, index_t > > surface_pairs;
+            for( const auto surface_tree_id : Indices{ tree.uuids_ } )
+            {
+                if( !is_near_miss_inspected( tree.uuids_[surface_tree_id] ) )
+                {
+                    continue;
+                }
+                auto box = tree.mesh_trees_[surface_tree_id].bounding_box();
+                box.extends( tolerance );
+                auto add_pair = [this, &tree, &surface_pairs, surface_tree_id](
+                                    index_t other_tree_id ) {
+                    if( other_tree_id > surface_tree_id
+                        && is_near_miss_inspected(
+                            tree.uuids_[other_tree_id] ) )
                     {
-                        result.emplace_back(
-                            ComponentMeshElement{ component_id1, polygon1 },
-                            ComponentMeshElement{ component_id2, polygon2 } );
+                        surface_pairs.emplace_back(
+                            surface_tree_id, other_tree_id );
                     }
-                    return result;
-                } ) );
+                    return false;
+                };
+                tree.components_tree_.compute_bbox_element_bbox_intersections(
+                    box, add_pair );
             }
-            for( auto& task : async::when_all( tasks ).get() )
+            absl::c_sort( surface_pairs );
+            return surface_pairs;
+        }
+
+        /*!
+         * Each polygon of the first surface of a pair is expanded by
+         * tolerance and queried in the AABB tree of the second surface.
+         * The candidates are filtered by the distance between bounding boxes
+         * and by shared unique vertices before computing exact distances.
+         * Surface pairs are split into chunks of polygons run in parallel.
+         */
+        [[nodiscard]] std::vector< PolygonsNearMiss > near_miss_polygons(
+            const internal::ModelUniqueVertices& unique_vertices,
+            double tolerance ) const
+        {
+            OpenGeodeInspectorInspectionException::test( tolerance > 0,
+                "[ModelMeshesIntersections] Near misses tolerance should be "
+                "strictly positive" );
+            const auto& tree = surfaces_model_tree_;
+            const auto surface_pairs = near_miss_surface_pairs( tolerance );
+            std::vector< std::pair< index_t, index_t > > jobs;
+            for( const auto pair_id : Indices{ surface_pairs } )
+            {
+                const auto nb_polygons =
+                    model_.surface( tree.uuids_[surface_pairs[pair_id].first] )
+                        .mesh()
+                        .nb_polygons();
+                for( index_t begin = 0; begin < nb_polygons;
+                    begin += NEAR_MISS_CHUNK_SIZE )
+                {
+                    jobs.emplace_back( pair_id, begin );
+                }
+            }
+            std::vector< std::vector< PolygonsNearMiss > > jobs_near_misses(
+                jobs.size() );
+            async::parallel_for(
+                async::irange(
+                    index_t{ 0 }, static_cast< index_t >( jobs.size() ) ),
+                [this, &unique_vertices, &tree, &surface_pairs, &jobs,
+                    &jobs_near_misses, tolerance]( index_t job ) {
+                    const auto [pair_id, begin] = jobs[job];
+                    const auto [tree_id1, tree_id2] = surface_pairs[pair_id];
+                    const auto& surface1 =
+                        model_.surface( tree.uuids_[tree_id1] );
+                    const auto& surface2 =
+                        model_.surface( tree.uuids_[tree_id2] );
+                    const auto& mesh1 = surface1.mesh();
+                    const auto& mesh2 = surface2.mesh();
+                    const auto unique_vertices1 =
+                        unique_vertices.component_unique_vertices(
+                            unique_vertices.component_index( surface1.id() ) );
+                    const auto unique_vertices2 =
+                        unique_vertices.component_unique_vertices(
+                            unique_vertices.component_index( surface2.id() ) );
+                    const auto end = std::min(
+                        begin + NEAR_MISS_CHUNK_SIZE, mesh1.nb_polygons() );
+                    NearMissCandidates< Model::dim > candidates;
+                    auto& near_misses = jobs_near_misses[job];
+                    for( const auto polygon1 : Range{ begin, end } )
+                    {
+                        if( mesh1.nb_polygon_vertices( polygon1 ) != 3 )
+                        {
+                            continue;
+                        }
+                        const auto box =
+                            polygon_bounding_box( mesh1, polygon1 );
+                        auto query = box;
+                        query.extends( tolerance );
+                        candidates.clear();
+                        tree.mesh_trees_[tree_id2]
+                            .compute_bbox_element_bbox_intersections(
+                                query, candidates );
+                        candidates.filter_by_box_distance(
+                            mesh2, box, tolerance );
+                        const auto vertices1 =
+                            mesh1.polygon_vertices( polygon1 );
+                        const Triangle< Model::dim > triangle1{
+                            mesh1.point( vertices1[0] ),
+                            mesh1.point( vertices1[1] ),
+                            mesh1.point( vertices1[2] )
+                        };
+                        for( const auto polygon2 : candidates.polygons() )
+                        {
+                            if( mesh2.nb_polygon_vertices( polygon2 ) != 3 )
+                            {
+                                continue;
+                            }
+                            const auto vertices2 =
+                                mesh2.polygon_vertices( polygon2 );
+                            if( polygons_share_unique_vertex( vertices1,
+                                    unique_vertices1, vertices2,
+                                    unique_vertices2 ) )
+                            {
+                                continue;
+                            }
+                            const Triangle< Model::dim > triangle2{
+                                mesh2.point( vertices2[0] ),
+                                mesh2.point( vertices2[1] ),
+                                mesh2.point( vertices2[2] )
+                            };
+                            const auto distance =
+                                triangles_distance( triangle1, triangle2 );
+                            if( distance > 0 && distance < tolerance )
+                            {
+                                near_misses.push_back(
+                                    { { surface1.component_id(), polygon1 },
+                                        { surface2.component_id(), polygon2 },
+                                        distance } );
+                            }
+                        }
+                    }
+                } );
+            std::vector< PolygonsNearMiss > near_misses;
+            for( auto& job_near_misses : jobs_near_misses )
             {
                 absl::c_move(
-                    task.get(), std::back_inserter( component_intersections ) );
+                    job_near_misses, std::back_inserter( near_misses ) );
             }
-            return component_intersections;
+            return near_misses;
         }
 
-        [[nodiscard]] std::vector<
-            std::pair< ComponentMeshElement, ComponentMeshElement > >
-            intersecting_lines_surfaces( const BRep& brep ) const
+        [[nodiscard]] static bool polygons_share_unique_vertex(
+            const PolygonVertices& vertices1,
+            absl::Span< const index_t > unique_vertices1,
+            const PolygonVertices& vertices2,
+            absl::Span< const index_t > unique_vertices2 )
         {
-            std::vector<
-                std::pair< ComponentMeshElement, ComponentMeshElement > >
-                component_intersections;
-            for( const auto& surface : brep.active_surfaces() )
+            for( const auto vertex1 : vertices1 )
             {
-                if( surface.mesh().nb_polygons() == 0 )
+                const auto unique_vertex = unique_vertices1[vertex1];
+                if( unique_vertex == NO_ID )
                 {
-                    geode::Logger::warn(
-                        "One of the surface meshes has an empty mesh, "
-                        "skipping line-surface intersection detection." );
-                    return component_intersections;
+                    continue;
                 }
-            }
-            for( const auto& line : brep.active_lines() )
-            {
-                if( line.mesh().nb_edges() == 0 )
+                for( const auto vertex2 : vertices2 )
                 {
-                    geode::Logger::warn(
-                        "One of the line meshes has an empty mesh, "
-                        "skipping line-surface intersection detection." );
-                    return component_intersections;
+                    if( unique_vertex == unique_vertices2[vertex2] )
+                    {
+                        return true;
+                    }
                 }
             }
-            const auto lines_model_tree =
-                create_line_meshes_aabb_trees( model_ );
-            for( const auto& surface : brep.active_surfaces() )
+            return false;
+        }
+
+        [[nodiscard]] const ModelMeshesAABBTree< Model::dim >&
+            lines_model_tree() const
+        {
+            std::call_once( lines_model_tree_flag_, [this] {
+                lines_model_tree_ = create_line_meshes_aabb_trees( model_ );
+            } );
+            return lines_model_tree_;
+        }
+
+        /*!
+         * Candidate surface-line pairs come from the overlaps of the
+         * component bounding boxes, each pair being then traversed in
+         * parallel. Empty or inactive components and lines that are not
+         * embedded in a block are skipped.
+         */
+        [[nodiscard]] std::vector<
+            std::pair< ComponentMeshElement, ComponentMeshElement > >
+            intersecting_lines_surfaces( const BRep& brep ) const
+        {
+            const auto& lines_tree = lines_model_tree();
+            ComponentOverlap surfaces_lines_overlap;
+            surfaces_model_tree_.components_tree_
+                .compute_other_element_bbox_intersections(
+                    lines_tree.components_tree_, surfaces_lines_overlap );
+            std::vector< std::pair< index_t, index_t > > candidates;
+            candidates.reserve( surfaces_lines_overlap.component_pairs.size() );
+            for( const auto& [surface_tree_id, line_tree_id] :
+                surfaces_lines_overlap.component_pairs )
             {
-                const auto& surface_tree =
-                    surfaces_model_tree_.mesh_trees_[surfaces_model_tree_
-                            .mesh_tree_ids_.at( surface.id() )];
-                for( const auto& line : brep.active_lines() )
+                const auto& surface = brep.surface(
+                    surfaces_model_tree_.uuids_[surface_tree_id] );
+                const auto& line =
+                    brep.line( lines_tree.uuids_[line_tree_id] );
+                if( !surface.is_active() || !line.is_active()
+                    || surface.mesh().nb_polygons() == 0
+                    || line.mesh().nb_edges() == 0
+                    || brep.nb_embedding_blocks( line ) == 0 )
                 {
-                    if( brep.nb_embedding_blocks( line ) == 0 )
-                    {
-                        continue;
-                    }
+                    continue;
+                }
+                candidates.emplace_back( surface_tree_id, line_tree_id );
+            }
+            absl::c_sort( candidates );
+            std::vector< IntersectionsResult > candidates_intersections(
+                candidates.size() );
+            async::parallel_for(
+                async::irange(
+                    index_t{ 0 }, static_cast< index_t >( candidates.size() ) ),
+                [this, &brep, &lines_tree, &candidates,
+                    &candidates_intersections]( index_t candidate ) {
+                    const auto [surface_tree_id, line_tree_id] =
+                        candidates[candidate];
+                    const auto& surface = brep.surface(
+                        surfaces_model_tree_.uuids_[surface_tree_id] );
+                    const auto& line =
+                        brep.line( lines_tree.uuids_[line_tree_id] );
                     BRepLineSurfacesIntersection action{ brep, surface.id(),
                         line.id() };
-                    const auto& line_tree =
-                        lines_model_tree.mesh_trees_[lines_model_tree
-                                .mesh_tree_ids_.at( line.id() )];
-                    surface_tree.compute_other_element_bbox_intersections(
-                        line_tree, action );
+                    surfaces_model_tree_.mesh_trees_[surface_tree_id]
+                        .compute_other_element_bbox_intersections(
+                            lines_tree.mesh_trees_[line_tree_id], action );
+                    auto& result = candidates_intersections[candidate];
                     for( const auto& element_pair :
                         action.intersecting_elements() )
                     {
-                        component_intersections.emplace_back(
+                        result.emplace_back(
                             ComponentMeshElement{
                                 surface.component_id(), element_pair.first },
                             ComponentMeshElement{
                                 line.component_id(), element_pair.second } );
                     }
-                }
+                } );
+            IntersectionsResult component_intersections;
+            for( auto& intersections : candidates_intersections )
+            {
+                absl::c_move( intersections,
+                    std::back_inserter( component_intersections ) );
             }
             return component_intersections;
         }
@@ -820,6 +1736,13 @@ namespace geode
     private:
         const Model& model_;
         ModelMeshesAABBTree< Model::dim > surfaces_model_tree_;
+        mutable std::once_flag unique_vertices_flag_;
+        mutable std::optional< internal::ModelUniqueVertices > unique_vertices_;
+        mutable std::once_flag surface_slabs_flag_;
+        mutable absl::flat_hash_map< uuid, SurfaceSlabs< Model::dim > >
+            surface_slabs_;
+        mutable std::once_flag lines_model_tree_flag_;
+        mutable ModelMeshesAABBTree< Model::dim > lines_model_tree_;
     };
 
     template < typename Model >
@@ -836,21 +1759,44 @@ namespace geode
     bool ModelMeshesIntersections< Model >::model_has_intersecting_surfaces()
         const
     {
-        return impl_->model_has_intersecting_surfaces();
+        return impl_->model_has_intersecting_surfaces(
+            impl_->surfaces_unique_vertices() );
     }
 
     template < typename Model >
     ElementsIntersectionsInspectionResult
         ModelMeshesIntersections< Model >::inspect_intersections() const
+    {
+        return inspect_intersections( impl_->surfaces_unique_vertices() );
+    }
+
+    template < typename Model >
+    ElementsIntersectionsInspectionResult
+        ModelMeshesIntersections< Model >::inspect_intersections(
+            const internal::ModelUniqueVertices& unique_vertices ) const
     {
         ElementsIntersectionsInspectionResult results;
         impl_->add_intersecting_surfaces_elements(
-            results.elements_intersections );
+            unique_vertices, results.elements_intersections );
         impl_->add_intersecting_lines_surfaces_elements(
             results.elements_intersections );
         return results;
     }
 
+    template < typename Model >
+    ElementsIntersectionsInspectionResult
+        ModelMeshesIntersections< Model >::inspect_surfaces_near_misses(
+            double tolerance ) const
+    {
+        ElementsIntersectionsInspectionResult results;
+        results.elements_intersections.set_description(
+            "surfaces near misses" );
+        impl_->add_surfaces_near_misses_elements(
+            impl_->surfaces_unique_vertices(), tolerance,
+            results.elements_intersections );
+        return results;
+    }
+
     template < typename Model >
     ElementsIntersectionsInspectionResult
         ModelMeshesIntersections< Model >::inspect_surfaces_self_intersections()
@@ -858,7 +1804,7 @@ namespace geode
     {
         ElementsIntersectionsInspectionResult results;
         impl_->add_surface_auto_intersecting_elements(
-            results.elements_intersections );
+            impl_->surfaces_unique_vertices(), results.elements_intersections );
         return results;
     }
 
@@ -0,0 +1,861 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/inspector/inspection/criterion/intersections/model_lines_intersections.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <tuple>
+
+#include <async++.h>
+
+#include <absl/algorithm/container.h>
+
+#include <geode/basic/logger.hpp>
+#include <geode/basic/pimpl_impl.hpp>
+
+#include <geode/geometry/aabb.hpp>
+#include <geode/geometry/basic_objects/segment.hpp>
+#include <geode/geometry/distance.hpp>
+#include <geode/geometry/information.hpp>
+#include <geode/geometry/intersection_detection.hpp>
+#include <geode/geometry/vector.hpp>
+
+#include <geode/mesh/core/edged_curve.hpp>
+
+#include <geode/model/helpers/aabb_model_helpers.hpp>
+#include <geode/model/mixin/core/line.hpp>
+#include <geode/model/representation/core/brep.hpp>
+#include <geode/model/representation/core/section.hpp>
+
+#include <geode/inspector/inspection/criterion/internal/model_unique_vertices.hpp>
+#include <geode/inspector/inspection/criterion/internal/per_thread_buffers.hpp>
+
+namespace
+{
+    constexpr std::array< geode::internal::ModelUniqueVertices::ComponentKind,
+        1 >
+        LINE_KIND{ geode::internal::ModelUniqueVertices::ComponentKind::line };
+
+    /* Both segments are on the same line: they overlap if their projections
+     * on the main axis of the first segment share more than one point. */
+    bool collinear_segments_overlap(
+        const geode::Segment2D& segment1, const geode::Segment2D& segment2 )
+    {
+        const auto& s1v0 = segment1.vertices()[0].get();
+        const auto& s1v1 = segment1.vertices()[1].get();
+        const auto& s2v0 = segment2.vertices()[0].get();
+        const auto& s2v1 = segment2.vertices()[1].get();
+        const geode::local_index_t axis =
+            std::fabs( s1v1.value( 1 ) - s1v0.value( 1 ) )
+                    > std::fabs( s1v1.value( 0 ) - s1v0.value( 0 ) )
+                ? 1
+                : 0;
+        const auto bounds1 =
+            std::minmax( s1v0.value( axis ), s1v1.value( axis ) );
+        const auto bounds2 =
+            std::minmax( s2v0.value( axis ), s2v1.value( axis ) );
+        return std::max( bounds1.first, bounds2.first )
+               < std::min( bounds1.second, bounds2.second );
+    }
+
+    template < geode::index_t dimension >
+    void add_line_edges_issue(
+        geode::InspectionIssues< std::pair< geode::ComponentMeshElement,
+            geode::ComponentMeshElement > >& intersection_issues,
+        const geode::Line< dimension >& line1,
+        geode::index_t edge1,
+        const geode::Line< dimension >& line2,
+        geode::index_t edge2 )
+    {
+        std::pair< geode::ComponentMeshElement, geode::ComponentMeshElement >
+            issue{ geode::ComponentMeshElement{ line1.component_id(), edge1 },
+                geode::ComponentMeshElement{ line2.component_id(), edge2 } };
+        if( line1.id() == line2.id() )
+        {
+            intersection_issues.add_issue( std::move( issue ),
+                absl::StrCat( "Line ",
+                    line1.name().value_or( line1.id().string() ), " (",
+                    line1.id().string(), ") has a self intersection on edges ",
+                    edge1, " and ", edge2 ) );
+            return;
+        }
+        intersection_issues.add_issue( std::move( issue ),
+            absl::StrCat( "Lines ",
+                line1.name().value_or( line1.id().string() ), " (",
+                line1.id().string(), ") and ",
+                line2.name().value_or( line2.id().string() ), " (",
+                line2.id().string(), ") intersect on edges ", edge1, " and ",
+                edge2 ) );
+    }
+
+    using IndexPair = std::pair< geode::index_t, geode::index_t >;
+
+    constexpr std::size_t CANDIDATES_BATCH_SIZE{ 1 << 16 };
+
+    class LineComponentsOverlap
+    {
+    public:
+        bool operator()(
+            geode::index_t first_component, geode::index_t second_component )
+        {
+            component_pairs_.emplace_back(
+                std::minmax( first_component, second_component ) );
+            return false;
+        }
+
+        [[nodiscard]] std::vector< IndexPair > component_pairs()
+        {
+            return component_pairs_.sorted_values();
+        }
+
+    private:
+        geode::internal::PerThreadBuffers< IndexPair > component_pairs_;
+    };
+
+    /*!
+     * Tests whether two edges of two lines, or of one line with itself,
+     * intersect.
+     * In 2D, edges cross or overlap according to the exact predicates, and
+     * edges sharing a unique vertex only intersect if they overlap.
+     * In 3D, edges intersect if they are closer than the tolerance. Edges
+     * sharing a unique vertex only intersect if they are aligned up to the
+     * tolerance and go in the same direction from the shared vertex.
+     */
+    template < geode::index_t dimension >
+    class LineEdgesPredicate
+    {
+    public:
+        LineEdgesPredicate( const geode::EdgedCurve< dimension >& mesh1,
+            const geode::EdgedCurve< dimension >& mesh2,
+            absl::Span< const geode::index_t > unique_vertices1,
+            absl::Span< const geode::index_t > unique_vertices2,
+            double tolerance = geode::GLOBAL_EPSILON )
+            : mesh1_( mesh1 ),
+              mesh2_( mesh2 ),
+              unique_vertices1_( unique_vertices1 ),
+              unique_vertices2_( unique_vertices2 ),
+              tolerance_( tolerance )
+        {
+        }
+
+        [[nodiscard]] bool operator()(
+            geode::index_t edge1, geode::index_t edge2 ) const
+        {
+            return edges_intersect( edge1, edge2 );
+        }
+
+    private:
+        struct SharedVertices
+        {
+            geode::local_index_t nb{ 0 };
+            std::array< geode::local_index_t, 2 > last{ geode::NO_LID,
+                geode::NO_LID };
+        };
+
+        [[nodiscard]] SharedVertices shared_vertices(
+            const std::array< geode::index_t, 2 >& vertices1,
+            const std::array< geode::index_t, 2 >& vertices2 ) const
+        {
+            SharedVertices shared;
+            for( const auto v1 : geode::LRange{ 2 } )
+            {
+                const auto unique_vertex = unique_vertices1_[vertices1[v1]];
+                if( unique_vertex == geode::NO_ID )
+                {
+                    continue;
+                }
+                for( const auto v2 : geode::LRange{ 2 } )
+                {
+                    if( unique_vertex == unique_vertices2_[vertices2[v2]] )
+                    {
+                        shared.nb++;
+                        shared.last = { v1, v2 };
+                    }
+                }
+            }
+            return shared;
+        }
+
+        [[nodiscard]] bool edges_intersect(
+            geode::index_t edge1, geode::index_t edge2 ) const
+        {
+            const auto& vertices1 = mesh1_.edge_vertices( edge1 );
+            const auto& vertices2 = mesh2_.edge_vertices( edge2 );
+            const auto shared = shared_vertices( vertices1, vertices2 );
+            if constexpr( dimension == 2 )
+            {
+                const auto segment1 = mesh1_.segment( edge1 );
+                const auto segment2 = mesh2_.segment( edge2 );
+                const auto result =
+                    geode::segment_segment_intersection_detection(
+                        segment1, segment2 );
+                if( result.first == geode::POSITION::parallel )
+                {
+                    return collinear_segments_overlap( segment1, segment2 );
+                }
+                if( shared.nb != 0 )
+                {
+                    return false;
+                }
+                return result.first == geode::POSITION::inside
+                       || result.second == geode::POSITION::inside;
+            }
+            else
+            {
+                if( shared.nb == 0 )
+                {
+                    const auto distance =
+                        std::get< 0 >( geode::segment_segment_distance(
+                            mesh1_.segment( edge1 ),
+                            mesh2_.segment( edge2 ) ) );
+                    return distance <= tolerance_;
+                }
+                if( shared.nb > 1 )
+                {
+                    return true;
+                }
+                const auto& shared_point =
+                    mesh1_.point( vertices1[shared.last[0]] );
+                const geode::Vector3D direction1{ shared_point,
+                    mesh1_.point( vertices1[1 - shared.last[0]] ) };
+                const geode::Vector3D direction2{ shared_point,
+                    mesh2_.point( vertices2[1 - shared.last[1]] ) };
+                if( direction1.dot( direction2 ) <= 0 )
+                {
+                    return false;
+                }
+                return direction1.cross( direction2 ).length()
+                       <= tolerance_
+                              * std::max(
+                                  direction1.length(), direction2.length() );
+            }
+        }
+
+    private:
+        const geode::EdgedCurve< dimension >& mesh1_;
+        const geode::EdgedCurve< dimension >& mesh2_;
+        absl::Span< const geode::index_t > unique_vertices1_;
+        absl::Span< const geode::index_t > unique_vertices2_;
+        const double tolerance_;
+    };
+
+    /*!
+     * Bounding box traversal action gathering the intersecting edges of two
+     * lines, or of one line with itself.
+     */
+    template < geode::index_t dimension >
+    class LineEdgesIntersection
+    {
+    public:
+        LineEdgesIntersection( const geode::EdgedCurve< dimension >& mesh1,
+            const geode::EdgedCurve< dimension >& mesh2,
+            absl::Span< const geode::index_t > unique_vertices1,
+            absl::Span< const geode::index_t > unique_vertices2,
+            std::atomic< bool >& stop_flag,
+            bool stop_at_first_intersection,
+            double tolerance = geode::GLOBAL_EPSILON )
+            : edges_intersect_( mesh1,
+                  mesh2,
+                  unique_vertices1,
+                  unique_vertices2,
+                  tolerance ),
+              stop_flag_( stop_flag ),
+              stop_at_first_intersection_( stop_at_first_intersection )
+        {
+        }
+
+        bool operator()( geode::index_t edge1, geode::index_t edge2 )
+        {
+            if( stop_flag_.load( std::memory_order_relaxed ) )
+            {
+                return true;
+            }
+            if( !edges_intersect_( edge1, edge2 ) )
+            {
+                return false;
+            }
+            intersecting_edges_.emplace_back( edge1, edge2 );
+            if( stop_at_first_intersection_ )
+            {
+                stop_flag_.store( true, std::memory_order_relaxed );
+                return true;
+            }
+            return false;
+        }
+
+        [[nodiscard]] std::vector< IndexPair > intersecting_edges()
+        {
+            return intersecting_edges_.sorted_values();
+        }
+
+    private:
+        const LineEdgesPredicate< dimension > edges_intersect_;
+        std::atomic< bool >& stop_flag_;
+        const bool stop_at_first_intersection_;
+        geode::internal::PerThreadBuffers< IndexPair > intersecting_edges_;
+    };
+
+    /*!
+     * Edge of an inspected line with its bounding box.
+     */
+    struct SweepEdge
+    {
+        geode::index_t line;
+        geode::index_t edge;
+        std::array< double, 2 > x_bounds;
+        std::array< double, 2 > y_bounds;
+    };
+
+    /*!
+     * Interval tree on the y bounds of the edges crossed by the sweep line.
+     * Its skeleton is a balanced binary tree over the sorted distinct
+     * bounds, built once: node mid of the bounds range [begin, end) has
+     * centers_[mid] as center, [begin, mid) and [mid + 1, end) as children.
+     * An edge is stored in the highest node whose center lies in its
+     * interval, sorted both by lower and by upper bound.
+     */
+    class ActiveEdges
+    {
+        using Bound = std::pair< double, geode::index_t >;
+
+        struct Node
+        {
+            std::set< Bound > by_lower;
+            std::set< Bound > by_upper;
+            geode::index_t nb_subtree_edges{ 0 };
+        };
+
+    public:
+        explicit ActiveEdges( absl::Span< const SweepEdge > edges )
+            : edges_( edges )
+        {
+            centers_.reserve( 2 * edges.size() );
+            for( const auto& edge : edges )
+            {
+                centers_.push_back( edge.y_bounds[0] );
+                centers_.push_back( edge.y_bounds[1] );
+            }
+            absl::c_sort( centers_ );
+            centers_.erase(
+                std::unique( centers_.begin(), centers_.end() ),
+                centers_.end() );
+            nodes_.resize( centers_.size() );
+        }
+
+        void insert( geode::index_t edge )
+        {
+            const auto& bounds = edges_[edge].y_bounds;
+            auto& node = nodes_[store_node( bounds, true )];
+            node.by_lower.emplace( bounds[0], edge );
+            node.by_upper.emplace( bounds[1], edge );
+        }
+
+        void remove( geode::index_t edge )
+        {
+            const auto& bounds = edges_[edge].y_bounds;
+            auto& node = nodes_[store_node( bounds, false )];
+            node.by_lower.erase( { bounds[0], edge } );
+            node.by_upper.erase( { bounds[1], edge } );
+        }
+
+        /*!
+         * Calls action( edge ) on each stored edge whose y interval meets
+         * [lower, upper], until an action returns true. Returns true if an
+         * action stopped the search.
+         */
+        template < typename Action >
+        bool for_each_overlapping_edge(
+            double lower, double upper, const Action& action ) const
+        {
+            return for_each_overlapping_edge( 0,
+                static_cast< geode::index_t >( centers_.size() ), lower, upper,
+                action );
+        }
+
+    private:
+        /*!
+         * Walks down to the node storing the interval and updates the edges
+         * count of the visited subtrees.
+         */
+        [[nodiscard]] geode::index_t store_node(
+            const std::array< double, 2 >& bounds, bool inserting )
+        {
+            geode::index_t begin{ 0 };
+            auto end = static_cast< geode::index_t >( centers_.size() );
+            while( true )
+            {
+                const auto mid = begin + ( end - begin ) / 2;
+                auto& nb_subtree_edges = nodes_[mid].nb_subtree_edges;
+                nb_subtree_edges = inserting ? nb_subtree_edges + 1
+                                             : nb_subtree_edges - 1;
+                if( bounds[1] < centers_[mid] )
+                {
+                    end = mid;
+                }
+                else if( bounds[0] > centers_[mid] )
+                {
+                    begin = mid + 1;
+                }
+                else
+                {
+                    return mid;
+                }
+            }
+        }
+
+        template < typename Action >
+        bool for_each_overlapping_edge( geode::index_t begin,
+            geode::index_t end,
+            double lower,
+            double upper,
+            const Action& action ) const
+        {
+            if( begin >= end )
+            {
+                return false;
+            }
+            const auto mid = begin + ( end - begin ) / 2;
+            const auto& node = nodes_[mid];
+            if( node.nb_subtree_edges == 0 )
+            {
+                return false;
+            }
+            const auto center = centers_[mid];
+            if( upper < center )
+            {
+                for( const auto& bound : node.by_lower )
+                {
+                    if( bound.first > upper )
+                    {
+                        break;
+                    }
+                    if( action( bound.second ) )
+                    {
+                        return true;
+                    }
+                }
+                return for_each_overlapping_edge(
+                    begin, mid, lower, upper, action );
+            }
+            if( lower > center )
+            {
+                for( auto bound = node.by_upper.rbegin();
+                     bound != node.by_upper.rend() && bound->first >= lower;
+                     ++bound )
+                {
+                    if( action( bound->second ) )
+                    {
+                        return true;
+                    }
+                }
+                return for_each_overlapping_edge(
+                    mid + 1, end, lower, upper, action );
+            }
+            for( const auto& bound : node.by_lower )
+            {
+                if( action( bound.second ) )
+                {
+                    return true;
+                }
+            }
+            return for_each_overlapping_edge( begin, mid, lower, upper, action )
+                   || for_each_overlapping_edge(
+                       mid + 1, end, lower, upper, action );
+        }
+
+    private:
+        absl::Span< const SweepEdge > edges_;
+        std::vector< double > centers_;
+        std::vector< Node > nodes_;
+    };
+
+    /*!
+     * Sweeps a line along the x axis over the edges bounding boxes and calls
+     * action( edge0, edge1 ) on each pair of edges whose boxes intersect,
+     * edge0 being swept before edge1, until an action returns true.
+     * Boxes are entered by increasing lower x bound and left by increasing
+     * upper x bound, boxes touching on x being entered before leaving. The
+     * entered box is matched with the active ones meeting its y interval.
+     * Only input coordinates are compared, so the pairs are exact. With n
+     * edges and b intersecting boxes pairs, the sweep costs
+     * O( ( n + b ) log( n ) ).
+     */
+    template < typename Action >
+    void sweep_edges_bbox_intersections(
+        absl::Span< const SweepEdge > edges, const Action& action )
+    {
+        struct Event
+        {
+            bool operator<( const Event& other ) const
+            {
+                return std::tie( position, leaving, edge )
+                       < std::tie( other.position, other.leaving, other.edge );
+            }
+
+            double position;
+            bool leaving;
+            geode::index_t edge;
+        };
+        std::vector< Event > events;
+        events.reserve( 2 * edges.size() );
+        for( const auto edge : geode::Indices{ edges } )
+        {
+            events.push_back( { edges[edge].x_bounds[0], false, edge } );
+            events.push_back( { edges[edge].x_bounds[1], true, edge } );
+        }
+        absl::c_sort( events );
+        ActiveEdges active{ edges };
+        for( const auto& event : events )
+        {
+            if( event.leaving )
+            {
+                active.remove( event.edge );
+                continue;
+            }
+            const auto& y_bounds = edges[event.edge].y_bounds;
+            if( active.for_each_overlapping_edge( y_bounds[0], y_bounds[1],
+                    [&action, &event]( geode::index_t other ) {
+                        return action( other, event.edge );
+                    } ) )
+            {
+                return;
+            }
+            active.insert( event.edge );
+        }
+    }
+} // namespace
+
+namespace geode
+{
+    template < typename Model >
+    class ModelLinesIntersections< Model >::Impl
+    {
+        using LineEdges = std::pair< ComponentMeshElement,
+            ComponentMeshElement >;
+
+    public:
+        explicit Impl( const Model& model ) : model_( model ) {}
+
+        /*!
+         * Lines unique vertices used when no snapshot is given by the caller,
+         * built on first use.
+         */
+        [[nodiscard]] const internal::ModelUniqueVertices&
+            lines_unique_vertices() const
+        {
+            std::call_once( unique_vertices_flag_, [this] {
+                unique_vertices_.emplace(
+                    model_, absl::MakeConstSpan( LINE_KIND ) );
+            } );
+            return unique_vertices_.value();
+        }
+
+        [[nodiscard]] bool model_has_intersecting_lines(
+            const internal::ModelUniqueVertices& unique_vertices ) const
+        {
+            return !intersecting_line_edges( unique_vertices, true ).empty();
+        }
+
+        void add_intersecting_lines_elements(
+            const internal::ModelUniqueVertices& unique_vertices,
+            InspectionIssues< LineEdges >& intersection_issues ) const
+        {
+            for( const auto& edge_pair :
+                intersecting_line_edges( unique_vertices, false ) )
+            {
+                add_line_edges_issue( intersection_issues,
+                    model_.line( edge_pair.first.component_id.id() ),
+                    edge_pair.first.element_id,
+                    model_.line( edge_pair.second.component_id.id() ),
+                    edge_pair.second.element_id );
+            }
+        }
+
+    private:
+        [[nodiscard]] const ModelMeshesAABBTree< Model::dim >&
+            lines_model_tree() const
+        {
+            std::call_once( lines_model_tree_flag_, [this] {
+                lines_model_tree_ = create_line_meshes_aabb_trees( model_ );
+            } );
+            return lines_model_tree_;
+        }
+
+        [[nodiscard]] bool is_inspected( const uuid& line_id ) const
+        {
+            const auto& line = model_.line( line_id );
+            return line.is_active() && line.mesh().nb_edges() != 0;
+        }
+
+        [[nodiscard]] std::vector< LineEdges > intersecting_line_edges(
+            const internal::ModelUniqueVertices& unique_vertices,
+            bool stop_at_first_intersection ) const
+        {
+            if constexpr( Model::dim == 2 )
+            {
+                return swept_intersecting_line_edges(
+                    unique_vertices, stop_at_first_intersection );
+            }
+            else
+            {
+                return traversed_intersecting_line_edges(
+                    unique_vertices, stop_at_first_intersection );
+            }
+        }
+
+        /*!
+         * All the inspected lines edges are swept together. The candidate
+         * pairs of intersecting bounding boxes are tested in parallel by
+         * batches, so that the search can stop at the first intersection.
+         */
+        [[nodiscard]] std::vector< LineEdges > swept_intersecting_line_edges(
+            const internal::ModelUniqueVertices& unique_vertices,
+            bool stop_at_first_intersection ) const
+        {
+            std::vector< const Line< Model::dim >* > lines;
+            std::vector< absl::Span< const index_t > > lines_unique_vertices;
+            std::vector< SweepEdge > edges;
+            for( const auto& line : model_.lines() )
+            {
+                if( !is_inspected( line.id() ) )
+                {
+                    continue;
+                }
+                const auto line_id = static_cast< index_t >( lines.size() );
+                lines.push_back( &line );
+                lines_unique_vertices.push_back(
+                    unique_vertices.component_unique_vertices(
+                        unique_vertices.component_index( line.id() ) ) );
+                const auto& mesh = line.mesh();
+                for( const auto edge : Range{ mesh.nb_edges() } )
+                {
+                    const auto& vertices = mesh.edge_vertices( edge );
+                    const auto& point0 = mesh.point( vertices[0] );
+                    const auto& point1 = mesh.point( vertices[1] );
+                    edges.push_back( { line_id, edge,
+                        { std::min( point0.value( 0 ), point1.value( 0 ) ),
+                            std::max( point0.value( 0 ), point1.value( 0 ) ) },
+                        { std::min( point0.value( 1 ), point1.value( 1 ) ),
+                            std::max(
+                                point0.value( 1 ), point1.value( 1 ) ) } } );
+                }
+            }
+            internal::PerThreadBuffers< IndexPair > intersecting_edges;
+            std::atomic< bool > stop_flag{ false };
+            std::vector< IndexPair > candidates;
+            const auto test_candidates = [&] {
+                async::parallel_for(
+                    async::irange( index_t{ 0 },
+                        static_cast< index_t >( candidates.size() ) ),
+                    [&]( index_t candidate ) {
+                        if( stop_flag.load( std::memory_order_relaxed ) )
+                        {
+                            return;
+                        }
+                        const auto& edge1 = edges[candidates[candidate].first];
+                        const auto& edge2 =
+                            edges[candidates[candidate].second];
+                        const LineEdgesPredicate< Model::dim > edges_intersect{
+                            lines[edge1.line]->mesh(),
+                            lines[edge2.line]->mesh(),
+                            lines_unique_vertices[edge1.line],
+                            lines_unique_vertices[edge2.line]
+                        };
+                        if( !edges_intersect( edge1.edge, edge2.edge ) )
+                        {
+                            return;
+                        }
+                        intersecting_edges.emplace_back(
+                            candidates[candidate] );
+                        if( stop_at_first_intersection )
+                        {
+                            stop_flag.store( true, std::memory_order_relaxed );
+                        }
+                    } );
+                candidates.clear();
+                return stop_flag.load();
+            };
+            sweep_edges_bbox_intersections( edges,
+                [&candidates, &test_candidates](
+                    index_t edge1, index_t edge2 ) {
+                    candidates.emplace_back( std::minmax( edge1, edge2 ) );
+                    return candidates.size() == CANDIDATES_BATCH_SIZE
+                           && test_candidates();
+                } );
+            test_candidates();
+            std::vector< LineEdges > intersections;
+            for( const auto& edge_pair : intersecting_edges.sorted_values() )
+            {
+                const auto& edge1 = edges[edge_pair.first];
+                const auto& edge2 = edges[edge_pair.second];
+                intersections.emplace_back(
+                    ComponentMeshElement{
+                        lines[edge1.line]->component_id(), edge1.edge },
+                    ComponentMeshElement{
+                        lines[edge2.line]->component_id(), edge2.edge } );
+            }
+            return intersections;
+        }
+
+        /*!
+         * Each line is traversed with itself, and with every other line whose
+         * bounding box intersects its own. All these component pairs are
+         * then traversed in parallel.
+         */
+        [[nodiscard]] std::vector< LineEdges >
+            traversed_intersecting_line_edges(
+                const internal::ModelUniqueVertices& unique_vertices,
+                bool stop_at_first_intersection ) const
+        {
+            const auto& lines_tree = lines_model_tree();
+            LineComponentsOverlap lines_overlap;
+            lines_tree.components_tree_.compute_self_element_bbox_intersections(
+                lines_overlap );
+            std::vector< IndexPair > candidates;
+            for( const auto& candidate : lines_overlap.component_pairs() )
+            {
+                if( is_inspected( lines_tree.uuids_[candidate.first] )
+                    && is_inspected( lines_tree.uuids_[candidate.second] ) )
+                {
+                    candidates.push_back( candidate );
+                }
+            }
+            for( const auto line_tree_id : Indices{ lines_tree.uuids_ } )
+            {
+                if( is_inspected( lines_tree.uuids_[line_tree_id] ) )
+                {
+                    candidates.emplace_back( line_tree_id, line_tree_id );
+                }
+            }
+            absl::c_sort( candidates );
+            std::vector< std::vector< LineEdges > > candidates_intersections(
+                candidates.size() );
+            std::atomic< bool > stop_flag{ false };
+            async::parallel_for(
+                async::irange(
+                    index_t{ 0 }, static_cast< index_t >( candidates.size() ) ),
+                [this, &unique_vertices, &lines_tree, &candidates,
+                    &candidates_intersections, &stop_flag,
+                    stop_at_first_intersection](
+                    index_t candidate ) {
+                    if( stop_flag.load( std::memory_order_relaxed ) )
+                    {
+                        return;
+                    }
+                    const auto [line_tree_id1, line_tree_id2] =
+                        candidates[candidate];
+                    const auto& line1 =
+                        model_.line( lines_tree.uuids_[line_tree_id1] );
+                    const auto& line2 =
+                        model_.line( lines_tree.uuids_[line_tree_id2] );
+                    LineEdgesIntersection< Model::dim > action{ line1.mesh(),
+                        line2.mesh(),
+                        unique_vertices.component_unique_vertices(
+                            unique_vertices.component_index( line1.id() ) ),
+                        unique_vertices.component_unique_vertices(
+                            unique_vertices.component_index( line2.id() ) ),
+                        stop_flag, stop_at_first_intersection };
+                    const auto& tree1 = lines_tree.mesh_trees_[line_tree_id1];
+                    if( line_tree_id1 == line_tree_id2 )
+                    {
+                        tree1.compute_self_element_bbox_intersections(
+                            action );
+                    }
+                    else
+                    {
+                        tree1.compute_other_element_bbox_intersections(
+                            lines_tree.mesh_trees_[line_tree_id2], action );
+                    }
+                    auto& result = candidates_intersections[candidate];
+                    for( const auto& edges : action.intersecting_edges() )
+                    {
+                        result.emplace_back(
+                            ComponentMeshElement{
+                                line1.component_id(), edges.first },
+                            ComponentMeshElement{
+                                line2.component_id(), edges.second } );
+                    }
+                } );
+            std::vector< LineEdges > intersections;
+            for( auto& candidate_intersections : candidates_intersections )
+            {
+                absl::c_move( candidate_intersections,
+                    std::back_inserter( intersections ) );
+            }
+            return intersections;
+        }
+
+    private:
+        const Model& model_;
+        mutable std::once_flag lines_model_tree_flag_;
+        mutable ModelMeshesAABBTree< Model::dim > lines_model_tree_;
+        mutable std::once_flag unique_vertices_flag_;
+        mutable std::optional< internal::ModelUniqueVertices > unique_vertices_;
+    };
+
+    template < typename Model >
+    ModelLinesIntersections< Model >::ModelLinesIntersections(
+        const Model& model )
+        : impl_( model )
+    {
+    }
+
+    template < typename Model >
+    ModelLinesIntersections< Model >::~ModelLinesIntersections() = default;
+
+    template < typename Model >
+    bool ModelLinesIntersections< Model >::model_has_intersecting_lines() const
+    {
+        return impl_->model_has_intersecting_lines(
+            impl_->lines_unique_vertices() );
+    }
+
+    template < typename Model >
+    ElementsIntersectionsInspectionResult
+        ModelLinesIntersections< Model >::inspect_lines_intersections() const
+    {
+        return inspect_lines_intersections( impl_->lines_unique_vertices() );
+    }
+
+    template < typename Model >
+    ElementsIntersectionsInspectionResult
+        ModelLinesIntersections< Model >::inspect_lines_intersections(
+            const internal::ModelUniqueVertices& unique_vertices ) const
+    {
+        ElementsIntersectionsInspectionResult results;
+        results.elements_intersections.set_description( "lines intersections" );
+        impl_->add_intersecting_lines_elements(
+            unique_vertices, results.elements_intersections );
+        return results;
+    }
+
+    template class opengeode_inspector_inspection_api
+        ModelLinesIntersections< Section >;
+    template class opengeode_inspector_inspection_api
+        ModelLinesIntersections< BRep >;
+} // namespace geode
@@ -25,6 +25,8 @@
 
 #include <absl/algorithm/container.h>
 
+#include <async++.h>
+
 #include <geode/basic/logger.hpp>
 #include <geode/basic/pimpl_impl.hpp>
 
@@ -40,6 +42,8 @@
 #include <geode/mesh/helpers/aabb_edged_curve_helpers.hpp>
 #include <geode/mesh/helpers/aabb_surface_helpers.hpp>
 
+#include <geode/inspector/inspection/criterion/internal/per_thread_buffers.hpp>
+
 namespace
 {
     template < geode::index_t dimension >
@@ -56,7 +60,7 @@ namespace
         std::vector< std::pair< geode::index_t, geode::index_t > >
             intersecting_elements()
         {
-            return std::move( intersecting_elements_ );
+            return intersecting_elements_.sorted_values();
         }
 
     protected:
@@ -65,16 +69,15 @@ namespace
 
         void emplace( geode::index_t triangle_id, geode::index_t edge_id )
         {
-            std::lock_guard< std::mutex > lock( mutex_ );
             intersecting_elements_.emplace_back( triangle_id, edge_id );
         }
 
     private:
         const geode::TriangulatedSurface< dimension >& surface_;
         const geode::EdgedCurve< dimension >& curve_;
-        std::vector< std::pair< geode::index_t, geode::index_t > >
+        geode::internal::PerThreadBuffers<
+            std::pair< geode::index_t, geode::index_t > >
             intersecting_elements_;
-        std::mutex mutex_;
     };
 
     template < geode::index_t dimension >
@@ -209,6 +212,36 @@ namespace
         }
         return false;
     }
+
+    template < typename Action, geode::index_t dimension >
+    std::vector< std::pair< geode::index_t, geode::index_t > >
+        intersecting_triangles_with_edges(
+            const geode::TriangulatedSurface< dimension >& surface,
+            const geode::AABBTree< dimension >& surface_aabb,
+            const geode::EdgedCurve< dimension >& curve )
+    {
+        const auto curve_aabb = geode::create_aabb_tree( curve );
+        Action action{ surface, curve };
+        surface_aabb.compute_other_element_bbox_intersections(
+            curve_aabb, action );
+        return action.intersecting_elements();
+    }
+
+    geode::InspectionIssues< std::pair< geode::index_t, geode::index_t > >
+        intersection_issues(
+            absl::Span< const std::pair< geode::index_t, geode::index_t > >
+                intersections )
+    {
+        geode::InspectionIssues< std::pair< geode::index_t, geode::index_t > >
+            issues{ "intersections between triangles and edges" };
+        for( const auto& pair : intersections )
+        {
+            issues.add_issue(
+                pair, absl::StrCat( "Triangle ", pair.first, " and edge",
+                          pair.second, " intersect" ) );
+        }
+        return issues;
+    }
 } // namespace
 
 namespace geode
@@ -225,48 +258,71 @@ namespace geode
 
         bool meshes_have_intersections() const
         {
+            const auto surface_aabb = create_aabb_tree( surface_ );
             const auto intersections = intersecting_triangles_with_edges<
-                OneTriangleEdgeIntersection< dimension > >();
-            if( intersections.empty() )
-            {
-                return false;
-            }
-            return true;
+                OneTriangleEdgeIntersection< dimension > >(
+                surface_, surface_aabb, curve_ );
+            return !intersections.empty();
         }
 
         InspectionIssues< std::pair< index_t, index_t > >
             intersecting_elements() const
         {
-            const auto intersections = intersecting_triangles_with_edges<
-                AllTriangleEdgeIntersection< dimension > >();
-            InspectionIssues< std::pair< index_t, index_t > > issues{
-                "intersections between triangles and edges"
-            };
-            for( const auto& pair : intersections )
-            {
-                issues.add_issue(
-                    pair, absl::StrCat( "Triangle ", pair.first, " and edge",
-                              pair.second, " intersect" ) );
-            }
-            return issues;
+            const auto surface_aabb = create_aabb_tree( surface_ );
+            return intersection_issues( intersecting_triangles_with_edges<
+                AllTriangleEdgeIntersection< dimension > >(
+                surface_, surface_aabb, curve_ ) );
         }
 
     private:
-        template < typename Action >
-        std::vector< std::pair< index_t, index_t > >
-            intersecting_triangles_with_edges() const
+        const TriangulatedSurface< dimension >& surface_;
+        const EdgedCurve< dimension >& curve_;
+    };
+
+    template < index_t dimension >
+    class SurfaceCurvesIntersections< dimension >::Impl
+    {
+    public:
+        explicit Impl( const TriangulatedSurface< dimension >& surface )
+            : surface_( surface ), surface_aabb_{ create_aabb_tree( surface ) }
         {
-            const auto surface_aabb = create_aabb_tree( surface_ );
-            const auto curve_aabb = create_aabb_tree( curve_ );
-            Action action{ surface_, curve_ };
-            surface_aabb.compute_other_element_bbox_intersections(
-                curve_aabb, action );
-            return action.intersecting_elements();
+        }
+
+        std::vector< bool > curves_have_intersections(
+            absl::Span< const EdgedCurve< dimension >* const > curves ) const
+        {
+            std::vector< uint8_t > intersect( curves.size(), false );
+            async::parallel_for( async::irange( size_t{ 0 }, curves.size() ),
+                [&curves, &intersect, this]( size_t c ) {
+                    const auto intersections =
+                        intersecting_triangles_with_edges<
+                            OneTriangleEdgeIntersection< dimension > >(
+                            surface_, surface_aabb_, *curves[c] );
+                    intersect[c] = !intersections.empty();
+                } );
+            return { intersect.begin(), intersect.end() };
+        }
+
+        std::vector< InspectionIssues< std::pair< index_t, index_t > > >
+            curves_intersecting_elements(
+                absl::Span< const EdgedCurve< dimension >* const > curves )
+                const
+        {
+            std::vector< InspectionIssues< std::pair< index_t, index_t > > >
+                issues( curves.size() );
+            async::parallel_for( async::irange( size_t{ 0 }, curves.size() ),
+                [&curves, &issues, this]( size_t c ) {
+                    issues[c] = intersection_issues(
+                        intersecting_triangles_with_edges<
+                            AllTriangleEdgeIntersection< dimension > >(
+                            surface_, surface_aabb_, *curves[c] ) );
+                } );
+            return issues;
         }
 
     private:
         const TriangulatedSurface< dimension >& surface_;
-        const EdgedCurve< dimension >& curve_;
+        const AABBTree< dimension > surface_aabb_;
     };
 
     template < index_t dimension >
@@ -295,8 +351,39 @@ namespace geode
         return impl_->intersecting_elements();
     }
 
+    template < index_t dimension >
+    SurfaceCurvesIntersections< dimension >::SurfaceCurvesIntersections(
+        const TriangulatedSurface< dimension >& surface )
+        : impl_( surface )
+    {
+    }
+
+    template < index_t dimension >
+    SurfaceCurvesIntersections< dimension >::~SurfaceCurvesIntersections() =
+        default;
+
+    template < index_t dimension >
+    std::vector< bool >
+        SurfaceCurvesIntersections< dimension >::curves_have_intersections(
+            absl::Span< const EdgedCurve< dimension >* const > curves ) const
+    {
+        return impl_->curves_have_intersections( curves );
+    }
+
+    template < index_t dimension >
+    std::vector< InspectionIssues< std::pair< index_t, index_t > > >
+        SurfaceCurvesIntersections< dimension >::curves_intersecting_elements(
+            absl::Span< const EdgedCurve< dimension >* const > curves ) const
+    {
+        return impl_->curves_intersecting_elements( curves );
+    }
+
     template class opengeode_inspector_inspection_api
         SurfaceCurveIntersections< 2 >;
     template class opengeode_inspector_inspection_api
         SurfaceCurveIntersections< 3 >;
+    template class opengeode_inspector_inspection_api
+        SurfaceCurvesIntersections< 2 >;
+    template class opengeode_inspector_inspection_api
+        SurfaceCurvesIntersections< 3 >;
 } // namespace geode
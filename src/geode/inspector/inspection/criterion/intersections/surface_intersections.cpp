@@ -35,6 +35,9 @@
 #include <geode/mesh/helpers/aabb_surface_helpers.hpp>
 #include <geode/mesh/helpers/detail/mesh_intersection_detection.hpp>
 
+#include <geode/inspector/inspection/criterion/internal/per_thread_buffers.hpp>
+#include <geode/inspector/inspection/criterion/internal/triangle_pairs_filter.hpp>
+
 namespace
 {
     template < geode::index_t dimension >
@@ -51,7 +54,7 @@ namespace
         std::vector< std::pair< geode::index_t, geode::index_t > >
             intersecting_polygons()
         {
-            return std::move( intersecting_polygons_ );
+            return intersecting_polygons_.sorted_values();
         }
 
         bool operator()( geode::index_t p1_id, geode::index_t p2_id )
@@ -62,6 +65,10 @@ namespace
             }
             const auto p1_vertices = this->mesh().polygon_vertices( p1_id );
             const auto p2_vertices = this->mesh().polygon_vertices( p2_id );
+            if( triangles_are_separated( p1_vertices, p2_vertices ) )
+            {
+                return false;
+            }
             if( geode::detail::polygons_intersection_detection<
                     geode::SurfaceMesh< dimension > >(
                     mesh_, p1_vertices, p2_vertices ) )
@@ -75,7 +82,6 @@ namespace
     protected:
         void emplace( geode::index_t p1_id, geode::index_t p2_id )
         {
-            std::lock_guard< std::mutex > lock( mutex_ );
             intersecting_polygons_.emplace_back( p1_id, p2_id );
         }
 
@@ -84,12 +90,53 @@ namespace
             return mesh_;
         }
 
+    private:
+        /*!
+         * Topological pre-classification of triangle pairs from their vertex
+         * ids: disjoint triangles go through the floating-point separation
+         * filter, neighboring triangles through its shared vertex tests.
+         * Other polygons are left to the full predicates.
+         */
+        [[nodiscard]] bool triangles_are_separated(
+            const geode::PolygonVertices& p1_vertices,
+            const geode::PolygonVertices& p2_vertices ) const
+        {
+            if( p1_vertices.size() != 3 || p2_vertices.size() != 3 )
+            {
+                return false;
+            }
+            absl::InlinedVector< geode::internal::SharedTriangleVertex, 3 >
+                shared_vertices;
+            for( const auto v1 : geode::LRange{ 3 } )
+            {
+                for( const auto v2 : geode::LRange{ 3 } )
+                {
+                    if( p1_vertices[v1] == p2_vertices[v2] )
+                    {
+                        shared_vertices.push_back( { v1, v2 } );
+                    }
+                }
+            }
+            if( shared_vertices.size() > 2 )
+            {
+                return false;
+            }
+            return geode::internal::triangles_are_separated< dimension >(
+                { &mesh_.point( p1_vertices[0] ),
+                    &mesh_.point( p1_vertices[1] ),
+                    &mesh_.point( p1_vertices[2] ) },
+                { &mesh_.point( p2_vertices[0] ),
+                    &mesh_.point( p2_vertices[1] ),
+                    &mesh_.point( p2_vertices[2] ) },
+                shared_vertices );
+        }
+
     private:
         const geode::SurfaceMesh< dimension >& mesh_;
         bool stop_at_first_intersection_;
-        std::vector< std::pair< geode::index_t, geode::index_t > >
+        geode::internal::PerThreadBuffers<
+            std::pair< geode::index_t, geode::index_t > >
             intersecting_polygons_;
-        std::mutex mutex_;
     };
 } // namespace
 
@@ -39,6 +39,7 @@
 #include <geode/model/representation/core/brep.hpp>
 
 #include <geode/inspector/inspection/criterion/internal/component_meshes_manifold.hpp>
+#include <geode/inspector/inspection/criterion/internal/model_unique_vertices.hpp>
 #include <geode/inspector/inspection/criterion/manifold/solid_edge_manifold.hpp>
 #include <geode/inspector/inspection/criterion/manifold/solid_facet_manifold.hpp>
 #include <geode/inspector/inspection/criterion/manifold/solid_vertex_manifold.hpp>
@@ -152,7 +153,15 @@ namespace geode
             }
         }
 
+        [[nodiscard]] internal::ModelUniqueVertices
+            surfaces_unique_vertices() const
+        {
+            return internal::ModelUniqueVertices{ model(),
+                { internal::ModelUniqueVertices::ComponentKind::surface } };
+        }
+
         void add_model_non_manifold_edges(
+            const internal::ModelUniqueVertices& unique_vertices,
             InspectionIssues< BRepNonManifoldEdge >& issues ) const
         {
             using Edge = detail::VertexCycle< std::array< index_t, 2 > >;
@@ -160,6 +169,9 @@ namespace geode
             for( const auto& surface : model().active_surfaces() )
             {
                 const auto& mesh = surface.mesh();
+                const auto surface_unique_vertices =
+                    unique_vertices.component_unique_vertices(
+                        unique_vertices.component_index( surface.id() ) );
                 for( const auto polygon_id : Range{ mesh.nb_polygons() } )
                 {
                     const auto vertices = mesh.polygon_vertices( polygon_id );
@@ -171,13 +183,12 @@ namespace geode
                         {
                             continue;
                         }
-                        const auto v0 = model().unique_vertex(
-                            { surface.component_id(), vertices[edge_id] } );
-                        const auto v1 =
-                            model().unique_vertex( { surface.component_id(),
-                                vertices[edge_id == vertices.size() - 1
-                                             ? 0
-                                             : edge_id + 1] } );
+                        const auto v0 =
+                            surface_unique_vertices[vertices[edge_id]];
+                        const auto v1 = surface_unique_vertices
+                            [vertices[edge_id == vertices.size() - 1
+                                          ? 0
+                                          : edge_id + 1]];
                         const auto info = edges.try_emplace(
                             Edge{ std::array< index_t, 2 >{ v0, v1 } },
                             std::vector< uuid >{ surface.id() } );
@@ -302,6 +313,13 @@ namespace geode
 
     BRepMeshesManifoldInspectionResult
         BRepComponentMeshesManifold::inspect_brep_manifold() const
+    {
+        return inspect_brep_manifold( impl_->surfaces_unique_vertices() );
+    }
+
+    BRepMeshesManifoldInspectionResult
+        BRepComponentMeshesManifold::inspect_brep_manifold(
+            const internal::ModelUniqueVertices& unique_vertices ) const
     {
         BRepMeshesManifoldInspectionResult result;
         impl_->add_component_meshes_non_manifold_vertices(
@@ -310,7 +328,8 @@ namespace geode
             result.meshes_non_manifold_edges );
         impl_->add_component_meshes_non_manifold_facets(
             result.meshes_non_manifold_facets );
-        impl_->add_model_non_manifold_edges( result.brep_non_manifold_edges );
+        impl_->add_model_non_manifold_edges(
+            unique_vertices, result.brep_non_manifold_edges );
         impl_->add_model_non_manifold_facets( result.brep_non_manifold_facets );
         return result;
     }
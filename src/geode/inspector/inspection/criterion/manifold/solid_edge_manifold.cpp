@@ -23,61 +23,131 @@
 
 #include <geode/inspector/inspection/criterion/manifold/solid_edge_manifold.hpp>
 
-#include <absl/container/flat_hash_map.h>
-#include <absl/container/flat_hash_set.h>
+#include <atomic>
+#include <numeric>
+
+#include <async++.h>
+
+#include <absl/algorithm/container.h>
 
 #include <geode/basic/logger.hpp>
 #include <geode/basic/pimpl_impl.hpp>
 #include <geode/basic/uuid.hpp>
 
-#include <geode/mesh/core/detail/vertex_cycle.hpp>
 #include <geode/mesh/core/solid_mesh.hpp>
 
+#include <geode/inspector/inspection/criterion/internal/parallel_sort.hpp>
+
 namespace
 {
-    using Edge = geode::detail::VertexCycle< std::array< geode::index_t, 2 > >;
-
-    bool polyhedra_around_edge_are_the_same(
-        absl::Span< const geode::index_t > pae1,
-        absl::Span< const geode::index_t > pae2 )
+    struct PolyhedronEdge
     {
-        if( pae1.size() != pae2.size() )
+        [[nodiscard]] std::pair< geode::index_t, geode::index_t > key() const
         {
-            return false;
+            return std::minmax( vertices[0], vertices[1] );
         }
-        for( const auto& polyhedron_id : pae1 )
+
+        [[nodiscard]] bool operator<( const PolyhedronEdge& other ) const
         {
-            if( absl::c_find( pae2, polyhedron_id ) == pae2.end() )
+            const auto edge_key = key();
+            const auto other_key = other.key();
+            if( edge_key != other_key )
             {
-                return false;
+                return edge_key < other_key;
             }
+            return polyhedron < other.polyhedron;
         }
-        return true;
-    }
 
-    template < geode::index_t dimension >
-    absl::flat_hash_map< Edge, std::vector< geode::index_t > >
-        edges_to_polyhedra_around( const geode::SolidMesh< dimension >& mesh )
+        std::array< geode::index_t, 2 > vertices;
+        geode::index_t polyhedron;
+    };
+
+    enum struct EDGE_STATUS : std::uint8_t
     {
-        absl::flat_hash_map< Edge, std::vector< geode::index_t > >
-            polyhedra_around_edges;
-        for( const auto polyhedron_id : geode::Range{ mesh.nb_polyhedra() } )
+        manifold,
+        non_manifold,
+        unchecked
+    };
+
+    /*!
+     * Compressed sparse row storage of the polyhedra around each edge.
+     * Edges are sorted by vertices and polyhedra around each edge are sorted
+     * by index.
+     */
+    class EdgesToPolyhedra
+    {
+    public:
+        template < geode::index_t dimension >
+        explicit EdgesToPolyhedra( const geode::SolidMesh< dimension >& mesh )
         {
-            for( const auto polyhedron_edge_vertices :
-                mesh.polyhedron_edges_vertices( polyhedron_id ) )
+            std::vector< geode::index_t > polyhedron_offsets(
+                mesh.nb_polyhedra() + 1, 0 );
+            async::parallel_for(
+                async::irange( geode::index_t{ 0 }, mesh.nb_polyhedra() ),
+                [&mesh, &polyhedron_offsets]( geode::index_t polyhedron_id ) {
+                    polyhedron_offsets[polyhedron_id + 1] =
+                        mesh.polyhedron_edges_vertices( polyhedron_id ).size();
+                } );
+            std::partial_sum( polyhedron_offsets.begin(),
+                polyhedron_offsets.end(), polyhedron_offsets.begin() );
+            std::vector< PolyhedronEdge > polyhedron_edges(
+                polyhedron_offsets.back() );
+            async::parallel_for(
+                async::irange( geode::index_t{ 0 }, mesh.nb_polyhedra() ),
+                [&mesh, &polyhedron_offsets, &polyhedron_edges](
+                    geode::index_t polyhedron_id ) {
+                    auto entry = polyhedron_offsets[polyhedron_id];
+                    for( const auto& edge_vertices :
+                        mesh.polyhedron_edges_vertices( polyhedron_id ) )
+                    {
+                        polyhedron_edges[entry++] = { edge_vertices,
+                            polyhedron_id };
+                    }
+                } );
+            geode::internal::parallel_sort( polyhedron_edges );
+            polyhedra_.reserve( polyhedron_edges.size() );
+            for( const auto entry : geode::Indices{ polyhedron_edges } )
             {
-                const Edge polyhedron_edge{ polyhedron_edge_vertices };
-                if( !polyhedra_around_edges
-                        .try_emplace( polyhedron_edge, 1, polyhedron_id )
-                        .second )
+                const auto& polyhedron_edge = polyhedron_edges[entry];
+                if( entry == 0
+                    || polyhedron_edges[entry - 1].key()
+                           != polyhedron_edge.key() )
                 {
-                    polyhedra_around_edges[polyhedron_edge].push_back(
-                        polyhedron_id );
+                    edges_.push_back( polyhedron_edge.vertices );
+                    offsets_.push_back( entry );
                 }
+                polyhedra_.push_back( polyhedron_edge.polyhedron );
             }
+            offsets_.push_back( polyhedra_.size() );
         }
-        return polyhedra_around_edges;
-    }
+
+        [[nodiscard]] geode::index_t nb_edges() const
+        {
+            return edges_.size();
+        }
+
+        /*!
+         * Edge vertices, as oriented in the polyhedron of smallest index
+         */
+        [[nodiscard]] const std::array< geode::index_t, 2 >& edge_vertices(
+            geode::index_t edge_id ) const
+        {
+            return edges_[edge_id];
+        }
+
+        [[nodiscard]] absl::Span< const geode::index_t > polyhedra(
+            geode::index_t edge_id ) const
+        {
+            return absl::MakeConstSpan( polyhedra_ )
+                .subspan( offsets_[edge_id],
+                    offsets_[edge_id + 1] - offsets_[edge_id] );
+        }
+
+    private:
+        std::vector< std::array< geode::index_t, 2 > > edges_;
+        std::vector< geode::index_t > offsets_;
+        std::vector< geode::index_t > polyhedra_;
+    };
 } // namespace
 
 namespace geode
@@ -87,34 +157,28 @@ namespace geode
     {
     public:
         Impl( const SolidMesh< dimension >& mesh )
-            : mesh_( mesh ),
-              polyhedra_around_edges_( edges_to_polyhedra_around( mesh ) )
+            : mesh_( mesh ), edges_to_polyhedra_( mesh )
         {
         }
 
         bool mesh_edges_are_manifold() const
         {
-            absl::flat_hash_set< Edge > checked_edges;
-            for( const auto polyhedron_id : Range{ mesh_.nb_polyhedra() } )
-            {
-                for( const auto polyhedron_edge_vertices :
-                    mesh_.polyhedron_edges_vertices( polyhedron_id ) )
-                {
-                    Edge polyhedron_edge{ polyhedron_edge_vertices };
-                    if( !checked_edges.insert( polyhedron_edge ).second )
+            std::atomic< bool > non_manifold_edge_found{ false };
+            async::parallel_for(
+                async::irange( index_t{ 0 }, edges_to_polyhedra_.nb_edges() ),
+                [this, &non_manifold_edge_found]( index_t edge_id ) {
+                    if( non_manifold_edge_found.load(
+                            std::memory_order_relaxed ) )
                     {
-                        continue;
+                        return;
                     }
-                    const auto polyhedra_around = mesh_.polyhedra_around_edge(
-                        polyhedron_edge_vertices, polyhedron_id );
-                    if( !polyhedra_around_edge_are_the_same( polyhedra_around,
-                            polyhedra_around_edges_.at( polyhedron_edge ) ) )
+                    if( !edge_is_manifold( edge_id ) )
                     {
-                        return false;
+                        non_manifold_edge_found.store(
+                            true, std::memory_order_relaxed );
                     }
-                }
-            }
-            return true;
+                } );
+            return !non_manifold_edge_found.load();
         }
 
         InspectionIssues< std::array< index_t, 2 > > non_manifold_edges() const
@@ -122,51 +186,101 @@ namespace geode
             InspectionIssues< std::array< index_t, 2 > > non_manifold_edges{
                 "Non manifold edges"
             };
-            absl::flat_hash_set< Edge > checked_edges;
-            for( const auto polyhedron_id : Range{ mesh_.nb_polyhedra() } )
-            {
-                for( const auto polyhedron_edge_vertices :
-                    mesh_.polyhedron_edges_vertices( polyhedron_id ) )
-                {
-                    Edge polyhedron_edge{ polyhedron_edge_vertices };
-                    if( !checked_edges.insert( polyhedron_edge ).second )
-                    {
-                        continue;
-                    }
+            std::vector< EDGE_STATUS > edges_status(
+                edges_to_polyhedra_.nb_edges(), EDGE_STATUS::manifold );
+            async::parallel_for(
+                async::irange( index_t{ 0 }, edges_to_polyhedra_.nb_edges() ),
+                [this, &edges_status]( index_t edge_id ) {
                     try
                     {
-                        if( !polyhedra_around_edge_are_the_same(
-                                mesh_.polyhedra_around_edge(
-                                    polyhedron_edge_vertices, polyhedron_id ),
-                                polyhedra_around_edges_.at(
-                                    polyhedron_edge ) ) )
+                        if( !edge_is_manifold( edge_id ) )
                         {
-                            non_manifold_edges.add_issue(
-                                polyhedron_edge_vertices,
-                                absl::StrCat(
-                                    "Non manifold edge between vertices ",
-                                    polyhedron_edge_vertices[0], " and ",
-                                    polyhedron_edge_vertices[1] ) );
+                            edges_status[edge_id] = EDGE_STATUS::non_manifold;
                         }
                     }
                     catch( const OpenGeodeException& )
                     {
-                        non_manifold_edges.add_issue( polyhedron_edge_vertices,
-                            absl::StrCat( "Could not check manifold on edge "
-                                          "between vertices with index ",
-                                polyhedron_edge_vertices[0], " and index ",
-                                polyhedron_edge_vertices[1],
-                                "; Check issues with solid adjacencies." ) );
+                        edges_status[edge_id] = EDGE_STATUS::unchecked;
                     }
+                } );
+            for( const auto edge_id :
+                wrong_edges_in_mesh_order( edges_status ) )
+            {
+                const auto& edge_vertices =
+                    edges_to_polyhedra_.edge_vertices( edge_id );
+                if( edges_status[edge_id] == EDGE_STATUS::non_manifold )
+                {
+                    non_manifold_edges.add_issue( edge_vertices,
+                        absl::StrCat( "Non manifold edge between vertices ",
+                            edge_vertices[0], " and ", edge_vertices[1] ) );
+                }
+                else
+                {
+                    non_manifold_edges.add_issue( edge_vertices,
+                        absl::StrCat( "Could not check manifold on edge "
+                                      "between vertices with index ",
+                            edge_vertices[0], " and index ", edge_vertices[1],
+                            "; Check issues with solid adjacencies." ) );
                 }
             }
             return non_manifold_edges;
         }
 
+    private:
+        bool edge_is_manifold( index_t edge_id ) const
+        {
+            const auto polyhedra = edges_to_polyhedra_.polyhedra( edge_id );
+            auto polyhedra_around = mesh_.polyhedra_around_edge(
+                edges_to_polyhedra_.edge_vertices( edge_id ),
+                polyhedra.front() );
+            if( polyhedra_around.size() != polyhedra.size() )
+            {
+                return false;
+            }
+            absl::c_sort( polyhedra_around );
+            return absl::c_equal( polyhedra_around, polyhedra );
+        }
+
+        /*!
+         * Wrong edges sorted as they are first met when iterating on mesh
+         * polyhedra edges.
+         */
+        std::vector< index_t > wrong_edges_in_mesh_order(
+            absl::Span< const EDGE_STATUS > edges_status ) const
+        {
+            std::vector< std::pair< std::pair< index_t, index_t >, index_t > >
+                wrong_edges;
+            for( const auto edge_id : Indices{ edges_status } )
+            {
+                if( edges_status[edge_id] == EDGE_STATUS::manifold )
+                {
+                    continue;
+                }
+                const auto& edge_vertices =
+                    edges_to_polyhedra_.edge_vertices( edge_id );
+                const auto polyhedron_id =
+                    edges_to_polyhedra_.polyhedra( edge_id ).front();
+                const auto polyhedron_edges =
+                    mesh_.polyhedron_edges_vertices( polyhedron_id );
+                const auto edge_position = static_cast< index_t >(
+                    absl::c_find( polyhedron_edges, edge_vertices )
+                    - polyhedron_edges.begin() );
+                wrong_edges.emplace_back(
+                    std::make_pair( polyhedron_id, edge_position ), edge_id );
+            }
+            absl::c_sort( wrong_edges );
+            std::vector< index_t > sorted_edges;
+            sorted_edges.reserve( wrong_edges.size() );
+            for( const auto& wrong_edge : wrong_edges )
+            {
+                sorted_edges.push_back( wrong_edge.second );
+            }
+            return sorted_edges;
+        }
+
     private:
         const SolidMesh< dimension >& mesh_;
-        absl::flat_hash_map< Edge, std::vector< geode::index_t > >
-            polyhedra_around_edges_;
+        EdgesToPolyhedra edges_to_polyhedra_;
     };
 
     template < index_t dimension >
@@ -23,8 +23,13 @@
 
 #include <geode/inspector/inspection/criterion/manifold/solid_facet_manifold.hpp>
 
+#include <atomic>
+#include <numeric>
+
+#include <async++.h>
+
+#include <absl/algorithm/container.h>
 #include <absl/container/flat_hash_map.h>
-#include <absl/container/flat_hash_set.h>
 
 #include <geode/basic/logger.hpp>
 #include <geode/basic/pimpl_impl.hpp>
@@ -32,13 +37,108 @@
 #include <geode/mesh/core/detail/vertex_cycle.hpp>
 #include <geode/mesh/core/solid_mesh.hpp>
 
+#include <geode/inspector/inspection/criterion/internal/parallel_sort.hpp>
+
 namespace
 {
     using Facet = geode::detail::VertexCycle< geode::PolyhedronFacetVertices >;
 
+    /*!
+     * Fixed-width key of a triangular or quadrangular facet: the vertex
+     * cycle starting from its smallest vertex and oriented toward its
+     * smallest neighbor, padded with NO_ID.
+     */
+    using FacetKey = std::array< geode::index_t, 4 >;
+
+    constexpr geode::local_index_t MAX_PACKED_FACET_SIZE{ 4 };
+
+    const FacetKey UNPACKED_FACET_KEY{ geode::NO_ID, geode::NO_ID,
+        geode::NO_ID, geode::NO_ID };
+
+    FacetKey facet_key( const geode::PolyhedronFacetVertices& vertices )
+    {
+        auto key = UNPACKED_FACET_KEY;
+        const auto size = vertices.size();
+        const auto min_position = static_cast< std::size_t >(
+            absl::c_min_element( vertices ) - vertices.begin() );
+        const auto next = vertices[( min_position + 1 ) % size];
+        const auto previous = vertices[( min_position + size - 1 ) % size];
+        const auto step = next < previous ? 1 : size - 1;
+        for( const auto v : geode::LRange{ size } )
+        {
+            key[v] = vertices[( min_position + v * step ) % size];
+        }
+        return key;
+    }
+
+    geode::PolyhedronFacetVertices key_vertices( const FacetKey& key )
+    {
+        geode::PolyhedronFacetVertices vertices;
+        for( const auto vertex : key )
+        {
+            if( vertex == geode::NO_ID )
+            {
+                break;
+            }
+            vertices.push_back( vertex );
+        }
+        return vertices;
+    }
+
+    /*!
+     * Packed keys of all triangular and quadrangular facets, sorted.
+     * Facets with more vertices are flagged with UNPACKED_FACET_KEY and
+     * gathered at the end.
+     */
+    template < geode::index_t dimension >
+    std::vector< FacetKey > sorted_facet_keys(
+        const geode::SolidMesh< dimension >& mesh,
+        bool& has_unpacked_facets )
+    {
+        std::vector< geode::index_t > polyhedron_offsets(
+            mesh.nb_polyhedra() + 1, 0 );
+        async::parallel_for(
+            async::irange( geode::index_t{ 0 }, mesh.nb_polyhedra() ),
+            [&mesh, &polyhedron_offsets]( geode::index_t polyhedron_id ) {
+                polyhedron_offsets[polyhedron_id + 1] =
+                    mesh.nb_polyhedron_facets( polyhedron_id );
+            } );
+        std::partial_sum( polyhedron_offsets.begin(), polyhedron_offsets.end(),
+            polyhedron_offsets.begin() );
+        std::vector< FacetKey > facet_keys( polyhedron_offsets.back() );
+        std::atomic< bool > unpacked_facets_found{ false };
+        async::parallel_for(
+            async::irange( geode::index_t{ 0 }, mesh.nb_polyhedra() ),
+            [&mesh, &polyhedron_offsets, &facet_keys, &unpacked_facets_found](
+                geode::index_t polyhedron_id ) {
+                const auto offset = polyhedron_offsets[polyhedron_id];
+                const auto nb_facets =
+                    mesh.nb_polyhedron_facets( polyhedron_id );
+                for( const auto facet_id : geode::LRange{ nb_facets } )
+                {
+                    const auto facet_vertices = mesh.polyhedron_facet_vertices(
+                        { polyhedron_id, facet_id } );
+                    auto& key = facet_keys[offset + facet_id];
+                    if( facet_vertices.size() > MAX_PACKED_FACET_SIZE )
+                    {
+                        key = UNPACKED_FACET_KEY;
+                        unpacked_facets_found.store(
+                            true, std::memory_order_relaxed );
+                    }
+                    else
+                    {
+                        key = facet_key( facet_vertices );
+                    }
+                }
+            } );
+        has_unpacked_facets = unpacked_facets_found.load();
+        geode::internal::parallel_sort( facet_keys );
+        return facet_keys;
+    }
+
     template < geode::index_t dimension >
     absl::flat_hash_map< Facet, geode::index_t >
-        facets_to_nb_adjacent_polyhedra(
+        unpacked_facets_to_nb_adjacent_polyhedra(
             const geode::SolidMesh< dimension >& mesh )
     {
         absl::flat_hash_map< Facet, geode::index_t >
@@ -48,6 +148,12 @@ namespace
             for( const auto facet_id :
                 geode::LRange{ mesh.nb_polyhedron_facets( polyhedron_id ) } )
             {
+                if( mesh.nb_polyhedron_facet_vertices(
+                        { polyhedron_id, facet_id } )
+                    <= MAX_PACKED_FACET_SIZE )
+                {
+                    continue;
+                }
                 const Facet facet{ mesh.polyhedron_facet_vertices(
                     { polyhedron_id, facet_id } ) };
                 if( !nb_polyhedra_adjacent_to_facets.try_emplace( facet, 1 )
@@ -59,6 +165,48 @@ namespace
         }
         return nb_polyhedra_adjacent_to_facets;
     }
+
+    template < geode::index_t dimension >
+    std::vector< geode::PolyhedronFacetVertices >
+        facets_with_too_many_polyhedra(
+            const geode::SolidMesh< dimension >& mesh )
+    {
+        std::vector< geode::PolyhedronFacetVertices > non_manifold_facets;
+        bool has_unpacked_facets{ false };
+        const auto facet_keys =
+            sorted_facet_keys( mesh, has_unpacked_facets );
+        geode::index_t run_start{ 0 };
+        for( const auto entry : geode::Range{ 1, facet_keys.size() + 1 } )
+        {
+            if( entry < facet_keys.size()
+                && facet_keys[entry] == facet_keys[run_start] )
+            {
+                continue;
+            }
+            if( facet_keys[run_start] == UNPACKED_FACET_KEY )
+            {
+                break;
+            }
+            if( entry - run_start > 2 )
+            {
+                non_manifold_facets.push_back(
+                    key_vertices( facet_keys[run_start] ) );
+            }
+            run_start = entry;
+        }
+        if( has_unpacked_facets )
+        {
+            for( const auto& [facet, nb_adjacent_polyhedra] :
+                unpacked_facets_to_nb_adjacent_polyhedra( mesh ) )
+            {
+                if( nb_adjacent_polyhedra > 2 )
+                {
+                    non_manifold_facets.push_back( facet.vertices() );
+                }
+            }
+        }
+        return non_manifold_facets;
+    }
 } // namespace
 
 namespace geode
@@ -71,41 +219,24 @@ namespace geode
 
         bool mesh_facets_are_manifold() const
         {
-            const auto nb_polyhedra_adjacent_to_facets =
-                facets_to_nb_adjacent_polyhedra( mesh_ );
-            for( const auto& nb_adjacent_polyhedra :
-                nb_polyhedra_adjacent_to_facets )
-            {
-                if( nb_adjacent_polyhedra.second > 2 )
-                {
-                    return false;
-                }
-            }
-            return true;
+            return facets_with_too_many_polyhedra( mesh_ ).empty();
         }
 
         InspectionIssues< PolyhedronFacetVertices > non_manifold_facets() const
         {
-            const auto nb_polyhedra_adjacent_to_facets =
-                facets_to_nb_adjacent_polyhedra( mesh_ );
             InspectionIssues< PolyhedronFacetVertices > non_manifold_facets{
                 "non manifold facets"
             };
-            for( const auto& nb_adjacent_polyhedra :
-                nb_polyhedra_adjacent_to_facets )
+            for( const auto& facet_vertices :
+                facets_with_too_many_polyhedra( mesh_ ) )
             {
-                if( nb_adjacent_polyhedra.second > 2 )
+                std::string message{ "facet made of vertices with index " };
+                for( const auto vertex_id : facet_vertices )
                 {
-                    std::string message{ "facet made of vertices with index " };
-                    for( const auto vertex_id :
-                        nb_adjacent_polyhedra.first.vertices() )
-                    {
-                        absl::StrAppend( &message, vertex_id, ", " );
-                    }
-                    absl::StrAppend( &message, "is not manifold." );
-                    non_manifold_facets.add_issue(
-                        nb_adjacent_polyhedra.first.vertices(), message );
+                    absl::StrAppend( &message, vertex_id, ", " );
                 }
+                absl::StrAppend( &message, "is not manifold." );
+                non_manifold_facets.add_issue( facet_vertices, message );
             }
             return non_manifold_facets;
         }
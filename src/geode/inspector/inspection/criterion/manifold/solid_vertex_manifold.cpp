@@ -23,54 +23,13 @@
 
 #include <geode/inspector/inspection/criterion/manifold/solid_vertex_manifold.hpp>
 
-#include <absl/algorithm/container.h>
-
 #include <geode/basic/pimpl_impl.hpp>
 
 #include <geode/geometry/point.hpp>
 
 #include <geode/mesh/core/solid_mesh.hpp>
 
-namespace
-{
-    bool polyhedra_around_vertex_are_the_same(
-        const geode::PolyhedraAroundVertex& pav1,
-        const geode::PolyhedraAroundVertex& pav2 )
-    {
-        if( pav1.size() != pav2.size() )
-        {
-            return false;
-        }
-        for( const auto& polyhedron_vertex : pav1 )
-        {
-            if( absl::c_find( pav2, polyhedron_vertex ) == pav2.end() )
-            {
-                return false;
-            }
-        }
-        return true;
-    }
-
-    template < geode::index_t dimension >
-    std::vector< geode::PolyhedraAroundVertex > polyhedra_around_vertices(
-        const geode::SolidMesh< dimension >& mesh )
-    {
-        std::vector< geode::PolyhedraAroundVertex >
-            polyhedra_around_vertices_list( mesh.nb_vertices() );
-        for( const auto polyhedron_id : geode::Range{ mesh.nb_polyhedra() } )
-        {
-            for( const auto polyhedron_vertex_id :
-                geode::LRange{ mesh.nb_polyhedron_vertices( polyhedron_id ) } )
-            {
-                polyhedra_around_vertices_list[mesh.polyhedron_vertex(
-                                                   { polyhedron_id,
-                                                       polyhedron_vertex_id } )]
-                    .push_back( { polyhedron_id, polyhedron_vertex_id } );
-            }
-        }
-        return polyhedra_around_vertices_list;
-    }
-} // namespace
+#include <geode/inspector/inspection/criterion/internal/vertex_star_components.hpp>
 
 namespace geode
 {
@@ -82,37 +41,20 @@ namespace geode
 
         bool mesh_vertices_are_manifold() const
         {
-            const auto polyhedra_around_vertices_list =
-                polyhedra_around_vertices( mesh_ );
-            for( const auto vertex_id : geode::Range{ mesh_.nb_vertices() } )
-            {
-                if( !polyhedra_around_vertex_are_the_same(
-                        polyhedra_around_vertices_list[vertex_id],
-                        mesh_.polyhedra_around_vertex( vertex_id ) ) )
-                {
-                    return false;
-                }
-            }
-            return true;
+            return internal::vertices_with_disconnected_star( mesh_ ).empty();
         }
 
         InspectionIssues< index_t > non_manifold_vertices() const
         {
-            const auto polyhedra_around_vertices_list =
-                polyhedra_around_vertices( mesh_ );
             InspectionIssues< geode::index_t > non_manifold_vertices{
                 "non manifold vertices"
             };
-            for( const auto vertex_id : geode::Range{ mesh_.nb_vertices() } )
+            for( const auto vertex_id :
+                internal::vertices_with_disconnected_star( mesh_ ) )
             {
-                if( !polyhedra_around_vertex_are_the_same(
-                        polyhedra_around_vertices_list[vertex_id],
-                        mesh_.polyhedra_around_vertex( vertex_id ) ) )
-                {
-                    non_manifold_vertices.add_issue( vertex_id,
-                        absl::StrCat( "vertex ", vertex_id, ", at position [",
-                            mesh_.point( vertex_id ).string(), "]" ) );
-                }
+                non_manifold_vertices.add_issue( vertex_id,
+                    absl::StrCat( "vertex ", vertex_id, ", at position [",
+                        mesh_.point( vertex_id ).string(), "]" ) );
             }
             return non_manifold_vertices;
         }
@@ -23,53 +23,13 @@
 
 #include <geode/inspector/inspection/criterion/manifold/surface_vertex_manifold.hpp>
 
-#include <absl/algorithm/container.h>
-
 #include <geode/basic/pimpl_impl.hpp>
 
 #include <geode/geometry/point.hpp>
 
 #include <geode/mesh/core/surface_mesh.hpp>
 
-namespace
-{
-    bool polygons_around_vertex_are_the_same(
-        const geode::PolygonsAroundVertex& pav1,
-        const geode::PolygonsAroundVertex& pav2 )
-    {
-        if( pav1.size() != pav2.size() )
-        {
-            return false;
-        }
-        for( const auto& polygon_vertex : pav1 )
-        {
-            if( absl::c_find( pav2, polygon_vertex ) == pav2.end() )
-            {
-                return false;
-            }
-        }
-        return true;
-    }
-
-    template < geode::index_t dimension >
-    std::vector< geode::PolygonsAroundVertex > polygons_around_vertices(
-        const geode::SurfaceMesh< dimension >& mesh )
-    {
-        std::vector< geode::PolygonsAroundVertex > polygons_list(
-            mesh.nb_vertices() );
-        for( const auto polygon_id : geode::Range{ mesh.nb_polygons() } )
-        {
-            for( const auto polygon_vertex_id :
-                geode::LRange{ mesh.nb_polygon_vertices( polygon_id ) } )
-            {
-                polygons_list[mesh.polygon_vertex(
-                                  { polygon_id, polygon_vertex_id } )]
-                    .push_back( { polygon_id, polygon_vertex_id } );
-            }
-        }
-        return polygons_list;
-    }
-} // namespace
+#include <geode/inspector/inspection/criterion/internal/vertex_star_components.hpp>
 
 namespace geode
 {
@@ -81,52 +41,20 @@ namespace geode
 
         bool mesh_vertices_are_manifold() const
         {
-            const auto polygons_around_vertices_list =
-                polygons_around_vertices( mesh_ );
-            for( const auto vertex_id : geode::Range{ mesh_.nb_vertices() } )
-            {
-                try
-                {
-                    if( !polygons_around_vertex_are_the_same(
-                            polygons_around_vertices_list[vertex_id],
-                            mesh_.polygons_around_vertex( vertex_id ) ) )
-                    {
-                        return false;
-                    }
-                }
-                catch( const geode::OpenGeodeException& )
-                {
-                    continue;
-                }
-            }
-            return true;
+            return internal::vertices_with_disconnected_star( mesh_ ).empty();
         }
 
         InspectionIssues< index_t > non_manifold_vertices() const
         {
-            const auto polygons_around_vertices_list =
-                polygons_around_vertices( mesh_ );
             InspectionIssues< geode::index_t > non_manifold_vertices{
                 "non manifold vertices"
             };
-            for( const auto vertex_id : geode::Range{ mesh_.nb_vertices() } )
+            for( const auto vertex_id :
+                internal::vertices_with_disconnected_star( mesh_ ) )
             {
-                try
-                {
-                    if( !polygons_around_vertex_are_the_same(
-                            polygons_around_vertices_list[vertex_id],
-                            mesh_.polygons_around_vertex( vertex_id ) ) )
-                    {
-                        non_manifold_vertices.add_issue( vertex_id,
-                            absl::StrCat( "vertex ", vertex_id,
-                                ", at position [",
-                                mesh_.point( vertex_id ).string(), "]" ) );
-                    }
-                }
-                catch( const geode::OpenGeodeException& )
-                {
-                    continue;
-                }
+                non_manifold_vertices.add_issue( vertex_id,
+                    absl::StrCat( "vertex ", vertex_id, ", at position [",
+                        mesh_.point( vertex_id ).string(), "]" ) );
             }
             return non_manifold_vertices;
         }
@@ -25,6 +25,8 @@
 
 #include <async++.h>
 
+#include <geode/inspector/inspection/criterion/internal/model_unique_vertices.hpp>
+
 namespace geode
 {
     index_t SectionMeshesInspectionResult::nb_issues() const
@@ -33,6 +35,7 @@ namespace geode
                + meshes_colocation.nb_issues() + meshes_adjacencies.nb_issues()
                + meshes_degenerations.nb_issues()
                + meshes_intersections.nb_issues()
+               + lines_intersections.nb_issues()
                + meshes_non_manifolds.nb_issues()
                + meshes_negative_elements.nb_issues();
     }
@@ -42,7 +45,8 @@ namespace geode
         return absl::StrCat( unique_vertices_colocation.string(),
             meshes_colocation.string(), meshes_adjacencies.string(),
             meshes_degenerations.string(), meshes_intersections.string(),
-            meshes_non_manifolds.string(), meshes_negative_elements.string() );
+            lines_intersections.string(), meshes_non_manifolds.string(),
+            meshes_negative_elements.string() );
     }
 
     std::string SectionMeshesInspectionResult::inspection_type() const
@@ -57,12 +61,22 @@ namespace geode
           SectionComponentMeshesDegeneration( section ),
           SectionComponentMeshesManifold( section ),
           SectionComponentMeshesNegativeElements( section ),
-          SectionMeshesIntersections( section )
+          SectionMeshesIntersections( section ),
+          SectionLinesIntersections( section ),
+          section_( section )
     {
     }
 
     SectionMeshesInspectionResult
         SectionMeshesInspector::inspect_section_meshes() const
+    {
+        return inspect_section_meshes(
+            internal::ModelUniqueVertices{ section_ } );
+    }
+
+    SectionMeshesInspectionResult
+        SectionMeshesInspector::inspect_section_meshes(
+            const internal::ModelUniqueVertices& unique_vertices ) const
     {
         SectionMeshesInspectionResult result;
         async::parallel_invoke(
@@ -79,8 +93,13 @@ namespace geode
             [&result, this] {
                 result.meshes_degenerations = inspect_elements_degeneration();
             },
-            [&result, this] {
-                result.meshes_intersections = inspect_intersections();
+            [&result, &unique_vertices, this] {
+                result.meshes_intersections =
+                    inspect_intersections( unique_vertices );
+            },
+            [&result, &unique_vertices, this] {
+                result.lines_intersections =
+                    inspect_lines_intersections( unique_vertices );
             },
             [&result, this] {
                 result.meshes_non_manifolds = inspect_section_manifold();
@@ -27,6 +27,8 @@
 
 #include <geode/model/representation/core/section.hpp>
 
+#include <geode/inspector/inspection/criterion/internal/model_unique_vertices.hpp>
+
 namespace geode
 {
     index_t SectionInspectionResult::nb_issues() const
@@ -47,19 +49,21 @@ namespace geode
     SectionInspector::SectionInspector( const Section& section )
         : AddInspectors< Section,
               SectionMeshesInspector,
-              SectionTopologyInspector >{ section }
+              SectionTopologyInspector >{ section },
+          section_( section )
     {
     }
 
     SectionInspectionResult SectionInspector::inspect_section() const
     {
         SectionInspectionResult result;
+        const internal::ModelUniqueVertices unique_vertices{ section_ };
         async::parallel_invoke(
-            [&result, this] {
-                result.meshes = inspect_section_meshes();
+            [&result, &unique_vertices, this] {
+                result.meshes = inspect_section_meshes( unique_vertices );
             },
-            [&result, this] {
-                result.topology = inspect_section_topology();
+            [&result, &unique_vertices, this] {
+                result.topology = inspect_section_topology( unique_vertices );
             } );
         return result;
     }
@@ -31,14 +31,13 @@
 #include <geode/basic/algorithm.hpp>
 #include <geode/basic/attribute_manager.hpp>
 #include <geode/basic/logger.hpp>
+#include <geode/basic/mapping.hpp>
 
 #include <geode/geometry/aabb.hpp>
 #include <geode/geometry/bounding_box.hpp>
 #include <geode/geometry/point.hpp>
 
-#include <geode/mesh/builder/graph_builder.hpp>
 #include <geode/mesh/builder/polygonal_surface_builder.hpp>
-#include <geode/mesh/core/graph.hpp>
 #include <geode/mesh/core/polygonal_surface.hpp>
 #include <geode/mesh/core/solid_mesh.hpp>
 #include <geode/mesh/core/surface_edges.hpp>
@@ -55,21 +54,62 @@
 #include <geode/model/representation/core/brep.hpp>
 
 #include <geode/inspector/inspection/topology/internal/expected_nb_cmvs.hpp>
+#include <geode/inspector/inspection/topology/internal/model_relationships.hpp>
 #include <geode/inspector/inspection/topology/internal/topology_helpers.hpp>
+#include <geode/inspector/inspection/topology/internal/unique_vertices_topology.hpp>
 
 namespace
 {
+    constexpr auto BLOCK =
+        geode::internal::ModelRelationships::ComponentKind::block;
+
+    bool contains_component(
+        const std::vector< bool >& membership, geode::index_t component )
+    {
+        return component < membership.size() && membership[component];
+    }
+
+    std::vector< bool > components_membership(
+        const geode::internal::ModelRelationships& relationships,
+        absl::Span< const geode::index_t > components )
+    {
+        std::vector< bool > membership( relationships.nb_components(), false );
+        for( const auto component : components )
+        {
+            membership[component] = true;
+        }
+        return membership;
+    }
+
+    std::vector< geode::index_t > components_indices(
+        const geode::internal::ModelRelationships& relationships,
+        absl::Span< const geode::uuid > component_uuids )
+    {
+        std::vector< geode::index_t > components;
+        components.reserve( component_uuids.size() );
+        for( const auto& component_uuid : component_uuids )
+        {
+            const auto component =
+                relationships.component_index( component_uuid );
+            if( component != geode::NO_ID )
+            {
+                components.push_back( component );
+            }
+        }
+        return components;
+    }
+
     bool line_is_boundary_of_at_least_two_surfaces_or_one_embedding_surface(
-        const geode::BRep& brep,
-        const geode::uuid& line_uuid,
-        const std::vector< geode::uuid >& surface_uuids )
+        const geode::internal::ModelRelationships& relationships,
+        geode::index_t line,
+        absl::Span< const geode::index_t > surfaces )
     {
         geode::local_index_t counter{ 0 };
-        for( const auto& surface_id : surface_uuids )
+        for( const auto surface : surfaces )
         {
-            if( brep.Relationships::is_boundary( line_uuid, surface_id ) )
+            if( relationships.is_boundary( line, surface ) )
             {
-                if( brep.nb_embeddings( surface_id ) > 0 )
+                if( !relationships.embeddings( surface ).empty() )
                 {
                     return true;
                 }
@@ -84,15 +124,15 @@ namespace
     }
 
     bool is_line_incident_to_another_block_boundary_surface(
-        const geode::Line3D& line,
-        const geode::BRep& brep,
-        const geode::Block3D& block,
-        const geode::uuid& boundary_surface_id )
+        const geode::internal::ModelRelationships& relationships,
+        geode::index_t line,
+        geode::index_t block,
+        geode::index_t boundary_surface )
     {
-        for( const auto& incident_surface : brep.incidences( line ) )
+        for( const auto incident_surface : relationships.incidences( line ) )
         {
-            if( incident_surface.id() != boundary_surface_id
-                && brep.is_boundary( incident_surface, block ) )
+            if( incident_surface != boundary_surface
+                && relationships.is_boundary( incident_surface, block ) )
             {
                 return true;
             }
@@ -101,14 +141,14 @@ namespace
     }
 
     bool surface_boundaries_are_not_linked_to_another_block_boundary(
-        const geode::Surface3D& surface,
-        const geode::BRep& brep,
-        const geode::Block3D& block )
+        const geode::internal::ModelRelationships& relationships,
+        geode::index_t surface,
+        geode::index_t block )
     {
-        for( const auto& line : brep.boundaries( surface ) )
+        for( const auto line : relationships.boundaries( surface ) )
         {
             if( !is_line_incident_to_another_block_boundary_surface(
-                    line, brep, block, surface.id() ) )
+                    relationships, line, block, surface ) )
             {
                 return true;
             }
@@ -116,141 +156,72 @@ namespace
         return false;
     }
 
-    void create_graph( const geode::BRep& brep,
-        geode::GenericMapping< geode::uuid, geode::index_t >&
-            surface_uuids_to_graph_edges,
-        geode::BijectiveMapping< geode::uuid, geode::index_t >&
-            line_uuids_to_graph_vertices,
-        const geode::Graph& graph,
-        geode::GraphBuilder& graph_builder )
+    /*!
+     * Peels the Surfaces having a boundary Line which is boundary of no
+     * other remaining Surface, until every remaining Surface boundary Line
+     * is shared by at least two remaining Surfaces.
+     */
+    std::vector< geode::index_t > find_not_boundary_surfaces(
+        const geode::internal::ModelRelationships& relationships )
     {
-        for( const auto& line : brep.lines() )
+        std::vector< geode::index_t > not_boundaries_surfaces;
+        std::vector< geode::index_t > nb_remaining_incidences(
+            relationships.nb_components(), 0 );
+        std::vector< bool > is_peeled( relationships.nb_components(), false );
+        std::queue< geode::index_t > lines_to_process;
+        for( const auto line : relationships.components(
+                 geode::internal::ModelRelationships::ComponentKind::line ) )
         {
-            line_uuids_to_graph_vertices.map(
-                line.id(), graph_builder.create_vertex() );
-        }
-        for( const auto& line : brep.lines() )
-        {
-            const auto line_vertex =
-                line_uuids_to_graph_vertices.in2out( line.id() );
-            for( const auto& incident_surface : brep.incidences( line ) )
+            nb_remaining_incidences[line] =
+                relationships.incidences( line ).size();
+            if( nb_remaining_incidences[line] == 1 )
             {
-                for( const auto& boundary_line :
-                    brep.boundaries( incident_surface ) )
-                {
-                    const auto boundary_line_vertex =
-                        line_uuids_to_graph_vertices.in2out(
-                            boundary_line.id() );
-                    if( const auto existing_edge = graph.edge_from_vertices(
-                            boundary_line_vertex, line_vertex ) )
-                    {
-                        if( surface_uuids_to_graph_edges
-                                .out2in( existing_edge.value() )
-                                .at( 0 )
-                            == incident_surface.id() )
-                        {
-                            continue;
-                        }
-                    }
-                    surface_uuids_to_graph_edges.map( incident_surface.id(),
-                        graph_builder.create_edge(
-                            boundary_line_vertex, line_vertex ) );
-                }
+                lines_to_process.push( line );
             }
         }
-    }
-
-    std::vector< geode::uuid > find_not_boundary_surfaces(
-        const geode::BRep& brep )
-    {
-        std::vector< geode::uuid > not_boundaries_surfaces;
-        geode::GenericMapping< geode::uuid, geode::index_t >
-            surface_uuids_to_graph_edges;
-        geode::BijectiveMapping< geode::uuid, geode::index_t >
-            line_uuids_to_graph_vertices;
-        auto graph = geode::Graph::create();
-        auto graph_builder = geode::GraphBuilder::create( *graph );
-        create_graph( brep, surface_uuids_to_graph_edges,
-            line_uuids_to_graph_vertices, *graph, *graph_builder );
-        bool found_not_boundary_surface{ true };
-        while( found_not_boundary_surface )
+        while( !lines_to_process.empty() )
         {
-            std::vector< bool > to_delete( graph->nb_edges(), false );
-            for( const auto graph_vertex :
-                geode::Range{ graph->nb_vertices() } )
+            const auto line = lines_to_process.front();
+            lines_to_process.pop();
+            if( nb_remaining_incidences[line] != 1 )
             {
-                if( graph->edges_around_vertex( graph_vertex ).empty() )
-                {
-                    continue;
-                }
-                const auto surface_id =
-                    surface_uuids_to_graph_edges
-                        .out2in( graph->edges_around_vertex( graph_vertex )
-                                .at( 0 )
-                                .edge_id )
-                        .at( 0 );
-                bool should_delete{ true };
-                for( const auto& edge_around :
-                    graph->edges_around_vertex( graph_vertex ) )
-                {
-                    if( surface_uuids_to_graph_edges
-                            .out2in( edge_around.edge_id )
-                            .at( 0 )
-                        != surface_id )
-                    {
-                        should_delete = false;
-                        break;
-                    }
-                }
-                if( !should_delete )
-                {
-                    continue;
-                }
-                if( absl::c_contains( not_boundaries_surfaces, surface_id ) )
-                {
-                    continue;
-                }
-                for( const auto& edge :
-                    surface_uuids_to_graph_edges.in2out( surface_id ) )
-                {
-                    to_delete[edge] = true;
-                }
-                not_boundaries_surfaces.push_back( surface_id );
-            }
-            if( !absl::c_contains( to_delete, true ) )
-            {
-                found_not_boundary_surface = false;
                 continue;
             }
-            const auto old2new = graph_builder->delete_edges( to_delete );
-            geode::GenericMapping< geode::uuid, geode::index_t >
-                new_surface_uuids_to_graph_edges;
-            for( const auto& [surface_id, graph_edges] :
-                surface_uuids_to_graph_edges.in2out_map() )
+            for( const auto surface : relationships.incidences( line ) )
             {
-                for( const auto graph_edge : graph_edges )
+                if( is_peeled[surface] )
                 {
-                    if( old2new.at( graph_edge ) != geode::NO_ID )
+                    continue;
+                }
+                is_peeled[surface] = true;
+                not_boundaries_surfaces.push_back( surface );
+                for( const auto boundary_line :
+                    relationships.boundaries( surface ) )
+                {
+                    nb_remaining_incidences[boundary_line]--;
+                    if( nb_remaining_incidences[boundary_line] == 1 )
                     {
-                        new_surface_uuids_to_graph_edges.map(
-                            surface_id, old2new.at( graph_edge ) );
+                        lines_to_process.push( boundary_line );
                     }
                 }
+                break;
             }
-            surface_uuids_to_graph_edges = new_surface_uuids_to_graph_edges;
-            graph_builder->delete_isolated_vertices();
         }
         return not_boundaries_surfaces;
     }
 
-    std::vector< geode::uuid > find_dangling_surfaces( const geode::BRep& brep,
-        absl::Span< const geode::uuid > not_boundary_surfaces )
+    std::vector< geode::index_t > find_dangling_surfaces(
+        const geode::BRep& brep,
+        const geode::internal::ModelRelationships& relationships,
+        absl::Span< const geode::index_t > not_boundary_surfaces )
     {
-        std::vector< geode::uuid > dangling_surfaces;
+        std::vector< geode::index_t > dangling_surfaces;
         geode::BRepRayTracing ray_tracing{ brep };
-        for( const auto& surface_id : not_boundary_surfaces )
+        for( const auto surface : not_boundary_surfaces )
         {
-            const auto& surface_mesh = brep.surface( surface_id ).mesh();
+            const auto& surface_mesh =
+                brep.surface( relationships.component_id( surface ).id() )
+                    .mesh();
             if( surface_mesh.nb_polygons() == 0 )
             {
                 continue;
@@ -269,22 +240,22 @@ namespace
             }
             if( is_dangling )
             {
-                dangling_surfaces.push_back( surface_id );
+                dangling_surfaces.push_back( surface );
             }
         }
         return dangling_surfaces;
     }
 
-    bool find_linked_processed_surface( const geode::BRep& brep,
-        const geode::uuid& surface_uuid,
-        absl::Span< const geode::uuid > processed )
+    bool find_linked_processed_surface(
+        const geode::internal::ModelRelationships& relationships,
+        geode::index_t surface,
+        absl::Span< const geode::index_t > processed )
     {
-        const auto& surface = brep.surface( surface_uuid );
-        for( const auto& line : brep.boundaries( surface ) )
+        for( const auto line : relationships.boundaries( surface ) )
         {
-            for( const auto& other_surface : brep.incidences( line ) )
+            for( const auto other_surface : relationships.incidences( line ) )
             {
-                if( absl::c_contains( processed, other_surface.id() ) )
+                if( absl::c_linear_search( processed, other_surface ) )
                 {
                     return true;
                 }
@@ -293,13 +264,14 @@ namespace
         return false;
     }
 
-    std::vector< geode::uuid > closed_linked_surfaces(
-        const geode::BRep& brep, std::queue< geode::uuid >& to_process )
+    std::vector< geode::index_t > closed_linked_surfaces(
+        const geode::internal::ModelRelationships& relationships,
+        std::queue< geode::index_t >& to_process )
     {
-        std::vector< geode::uuid > processed;
-        const auto first_surface_uuid = to_process.front();
+        std::vector< geode::index_t > processed;
+        const auto first_surface = to_process.front();
         to_process.pop();
-        processed.emplace_back( first_surface_uuid );
+        processed.emplace_back( first_surface );
         geode::index_t skip_counter{ 0 };
         while( !to_process.empty() )
         {
@@ -307,72 +279,82 @@ namespace
             {
                 return processed;
             }
-            const auto surface_uuid = to_process.front();
+            const auto surface = to_process.front();
             to_process.pop();
-            if( absl::c_contains( processed, surface_uuid ) )
+            if( absl::c_linear_search( processed, surface ) )
             {
                 continue;
             }
-            if( find_linked_processed_surface( brep, surface_uuid, processed ) )
+            if( find_linked_processed_surface(
+                    relationships, surface, processed ) )
             {
-                processed.emplace_back( surface_uuid );
+                processed.emplace_back( surface );
                 skip_counter = 0;
             }
             else
             {
-                to_process.emplace( surface_uuid );
+                to_process.emplace( surface );
                 skip_counter++;
             }
         }
         return processed;
     }
 
-    std::queue< geode::uuid > queue_with_block_boundaries(
-        const geode::BRep& brep, const geode::Block3D& block )
+    std::queue< geode::index_t > queue_with_block_boundaries(
+        const geode::internal::ModelRelationships& relationships,
+        geode::index_t block )
     {
-        std::queue< geode::uuid > to_process;
-        for( const auto& surface : brep.boundaries( block ) )
+        std::queue< geode::index_t > to_process;
+        for( const auto surface : relationships.boundaries( block ) )
         {
-            to_process.emplace( surface.id() );
+            to_process.emplace( surface );
         }
         return to_process;
     }
 
-    std::queue< geode::uuid > queue_with_model_boundaries(
-        const geode::BRep& brep )
+    std::queue< geode::index_t > queue_with_model_boundaries(
+        const geode::BRep& brep,
+        const geode::internal::ModelRelationships& relationships )
     {
-        std::queue< geode::uuid > to_process;
+        std::queue< geode::index_t > to_process;
         for( const auto& model_boundary : brep.model_boundaries() )
         {
             for( const auto& surface :
                 brep.model_boundary_items( model_boundary ) )
             {
-                to_process.emplace( surface.id() );
+                to_process.emplace(
+                    relationships.component_index( surface.id() ) );
             }
         }
         return to_process;
     }
 
-    geode::BoundingBox3D surface_list_box(
-        const geode::BRep& brep, absl::Span< const geode::uuid > surface_list )
+    geode::BoundingBox3D surface_list_box( const geode::BRep& brep,
+        const geode::internal::ModelRelationships& relationships,
+        absl::Span< const geode::index_t > surface_list )
     {
         geode::BoundingBox3D result;
-        for( const auto& surface_id : surface_list )
+        for( const auto surface : surface_list )
         {
-            result.add_box( brep.surface( surface_id ).mesh().bounding_box() );
+            result.add_box(
+                brep.surface( relationships.component_id( surface ).id() )
+                    .mesh()
+                    .bounding_box() );
         }
         return result;
     }
 
     std::optional< geode::index_t > enclosing_surface_list(
         const geode::BRep& brep,
-        const std::vector< std::vector< geode::uuid > >& linked_surfaces_list )
+        const geode::internal::ModelRelationships& relationships,
+        const std::vector< std::vector< geode::index_t > >&
+            linked_surfaces_list )
     {
         std::vector< geode::BoundingBox3D > bounding_boxes;
         for( const auto& surface_list : linked_surfaces_list )
         {
             bounding_boxes.emplace_back(
-                surface_list_box( brep, surface_list ) );
+                surface_list_box( brep, relationships, surface_list ) );
         }
         for( const auto first_surface_list_id :
             geode::Indices{ linked_surfaces_list } )
@@ -399,17 +381,22 @@ namespace
 
     std::unique_ptr< geode::PolygonalSurface3D > fuse_brep_surfaces_from_list(
         const geode::BRep& brep,
-        const std::vector< geode::uuid >& surface_list )
+        const geode::internal::ModelUniqueVertices& unique_vertices,
+        const geode::internal::ModelRelationships& relationships,
+        absl::Span< const geode::index_t > surface_list )
     {
         auto polygonal_surface = geode::PolygonalSurface3D::create();
         auto polygonal_surface_builder =
             geode::PolygonalSurfaceBuilder3D::create( *polygonal_surface );
         geode::BijectiveMapping< geode::index_t, geode::index_t >
             unique_vertices_to_polygonal_surface_vertices;
-        for( const auto& surface_id : surface_list )
+        for( const auto surface : surface_list )
         {
-            const auto& surface = brep.surface( surface_id );
-            const auto& surface_mesh = surface.mesh();
+            const auto& surface_id = relationships.component_id( surface ).id();
+            const auto& surface_mesh = brep.surface( surface_id ).mesh();
+            const auto surface_unique_vertices =
+                unique_vertices.component_unique_vertices(
+                    unique_vertices.component_index( surface_id ) );
             for( const auto polygon :
                 geode::Range{ surface_mesh.nb_polygons() } )
             {
@@ -417,8 +404,8 @@ namespace
                     surface_mesh.polygon_vertices( polygon );
                 for( auto& polygon_vertex : polygon_vertices )
                 {
-                    const auto unique_vertex = brep.unique_vertex(
-                        { surface.component_id(), polygon_vertex } );
+                    const auto unique_vertex =
+                        surface_unique_vertices[polygon_vertex];
                     if( !unique_vertices_to_polygonal_surface_vertices
                             .has_mapping_input( unique_vertex ) )
                     {
@@ -443,28 +430,32 @@ namespace
         return polygonal_surface;
     }
 
-    bool block_boundaries_are_closed(
-        const geode::BRep& brep, const geode::Block3D& block )
+    bool block_boundaries_are_closed( const geode::BRep& brep,
+        const geode::internal::ModelUniqueVertices& unique_vertices,
+        const geode::internal::ModelRelationships& relationships,
+        geode::index_t block )
     {
-        auto to_process = queue_with_block_boundaries( brep, block );
-        std::vector< std::vector< geode::uuid > > linked_boundary_parts;
+        auto to_process = queue_with_block_boundaries( relationships, block );
+        std::vector< std::vector< geode::index_t > > linked_boundary_parts;
         while( !to_process.empty() )
         {
             linked_boundary_parts.emplace_back(
-                closed_linked_surfaces( brep, to_process ) );
+                closed_linked_surfaces( relationships, to_process ) );
         }
         if( linked_boundary_parts.size() < 2 )
         {
             return true;
         }
         const auto enclosing_surface_index =
-            enclosing_surface_list( brep, linked_boundary_parts );
+            enclosing_surface_list(
+                brep, relationships, linked_boundary_parts );
         if( !enclosing_surface_index )
         {
             return false;
         }
-        const auto enclosing_surface_mesh = fuse_brep_surfaces_from_list(
-            brep, linked_boundary_parts[enclosing_surface_index.value()] );
+        const auto enclosing_surface_mesh = fuse_brep_surfaces_from_list( brep,
+            unique_vertices, relationships,
+            linked_boundary_parts[enclosing_surface_index.value()] );
         const auto enclosing_surface_aabb =
             geode::create_aabb_tree( *enclosing_surface_mesh );
         for( const auto surface_list_id :
@@ -474,10 +465,11 @@ namespace
             {
                 continue;
             }
-            for( const auto& surface_id :
-                linked_boundary_parts[surface_list_id] )
+            for( const auto surface : linked_boundary_parts[surface_list_id] )
             {
-                const auto& surface_mesh = brep.surface( surface_id ).mesh();
+                const auto& surface_mesh =
+                    brep.surface( relationships.component_id( surface ).id() )
+                        .mesh();
                 for( const auto vertex_id :
                     geode::Range{ surface_mesh.nb_vertices() } )
                 {
@@ -501,11 +493,12 @@ namespace
         return true;
     }
 
-    bool brep_boundaries_are_closed( const geode::BRep& brep )
+    bool brep_boundaries_are_closed( const geode::BRep& brep,
+        const geode::internal::ModelRelationships& relationships )
     {
-        auto to_process = queue_with_model_boundaries( brep );
+        auto to_process = queue_with_model_boundaries( brep, relationships );
         auto compute_closed_linked_surfaces =
-            closed_linked_surfaces( brep, to_process );
+            closed_linked_surfaces( relationships, to_process );
         return to_process.empty();
     }
 } // namespace
@@ -608,13 +601,38 @@ namespace geode
     {
     }
 
+    BRepBlocksTopology::~BRepBlocksTopology() = default;
+
+    const internal::ModelRelationships&
+        BRepBlocksTopology::relationships_snapshot() const
+    {
+        std::call_once( relationships_flag_, [this] {
+            relationships_ =
+                std::make_unique< internal::ModelRelationships >( brep_ );
+        } );
+        return *relationships_;
+    }
+
     bool BRepBlocksTopology::brep_blocks_topology_is_valid(
         index_t unique_vertex_index ) const
+    {
+        const auto& relationships = relationships_snapshot();
+        return brep_blocks_topology_is_valid( unique_vertex_index,
+            relationships,
+            internal::vertex_cmvs_by_component(
+                brep_, relationships, unique_vertex_index ) );
+    }
+
+    bool BRepBlocksTopology::brep_blocks_topology_is_valid(
+        index_t unique_vertex_index,
+        const internal::ModelRelationships& relationships,
+        const internal::VertexCMVsByComponent& unique_vertex_cmvs ) const
     {
         return !( unique_vertex_is_part_of_two_blocks_and_no_boundary_surface(
-                      unique_vertex_index )
+                      unique_vertex_index, relationships, unique_vertex_cmvs )
                   || unique_vertex_block_cmvs_count_is_incorrect(
-                      unique_vertex_index ) );
+                      unique_vertex_index, relationships,
+                      unique_vertex_cmvs ) );
     }
 
     bool BRepBlocksTopology::block_is_meshed( const Block3D& block ) const
@@ -635,49 +653,49 @@ namespace geode
         unique_vertex_is_part_of_two_blocks_and_no_boundary_surface(
             index_t unique_vertex_index ) const
     {
-        const auto block_uuids = internal::components_uuids(
-            brep_, unique_vertex_index, Block3D::component_type_static() );
-        if( block_uuids.size() != 2 )
+        const auto& relationships = relationships_snapshot();
+        return unique_vertex_is_part_of_two_blocks_and_no_boundary_surface(
+            unique_vertex_index, relationships,
+            internal::vertex_cmvs_by_component(
+                brep_, relationships, unique_vertex_index ) );
+    }
+
+    std::optional< std::string > BRepBlocksTopology::
+        unique_vertex_is_part_of_two_blocks_and_no_boundary_surface(
+            index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::VertexCMVsByComponent& unique_vertex_cmvs ) const
+    {
+        const auto blocks =
+            internal::unique_components( unique_vertex_cmvs.blocks );
+        if( blocks.size() != 2 )
         {
             return std::nullopt;
         }
-        for( const auto& block_uuid : block_uuids )
+        for( const auto block : blocks )
         {
-            if( !brep_.block( block_uuid ).is_active() )
+            if( !relationships.is_active( block ) )
             {
                 return std::nullopt;
             }
         }
-        for( const auto& surface_cmv :
-            brep_.component_mesh_vertices( unique_vertex_index ) )
+        for( const auto surface : unique_vertex_cmvs.surfaces )
         {
-            if( surface_cmv.component_id.type()
-                != Surface3D::component_type_static() )
+            const auto is_boundary_of_first_block =
+                relationships.is_boundary( surface, blocks[0] );
+            const auto is_boundary_of_second_block =
+                relationships.is_boundary( surface, blocks[1] );
+            if( is_boundary_of_first_block && is_boundary_of_second_block )
             {
-                continue;
+                return std::nullopt;
             }
-            if( brep_.Relationships::is_boundary(
-                    surface_cmv.component_id.id(), block_uuids[0] )
-                && brep_.Relationships::is_boundary(
-                    surface_cmv.component_id.id(), block_uuids[1] ) )
+            if( !is_boundary_of_first_block && !is_boundary_of_second_block )
             {
-                return std::nullopt;
+                continue;
             }
-            for( const auto& line_cmv :
-                brep_.component_mesh_vertices( unique_vertex_index ) )
+            for( const auto line : unique_vertex_cmvs.lines )
             {
-                if( line_cmv.component_id.type()
-                    != Line3D::component_type_static() )
-                {
-                    continue;
-                }
-                if( brep_.Relationships::is_boundary(
-                        line_cmv.component_id.id(),
-                        surface_cmv.component_id.id() )
-                    && ( brep_.Relationships::is_boundary(
-                             surface_cmv.component_id.id(), block_uuids[0] )
-                         || brep_.Relationships::is_boundary(
-                             surface_cmv.component_id.id(), block_uuids[1] ) ) )
+                if( relationships.is_boundary( line, surface ) )
                 {
                     return std::nullopt;
                 }
@@ -693,18 +711,29 @@ namespace geode
         BRepBlocksTopology::unique_vertex_block_cmvs_count_is_incorrect(
             index_t unique_vertex_index ) const
     {
-        const auto block_uuids = internal::components_uuids(
-            brep_, unique_vertex_index, Block3D::component_type_static() );
-        const auto component_cmvs =
-            internal::vertex_cmvs_by_component( brep_, unique_vertex_index );
-        for( const auto& block_uuid : block_uuids )
+        const auto& relationships = relationships_snapshot();
+        return unique_vertex_block_cmvs_count_is_incorrect( unique_vertex_index,
+            relationships,
+            internal::vertex_cmvs_by_component(
+                brep_, relationships, unique_vertex_index ) );
+    }
+
+    std::optional< std::string >
+        BRepBlocksTopology::unique_vertex_block_cmvs_count_is_incorrect(
+            index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::VertexCMVsByComponent& unique_vertex_cmvs ) const
+    {
+        for( const auto block :
+            internal::unique_components( unique_vertex_cmvs.blocks ) )
         {
-            if( !brep_.block( block_uuid ).is_active() )
+            if( !relationships.is_active( block ) )
             {
                 continue;
             }
             if( auto error_message = internal::wrong_nb_expected_block_cmvs(
-                    brep_, unique_vertex_index, block_uuid, component_cmvs ) )
+                    brep_, relationships, unique_vertex_index, block,
+                    unique_vertex_cmvs ) )
             {
                 return error_message;
             }
@@ -718,51 +747,66 @@ namespace geode
             absl::Span< const uuid > not_boundary_surfaces,
             absl::Span< const uuid > dangling_surface ) const
     {
-        for( const auto& cmv :
-            brep_.component_mesh_vertices( unique_vertex_index ) )
+        const auto& relationships = relationships_snapshot();
+        return vertex_is_part_of_surface_with_wrong_relationships_to_block(
+            unique_vertex_index, relationships,
+            internal::vertex_cmvs_by_component(
+                brep_, relationships, unique_vertex_index ),
+            make_blocks_topology_context(
+                relationships, not_boundary_surfaces, dangling_surface ) );
+    }
+
+    std::optional< std::string > BRepBlocksTopology::
+        vertex_is_part_of_surface_with_wrong_relationships_to_block(
+            index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::VertexCMVsByComponent& unique_vertex_cmvs,
+            const internal::BRepBlocksTopologyContext& context ) const
+    {
+        for( const auto surface : unique_vertex_cmvs.surfaces )
         {
-            if( cmv.component_id.type() != Surface3D::component_type_static()
-                || !brep_.surface( cmv.component_id.id() ).is_active() )
+            if( !relationships.is_active( surface ) )
             {
                 continue;
             }
-            if( brep_.nb_incidences( cmv.component_id.id() ) >= 1
-                && absl::c_contains(
-                    not_boundary_surfaces, cmv.component_id.id() ) )
+            const auto nb_incidences =
+                relationships.incidences( surface ).size();
+            const auto nb_embeddings =
+                relationships.embeddings( surface ).size();
+            const auto is_not_boundary_surface =
+                contains_component( context.is_not_boundary_surface, surface );
+            const auto is_dangling_surface =
+                contains_component( context.is_dangling_surface, surface );
+            const auto& surface_id = relationships.component_id( surface ).id();
+            if( nb_incidences >= 1 && is_not_boundary_surface )
             {
                 return absl::StrCat( "unique vertex with index ",
                     unique_vertex_index, " is part of Surface ",
-                    brep_.surface( cmv.component_id.id() )
+                    brep_.surface( surface_id )
                         .name()
-                        .value_or( cmv.component_id.id().string() ),
-                    " (", cmv.component_id.id().string(),
+                        .value_or( surface_id.string() ),
+                    " (", surface_id.string(),
                     "), which should not be boundary of any Block." );
             }
-            if( brep_.nb_embeddings( cmv.component_id.id() ) >= 1
-                && brep_.nb_incidences( cmv.component_id.id() ) < 1
-                && !absl::c_contains(
-                    not_boundary_surfaces, cmv.component_id.id() )
-                && absl::c_contains( dangling_surface, cmv.component_id.id() ) )
+            if( nb_embeddings >= 1 && nb_incidences < 1
+                && !is_not_boundary_surface && is_dangling_surface )
             {
                 return absl::StrCat( "unique vertex ", unique_vertex_index,
                     " is part of Surface ",
-                    brep_.surface( cmv.component_id.id() )
+                    brep_.surface( surface_id )
                         .name()
-                        .value_or( cmv.component_id.id().string() ),
-                    " (", cmv.component_id.id().string(),
+                        .value_or( surface_id.string() ),
+                    " (", surface_id.string(),
                     "), which should not be embedded in any Block." );
             }
-            if( brep_.nb_incidences( cmv.component_id.id() ) < 1
-                && brep_.nb_embeddings( cmv.component_id.id() ) < 1
-                && !absl::c_contains(
-                    dangling_surface, cmv.component_id.id() ) )
+            if( nb_incidences < 1 && nb_embeddings < 1 && !is_dangling_surface )
             {
                 return absl::StrCat( "unique vertex ", unique_vertex_index,
                     " is part of Surface ",
-                    brep_.surface( cmv.component_id.id() )
+                    brep_.surface( surface_id )
                         .name()
-                        .value_or( cmv.component_id.id().string() ),
-                    " (", cmv.component_id.id().string(),
+                        .value_or( surface_id.string() ),
+                    " (", surface_id.string(),
                     "), which is not internal to "
                     "a Block while it should be." );
             }
@@ -775,38 +819,56 @@ namespace geode
             index_t unique_vertex_index,
             absl::Span< const uuid > not_boundary_surfaces ) const
     {
-        const auto surface_uuids = internal::components_uuids(
-            brep_, unique_vertex_index, Surface3D::component_type_static() );
-        if( surface_uuids.size() != 1
-            || !brep_.surface( surface_uuids[0] ).is_active() )
+        const auto& relationships = relationships_snapshot();
+        return vertex_is_part_of_invalid_single_surface( unique_vertex_index,
+            relationships,
+            internal::vertex_cmvs_by_component(
+                brep_, relationships, unique_vertex_index ),
+            make_blocks_topology_context(
+                relationships, not_boundary_surfaces, {} ) );
+    }
+
+    std::optional< std::string >
+        BRepBlocksTopology::vertex_is_part_of_invalid_single_surface(
+            index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::VertexCMVsByComponent& unique_vertex_cmvs,
+            const internal::BRepBlocksTopologyContext& context ) const
+    {
+        const auto surfaces =
+            internal::unique_components( unique_vertex_cmvs.surfaces );
+        if( surfaces.size() != 1 )
         {
             return std::nullopt;
         }
-        const auto& surface_id = surface_uuids[0];
-        const auto block_uuids = internal::components_uuids(
-            brep_, unique_vertex_index, Block3D::component_type_static() );
-        if( absl::c_contains( not_boundary_surfaces, surface_id ) )
+        const auto surface = surfaces[0];
+        if( !relationships.is_active( surface ) )
         {
             return std::nullopt;
         }
-        if( block_uuids.size() > 2 )
+        if( contains_component( context.is_not_boundary_surface, surface ) )
+        {
+            return std::nullopt;
+        }
+        const auto blocks =
+            internal::unique_components( unique_vertex_cmvs.blocks );
+        if( blocks.size() > 2 )
         {
             return absl::StrCat( "unique vertex ", unique_vertex_index,
                 " is part of only one Surface, but is part of more "
                 "than two Blocks." );
         }
-        if( brep_.nb_embeddings( surface_id ) > 0 )
+        if( !relationships.embeddings( surface ).empty() )
         {
-            if( internal::brep_blocks_are_meshed( brep_ ) )
+            if( relationships.are_meshed( BLOCK ) )
             {
-                if( block_uuids.size() != 1 )
+                if( blocks.size() != 1 )
                 {
                     return absl::StrCat( "unique vertex ", unique_vertex_index,
                         " is part of only one Surface, which is "
                         "embedded, but not part of only one Block." );
                 }
-                else if( !brep_.Relationships::is_internal(
-                             surface_id, block_uuids[0] ) )
+                else if( !relationships.is_internal( surface, blocks[0] ) )
                 {
                     return absl::StrCat( "unique vertex ", unique_vertex_index,
                         " is part of only one Surface, which is "
@@ -817,10 +879,14 @@ namespace geode
         }
         else
         {
-            for( const auto& block_id : block_uuids )
+            for( const auto block : blocks )
             {
-                if( !brep_.Relationships::is_boundary( surface_id, block_id ) )
+                if( !relationships.is_boundary( surface, block ) )
                 {
+                    const auto& surface_id =
+                        relationships.component_id( surface ).id();
+                    const auto& block_id =
+                        relationships.component_id( block ).id();
                     return absl::StrCat( "unique vertex ", unique_vertex_index,
                         " is part of only one Surface",
                         brep_.surface( surface_id )
@@ -829,9 +895,8 @@ namespace geode
                         " (", surface_id.string(),
                         ") which is not embedded, but not boundary "
                         "either of Block ",
-                        brep_.block( block_id )
-                            .name()
-                            .value_or( block_id.string() ),
+                        brep_.block( block_id ).name().value_or(
+                            block_id.string() ),
                         " (", block_id.string(), "), in which the vertex is." );
                 }
             }
@@ -843,52 +908,63 @@ namespace geode
         BRepBlocksTopology::vertex_is_part_of_invalid_multiple_surfaces(
             index_t unique_vertex_index ) const
     {
-        const auto line_uuids = internal::components_uuids(
-            brep_, unique_vertex_index, Line3D::component_type_static() );
-        if( line_uuids.size() < 2 )
+        const auto& relationships = relationships_snapshot();
+        return vertex_is_part_of_invalid_multiple_surfaces( unique_vertex_index,
+            relationships,
+            internal::vertex_cmvs_by_component(
+                brep_, relationships, unique_vertex_index ) );
+    }
+
+    std::optional< std::string >
+        BRepBlocksTopology::vertex_is_part_of_invalid_multiple_surfaces(
+            index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::VertexCMVsByComponent& unique_vertex_cmvs ) const
+    {
+        const auto lines =
+            internal::unique_components( unique_vertex_cmvs.lines );
+        if( lines.size() < 2 )
         {
             return std::nullopt;
         }
-        const auto surface_uuids = internal::components_uuids(
-            brep_, unique_vertex_index, Surface3D::component_type_static() );
-        if( surface_uuids.size() < 2 )
+        const auto surfaces =
+            internal::unique_components( unique_vertex_cmvs.surfaces );
+        if( surfaces.size() < 2 )
         {
             return std::nullopt;
         }
-        std::vector< uuid > not_dangling_surfaces;
-        for( const auto& surface_uuid : surface_uuids )
+        std::vector< index_t > not_dangling_surfaces;
+        for( const auto surface : surfaces )
         {
-            if( brep_.nb_incidences( surface_uuid ) < 1
-                && brep_.nb_embeddings( surface_uuid ) < 1 )
+            if( relationships.incidences( surface ).empty()
+                && relationships.embeddings( surface ).empty() )
             {
                 continue;
             }
-            not_dangling_surfaces.push_back( surface_uuid );
+            not_dangling_surfaces.push_back( surface );
         }
         if( not_dangling_surfaces.size() < 2 )
         {
             return std::nullopt;
         }
-        for( const auto& line_id : line_uuids )
+        for( const auto line : lines )
         {
             bool line_has_relations_with_all_surfaces{ true };
-            for( const auto& surface_id : not_dangling_surfaces )
+            for( const auto surface : not_dangling_surfaces )
             {
-                if( !brep_.Relationships::is_internal( line_id, surface_id )
-                    && !brep_.Relationships::is_boundary(
-                        line_id, surface_id ) )
+                if( !relationships.is_internal( line, surface )
+                    && !relationships.is_boundary( line, surface ) )
                 {
                     line_has_relations_with_all_surfaces = false;
                     break;
                 }
             }
-            if( brep_.nb_embeddings( line_id ) < 1
+            if( relationships.embeddings( line ).empty()
                 && !line_is_boundary_of_at_least_two_surfaces_or_one_embedding_surface(
-                    brep_, line_id, not_dangling_surfaces )
+                    relationships, line, not_dangling_surfaces )
                 && line_has_relations_with_all_surfaces )
             {
-                const auto cmv =
-                    brep_.component_mesh_vertices( unique_vertex_index )[0];
+                const auto& line_id = relationships.component_id( line ).id();
                 return absl::StrCat( "unique vertex ", unique_vertex_index,
                     " is part of multiple Surfaces and multiple "
                     "Lines, but Line ",
@@ -904,15 +980,41 @@ namespace geode
 
     BRepBlocksTopologyInspectionResult
         BRepBlocksTopology::inspect_blocks() const
+    {
+        const internal::ModelUniqueVertices unique_vertices{ brep_,
+            { internal::ModelUniqueVertices::ComponentKind::surface,
+                internal::ModelUniqueVertices::ComponentKind::block } };
+        const internal::ModelRelationships relationships{ brep_ };
+        auto result =
+            inspect_blocks_components( unique_vertices, relationships );
+        if( brep_.nb_active_blocks() == 0 )
+        {
+            return result;
+        }
+        const auto context = blocks_topology_context( relationships );
+        internal::for_each_unique_vertex_chunk( brep_.nb_unique_vertices(),
+            result,
+            [this, &relationships, &context]( index_t unique_vertex_id,
+                BRepBlocksTopologyInspectionResult& chunk_result ) {
+                add_unique_vertex_blocks_issues( unique_vertex_id,
+                    relationships,
+                    internal::vertex_cmvs_by_component(
+                        brep_, relationships, unique_vertex_id ),
+                    context, chunk_result );
+            } );
+        return result;
+    }
+
+    BRepBlocksTopologyInspectionResult
+        BRepBlocksTopology::inspect_blocks_components(
+            const internal::ModelUniqueVertices& unique_vertices,
+            const internal::ModelRelationships& relationships ) const
     {
         BRepBlocksTopologyInspectionResult result;
         if( brep_.nb_active_blocks() == 0 )
         {
             return result;
         }
-        const auto not_boundary_surfaces = find_not_boundary_surfaces( brep_ );
-        const auto dangling_surfaces =
-            find_dangling_surfaces( brep_, not_boundary_surfaces );
         std::vector< geode::uuid > blocks_not_meshed;
         std::vector< geode::uuid > meshed_blocks;
         for( const auto& block : brep_.active_blocks() )
@@ -941,7 +1043,7 @@ namespace geode
             const auto& block = brep_.block( meshed_block_id );
             auto block_result = internal::
                 model_component_vertices_not_associated_to_unique_vertices(
-                    brep_, block.component_id(), block.mesh() );
+                    unique_vertices, block.id() );
             if( block_result.nb_issues() != 0 )
             {
                 block_result.set_description( absl::StrCat( "Block ",
@@ -955,56 +1057,22 @@ namespace geode
         }
         if( brep_.nb_model_boundaries() != 0 )
         {
-            if( !brep_boundaries_are_closed( brep_ ) )
+            if( !brep_boundaries_are_closed( brep_, relationships ) )
             {
                 result.model_boundaries_dont_form_a_closed_surface.add_issue(
                     0, "ModelBoundaries don't form a valid closed surface." );
             }
         }
-        for( const auto unique_vertex_id : Range{ brep_.nb_unique_vertices() } )
+        for( const auto block_index : relationships.components( BLOCK ) )
         {
-            if( const auto problem_message =
-                    unique_vertex_is_part_of_two_blocks_and_no_boundary_surface(
-                        unique_vertex_id ) )
-            {
-                result
-                    .unique_vertices_part_of_two_blocks_and_no_boundary_surface
-                    .add_issue( unique_vertex_id, problem_message.value() );
-            }
-            if( const auto problem_message =
-                    unique_vertex_block_cmvs_count_is_incorrect(
-                        unique_vertex_id ) )
-            {
-                result.unique_vertices_with_incorrect_block_cmvs_count
-                    .add_issue( unique_vertex_id, problem_message.value() );
-            }
-            if( const auto problem_message =
-                    vertex_is_part_of_invalid_single_surface(
-                        unique_vertex_id, not_boundary_surfaces ) )
-            {
-                result.unique_vertices_linked_to_a_single_and_invalid_surface
-                    .add_issue( unique_vertex_id, problem_message.value() );
-            }
-            if( const auto problem_message =
-                    vertex_is_part_of_surface_with_wrong_relationships_to_block(
-                        unique_vertex_id, not_boundary_surfaces,
-                        dangling_surfaces ) )
+            if( !relationships.is_active( block_index ) )
             {
-                result
-                    .unique_vertices_linked_to_surface_with_wrong_relationship_to_blocks
-                    .add_issue( unique_vertex_id, problem_message.value() );
+                continue;
             }
-            if( const auto problem_message =
-                    vertex_is_part_of_invalid_multiple_surfaces(
-                        unique_vertex_id ) )
-            {
-                result.unique_vertex_linked_to_multiple_invalid_surfaces
-                    .add_issue( unique_vertex_id, problem_message.value() );
-            }
-        }
-        for( const auto& block : brep_.active_blocks() )
-        {
-            if( !block_boundaries_are_closed( brep_, block ) )
+            const auto& block =
+                brep_.block( relationships.component_id( block_index ).id() );
+            if( !block_boundaries_are_closed(
+                    brep_, unique_vertices, relationships, block_index ) )
             {
                 result.blocks_with_not_closed_boundary_surfaces.add_issue(
                     block.id(),
@@ -1014,15 +1082,18 @@ namespace geode
                         ") boundaries are not closed or form several closed "
                         "volumes." ) );
             }
-            for( const auto& surface : brep_.boundaries( block ) )
+            for( const auto surface_index :
+                relationships.boundaries( block_index ) )
             {
-                if( !surface.is_active() )
+                if( !relationships.is_active( surface_index ) )
                 {
                     continue;
                 }
                 if( surface_boundaries_are_not_linked_to_another_block_boundary(
-                        surface, brep_, block ) )
+                        relationships, surface_index, block_index ) )
                 {
+                    const auto& surface = brep_.surface(
+                        relationships.component_id( surface_index ).id() );
                     result.wrong_block_boundary_surface.add_issue( block.id(),
                         absl::StrCat( "Block ",
                             block.name().value_or( block.id().string() ), " (",
@@ -1039,4 +1110,79 @@ namespace geode
         }
         return result;
     }
+
+    internal::BRepBlocksTopologyContext
+        BRepBlocksTopology::blocks_topology_context(
+            const internal::ModelRelationships& relationships ) const
+    {
+        const auto not_boundary_surfaces =
+            find_not_boundary_surfaces( relationships );
+        internal::BRepBlocksTopologyContext context;
+        context.is_not_boundary_surface =
+            components_membership( relationships, not_boundary_surfaces );
+        context.is_dangling_surface = components_membership( relationships,
+            find_dangling_surfaces(
+                brep_, relationships, not_boundary_surfaces ) );
+        return context;
+    }
+
+    internal::BRepBlocksTopologyContext
+        BRepBlocksTopology::make_blocks_topology_context(
+            const internal::ModelRelationships& relationships,
+            absl::Span< const uuid > not_boundary_surfaces,
+            absl::Span< const uuid > dangling_surfaces ) const
+    {
+        internal::BRepBlocksTopologyContext context;
+        context.is_not_boundary_surface = components_membership( relationships,
+            components_indices( relationships, not_boundary_surfaces ) );
+        context.is_dangling_surface = components_membership( relationships,
+            components_indices( relationships, dangling_surfaces ) );
+        return context;
+    }
+
+    void BRepBlocksTopology::add_unique_vertex_blocks_issues(
+        index_t unique_vertex_index,
+        const internal::ModelRelationships& relationships,
+        const internal::VertexCMVsByComponent& unique_vertex_cmvs,
+        const internal::BRepBlocksTopologyContext& context,
+        BRepBlocksTopologyInspectionResult& result ) const
+    {
+        if( const auto problem_message =
+                unique_vertex_is_part_of_two_blocks_and_no_boundary_surface(
+                    unique_vertex_index, relationships, unique_vertex_cmvs ) )
+        {
+            result.unique_vertices_part_of_two_blocks_and_no_boundary_surface
+                .add_issue( unique_vertex_index, problem_message.value() );
+        }
+        if( const auto problem_message =
+                unique_vertex_block_cmvs_count_is_incorrect(
+                    unique_vertex_index, relationships, unique_vertex_cmvs ) )
+        {
+            result.unique_vertices_with_incorrect_block_cmvs_count.add_issue(
+                unique_vertex_index, problem_message.value() );
+        }
+        if( const auto problem_message =
+                vertex_is_part_of_invalid_single_surface( unique_vertex_index,
+                    relationships, unique_vertex_cmvs, context ) )
+        {
+            result.unique_vertices_linked_to_a_single_and_invalid_surface
+                .add_issue( unique_vertex_index, problem_message.value() );
+        }
+        if( const auto problem_message =
+                vertex_is_part_of_surface_with_wrong_relationships_to_block(
+                    unique_vertex_index, relationships, unique_vertex_cmvs,
+                    context ) )
+        {
+            result
+                .unique_vertices_linked_to_surface_with_wrong_relationship_to_blocks
+                .add_issue( unique_vertex_index, problem_message.value() );
+        }
+        if( const auto problem_message =
+                vertex_is_part_of_invalid_multiple_surfaces(
+                    unique_vertex_index, relationships, unique_vertex_cmvs ) )
+        {
+            result.unique_vertex_linked_to_multiple_invalid_surfaces.add_issue(
+                unique_vertex_index, problem_message.value() );
+        }
+    }
 } // namespace geode
@@ -26,6 +26,8 @@
 
 #include <optional>
 
+#include <absl/algorithm/container.h>
+
 #include <geode/mesh/core/point_set.hpp>
 
 #include <geode/model/mixin/core/block.hpp>
@@ -33,6 +35,10 @@
 #include <geode/model/mixin/core/line.hpp>
 #include <geode/model/representation/core/brep.hpp>
 
+#include <geode/inspector/inspection/topology/internal/expected_nb_cmvs.hpp>
+#include <geode/inspector/inspection/topology/internal/model_relationships.hpp>
+#include <geode/inspector/inspection/topology/internal/unique_vertices_topology.hpp>
+
 namespace geode
 {
     index_t BRepCornersTopologyInspectionResult::nb_issues() const
@@ -95,19 +101,42 @@ namespace geode
         return "Corners topology inspection";
     }
 
-    BRepCornersTopology::BRepCornersTopology( const BRep& brep ) : brep_( brep )
+    BRepCornersTopology::BRepCornersTopology( const BRep& brep )
+        : brep_( brep )
     {
     }
 
+    BRepCornersTopology::~BRepCornersTopology() = default;
+
+    const internal::ModelRelationships&
+        BRepCornersTopology::relationships_snapshot() const
+    {
+        std::call_once( relationships_flag_, [this] {
+            relationships_ =
+                std::make_unique< internal::ModelRelationships >( brep_ );
+        } );
+        return *relationships_;
+    }
+
     bool BRepCornersTopology::brep_corner_topology_is_valid(
         index_t unique_vertex_index ) const
+    {
+        const auto& relationships = relationships_snapshot();
+        return brep_corner_topology_is_valid( unique_vertex_index,
+            relationships,
+            internal::vertex_cmvs_by_component(
+                brep_, relationships, unique_vertex_index ) );
+    }
+
+    bool BRepCornersTopology::brep_corner_topology_is_valid(
+        index_t unique_vertex_index,
+        const internal::ModelRelationships& relationships,
+        const internal::VertexCMVsByComponent& unique_vertex_cmvs ) const
     {
         bool corner_found{ false };
-        for( const auto& cmv :
-            brep_.component_mesh_vertices( unique_vertex_index ) )
+        for( const auto corner : unique_vertex_cmvs.corners )
         {
-            if( cmv.component_id.type() != Corner3D::component_type_static()
-                || !brep_.corner( cmv.component_id.id() ).is_active() )
+            if( !relationships.is_active( corner ) )
             {
                 continue;
             }
@@ -116,24 +145,25 @@ namespace geode
                 return false;
             }
             corner_found = true;
-            const auto& corner_uuid = cmv.component_id.id();
-            if( brep_.nb_embeddings( corner_uuid ) == 0 )
+            if( relationships.embeddings( corner ).empty() )
             {
-                if( brep_.nb_incidences( corner_uuid ) == 0 )
+                if( relationships.incidences( corner ).empty() )
                 {
                     return false;
                 }
             }
-            else if( brep_.nb_incidences( corner_uuid ) > 1 )
+            else if( relationships.incidences( corner ).size() > 1 )
             {
                 return false;
             }
         }
-        if( corner_is_multiply_embedded( unique_vertex_index ) )
+        if( corner_is_multiply_embedded(
+                unique_vertex_index, relationships, unique_vertex_cmvs ) )
         {
             return false;
         }
-        if( corner_is_part_of_line_but_not_boundary( unique_vertex_index ) )
+        if( corner_is_part_of_line_but_not_boundary(
+                unique_vertex_index, relationships, unique_vertex_cmvs ) )
         {
             return false;
         }
@@ -156,13 +186,24 @@ namespace geode
     std::optional< std::string >
         BRepCornersTopology::unique_vertex_has_multiple_corners(
             index_t unique_vertex_index ) const
+    {
+        const auto& relationships = relationships_snapshot();
+        return unique_vertex_has_multiple_corners( unique_vertex_index,
+            relationships,
+            internal::vertex_cmvs_by_component(
+                brep_, relationships, unique_vertex_index ) );
+    }
+
+    std::optional< std::string >
+        BRepCornersTopology::unique_vertex_has_multiple_corners(
+            index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::VertexCMVsByComponent& unique_vertex_cmvs ) const
     {
         bool corner_found{ false };
-        for( const auto& cmv :
-            brep_.component_mesh_vertices( unique_vertex_index ) )
+        for( const auto corner : unique_vertex_cmvs.corners )
         {
-            if( cmv.component_id.type() != Corner3D::component_type_static()
-                || !brep_.corner( cmv.component_id.id() ).is_active() )
+            if( !relationships.is_active( corner ) )
             {
                 continue;
             }
@@ -180,28 +221,41 @@ namespace geode
         BRepCornersTopology::corner_is_multiply_embedded(
             index_t unique_vertex_index ) const
     {
-        for( const auto& cmv :
-            brep_.component_mesh_vertices( unique_vertex_index ) )
+        const auto& relationships = relationships_snapshot();
+        return corner_is_multiply_embedded( unique_vertex_index, relationships,
+            internal::vertex_cmvs_by_component(
+                brep_, relationships, unique_vertex_index ) );
+    }
+
+    std::optional< std::string >
+        BRepCornersTopology::corner_is_multiply_embedded(
+            index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::VertexCMVsByComponent& unique_vertex_cmvs ) const
+    {
+        for( const auto corner : unique_vertex_cmvs.corners )
         {
-            if( cmv.component_id.type() == Corner3D::component_type_static()
-                && brep_.corner( cmv.component_id.id() ).is_active()
-                && brep_.nb_embeddings( cmv.component_id.id() ) > 1 )
+            if( !relationships.is_active( corner )
+                || relationships.embeddings( corner ).size() <= 1 )
+            {
+                continue;
+            }
+            constexpr auto BLOCK =
+                internal::ModelRelationships::ComponentKind::block;
+            for( const auto block : relationships.embeddings( corner, BLOCK ) )
             {
-                for( const auto& embedding :
-                    brep_.embeddings( cmv.component_id.id() ) )
+                if( relationships.is_active( block ) )
                 {
-                    if( embedding.type() == Block3D::component_type_static()
-                        && brep_.block( embedding.id() ).is_active() )
-                    {
-                        return absl::StrCat( "unique vertex ",
-                            unique_vertex_index, " is associated to Corner ",
-                            brep_.corner( cmv.component_id.id() )
-                                .name()
-                                .value_or( cmv.component_id.id().string() ),
-                            " (", cmv.component_id.id().string(),
-                            "), which is embedded in several components "
-                            "including a Block." );
-                    }
+                    const auto& corner_id =
+                        relationships.component_id( corner ).id();
+                    return absl::StrCat( "unique vertex ", unique_vertex_index,
+                        " is associated to Corner ",
+                        brep_.corner( corner_id )
+                            .name()
+                            .value_or( corner_id.string() ),
+                        " (", corner_id.string(),
+                        "), which is embedded in several components "
+                        "including a Block." );
                 }
             }
         }
@@ -212,20 +266,32 @@ namespace geode
         BRepCornersTopology::corner_is_not_internal_nor_boundary(
             index_t unique_vertex_index ) const
     {
-        for( const auto& cmv :
-            brep_.component_mesh_vertices( unique_vertex_index ) )
+        const auto& relationships = relationships_snapshot();
+        return corner_is_not_internal_nor_boundary( unique_vertex_index,
+            relationships,
+            internal::vertex_cmvs_by_component(
+                brep_, relationships, unique_vertex_index ) );
+    }
+
+    std::optional< std::string >
+        BRepCornersTopology::corner_is_not_internal_nor_boundary(
+            index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::VertexCMVsByComponent& unique_vertex_cmvs ) const
+    {
+        for( const auto corner : unique_vertex_cmvs.corners )
         {
-            if( cmv.component_id.type() == Corner3D::component_type_static()
-                && brep_.corner( cmv.component_id.id() ).is_active()
-                && brep_.nb_embeddings( cmv.component_id.id() ) < 1
-                && brep_.nb_incidences( cmv.component_id.id() ) < 1 )
+            if( relationships.is_active( corner )
+                && relationships.embeddings( corner ).empty()
+                && relationships.incidences( corner ).empty() )
             {
+                const auto& corner_id =
+                    relationships.component_id( corner ).id();
                 return absl::StrCat( "unique vertex ", unique_vertex_index,
                     " is associated to Corner ",
-                    brep_.corner( cmv.component_id.id() )
-                        .name()
-                        .value_or( cmv.component_id.id().string() ),
-                    " (", cmv.component_id.id().string(),
+                    brep_.corner( corner_id ).name().value_or(
+                        corner_id.string() ),
+                    " (", corner_id.string(),
                     "), which is neither internal nor boundary." );
             }
         }
@@ -236,41 +302,41 @@ namespace geode
         BRepCornersTopology::corner_is_part_of_line_but_not_boundary(
             index_t unique_vertex_index ) const
     {
-        for( const auto& cmv :
-            brep_.component_mesh_vertices( unique_vertex_index ) )
+        const auto& relationships = relationships_snapshot();
+        return corner_is_part_of_line_but_not_boundary( unique_vertex_index,
+            relationships,
+            internal::vertex_cmvs_by_component(
+                brep_, relationships, unique_vertex_index ) );
+    }
+
+    std::optional< std::string >
+        BRepCornersTopology::corner_is_part_of_line_but_not_boundary(
+            index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::VertexCMVsByComponent& unique_vertex_cmvs ) const
+    {
+        for( const auto corner : unique_vertex_cmvs.corners )
         {
-            if( cmv.component_id.type() != Corner3D::component_type_static()
-                || !brep_.corner( cmv.component_id.id() ).is_active() )
+            if( !relationships.is_active( corner ) )
             {
                 continue;
             }
-            const auto& corner_uuid = cmv.component_id.id();
-            for( const auto& cmv_line :
-                brep_.component_mesh_vertices( unique_vertex_index ) )
+            const auto& corner_uuid = relationships.component_id( corner ).id();
+            for( const auto line : unique_vertex_cmvs.lines )
             {
-                if( cmv_line.component_id.type()
-                        != Line3D::component_type_static()
-                    || !brep_.line( cmv_line.component_id.id() ).is_active() )
+                if( !relationships.is_active( line ) )
                 {
                     continue;
                 }
-                if( brep_.Relationships::is_boundary(
-                        corner_uuid, cmv_line.component_id.id() ) )
+                if( relationships.is_boundary( corner, line ) )
                 {
                     continue;
                 }
-                if( brep_.Relationships::is_internal(
-                        corner_uuid, cmv_line.component_id.id() ) )
+                const auto& line_uuid = relationships.component_id( line ).id();
+                if( relationships.is_internal( corner, line ) )
                 {
-                    index_t line_vertex_count{ 0 };
-                    for( const auto& cmv2 :
-                        brep_.component_mesh_vertices( unique_vertex_index ) )
-                    {
-                        if( cmv2.component_id.id() == corner_uuid )
-                        {
-                            line_vertex_count++;
-                        }
-                    }
+                    const auto line_vertex_count = static_cast< index_t >(
+                        absl::c_count( unique_vertex_cmvs.corners, corner ) );
                     if( line_vertex_count != 2 )
                     {
                         return absl::StrCat( "unique vertex with index ",
@@ -280,11 +346,9 @@ namespace geode
                                 .value_or( corner_uuid.string() ),
                             " (", corner_uuid.string(),
                             "), which is internal to Line ",
-                            brep_.line( cmv_line.component_id.id() )
-                                .name()
-                                .value_or(
-                                    cmv_line.component_id.id().string() ),
-                            " (", cmv_line.component_id.id().string(),
+                            brep_.line( line_uuid ).name().value_or(
+                                line_uuid.string() ),
+                            " (", line_uuid.string(),
                             "), so Line should be closed and have two "
                             "different vertices on unique vertex, but has ",
                             line_vertex_count, " vertices on it instead." );
@@ -297,10 +361,9 @@ namespace geode
                         .name()
                         .value_or( corner_uuid.string() ),
                     " (", corner_uuid.string() + "), part of line ",
-                    brep_.line( cmv_line.component_id.id() )
-                        .name()
-                        .value_or( cmv_line.component_id.id().string() ),
-                    " (", cmv_line.component_id.id().string(),
+                    brep_.line( line_uuid ).name().value_or(
+                        line_uuid.string() ),
+                    " (", line_uuid.string(),
                     "), but is neither boundary nor internal of it." );
             }
         }
@@ -309,6 +372,27 @@ namespace geode
 
     BRepCornersTopologyInspectionResult
         BRepCornersTopology::inspect_corners_topology() const
+    {
+        const internal::ModelUniqueVertices unique_vertices{ brep_,
+            { internal::ModelUniqueVertices::ComponentKind::corner } };
+        const internal::ModelRelationships relationships{ brep_ };
+        auto result = inspect_corners_components( unique_vertices );
+        internal::for_each_unique_vertex_chunk( brep_.nb_unique_vertices(),
+            result,
+            [this, &relationships]( index_t unique_vertex_id,
+                BRepCornersTopologyInspectionResult& chunk_result ) {
+                add_unique_vertex_corners_issues( unique_vertex_id,
+                    relationships,
+                    internal::vertex_cmvs_by_component(
+                        brep_, relationships, unique_vertex_id ),
+                    chunk_result );
+            } );
+        return result;
+    }
+
+    BRepCornersTopologyInspectionResult
+        BRepCornersTopology::inspect_corners_components(
+            const internal::ModelUniqueVertices& unique_vertices ) const
     {
         BRepCornersTopologyInspectionResult result;
         for( const auto& corner : brep_.active_corners() )
@@ -323,7 +407,7 @@ namespace geode
             }
             auto corner_result = internal::
                 model_component_vertices_not_associated_to_unique_vertices(
-                    brep_, corner.component_id(), corner.mesh() );
+                    unique_vertices, corner.id() );
             if( corner_result.nb_issues() != 0 )
             {
                 corner_result.set_description( absl::StrCat( "Corner ",
@@ -333,35 +417,39 @@ namespace geode
                     corner.id(), std::move( corner_result ) );
             }
         }
-        for( const auto unique_vertex_id : Range{ brep_.nb_unique_vertices() } )
+        return result;
+    }
+
+    void BRepCornersTopology::add_unique_vertex_corners_issues(
+        index_t unique_vertex_index,
+        const internal::ModelRelationships& relationships,
+        const internal::VertexCMVsByComponent& unique_vertex_cmvs,
+        BRepCornersTopologyInspectionResult& result ) const
+    {
+        if( const auto problem_message = unique_vertex_has_multiple_corners(
+                unique_vertex_index, relationships, unique_vertex_cmvs ) )
+        {
+            result.unique_vertices_linked_to_multiple_corners.add_issue(
+                unique_vertex_index, problem_message.value() );
+        }
+        if( const auto problem_message = corner_is_multiply_embedded(
+                unique_vertex_index, relationships, unique_vertex_cmvs ) )
         {
-            if( const auto problem_message =
-                    unique_vertex_has_multiple_corners( unique_vertex_id ) )
-            {
-                result.unique_vertices_linked_to_multiple_corners.add_issue(
-                    unique_vertex_id, problem_message.value() );
-            }
-            if( const auto problem_message =
-                    corner_is_multiply_embedded( unique_vertex_id ) )
-            {
-                result.unique_vertices_linked_to_multiply_embedded_corner
-                    .add_issue( unique_vertex_id, problem_message.value() );
-            }
-            if( const auto problem_message =
-                    corner_is_not_internal_nor_boundary( unique_vertex_id ) )
-            {
-                result
-                    .unique_vertices_linked_to_not_internal_nor_boundary_corner
-                    .add_issue( unique_vertex_id, problem_message.value() );
-            }
-            if( const auto problem_message =
-                    corner_is_part_of_line_but_not_boundary(
-                        unique_vertex_id ) )
-            {
-                result.unique_vertices_linked_to_not_boundary_line_corner
-                    .add_issue( unique_vertex_id, problem_message.value() );
-            }
+            result.unique_vertices_linked_to_multiply_embedded_corner.add_issue(
+                unique_vertex_index, problem_message.value() );
+        }
+        if( const auto problem_message = corner_is_not_internal_nor_boundary(
+                unique_vertex_index, relationships, unique_vertex_cmvs ) )
+        {
+            result.unique_vertices_linked_to_not_internal_nor_boundary_corner
+                .add_issue( unique_vertex_index, problem_message.value() );
+        }
+        if( const auto problem_message =
+                corner_is_part_of_line_but_not_boundary(
+                    unique_vertex_index, relationships, unique_vertex_cmvs ) )
+        {
+            result.unique_vertices_linked_to_not_boundary_line_corner.add_issue(
+                unique_vertex_index, problem_message.value() );
         }
-        return result;
     }
 } // namespace geode
@@ -37,7 +37,18 @@
 #include <geode/model/mixin/core/surface.hpp>
 #include <geode/model/representation/core/brep.hpp>
 
+#include <geode/inspector/inspection/topology/internal/expected_nb_cmvs.hpp>
+#include <geode/inspector/inspection/topology/internal/model_relationships.hpp>
 #include <geode/inspector/inspection/topology/internal/topology_helpers.hpp>
+#include <geode/inspector/inspection/topology/internal/unique_vertices_topology.hpp>
+
+namespace
+{
+    constexpr auto SURFACE =
+        geode::internal::ModelRelationships::ComponentKind::surface;
+    constexpr auto BLOCK =
+        geode::internal::ModelRelationships::ComponentKind::block;
+} // namespace
 
 namespace geode
 {
@@ -115,31 +126,52 @@ namespace geode
         return "Lines topology inspection";
     }
 
-    BRepLinesTopology::BRepLinesTopology( const BRep& brep ) : brep_( brep ) {}
+    BRepLinesTopology::BRepLinesTopology( const BRep& brep ) : brep_( brep )
+    {
+    }
+
+    BRepLinesTopology::~BRepLinesTopology() = default;
+
+    const internal::ModelRelationships&
+        BRepLinesTopology::relationships_snapshot() const
+    {
+        std::call_once( relationships_flag_, [this] {
+            relationships_ =
+                std::make_unique< internal::ModelRelationships >( brep_ );
+        } );
+        return *relationships_;
+    }
 
     bool BRepLinesTopology::brep_lines_topology_is_valid(
         index_t unique_vertex_index ) const
     {
-        bool part_of_active_line{ false };
-        for( const auto& cmv :
-            brep_.component_mesh_vertices( unique_vertex_index ) )
-        {
-            if( cmv.component_id.type() == Line3D::component_type_static()
-                && brep_.line( cmv.component_id.id() ).is_active() )
-            {
-                part_of_active_line = true;
-                break;
-            }
-        }
-        if( !part_of_active_line )
+        const auto& relationships = relationships_snapshot();
+        return brep_lines_topology_is_valid( unique_vertex_index,
+            relationships,
+            internal::vertex_cmvs_by_component(
+                brep_, relationships, unique_vertex_index ) );
+    }
+
+    bool BRepLinesTopology::brep_lines_topology_is_valid(
+        index_t unique_vertex_index,
+        const internal::ModelRelationships& relationships,
+        const internal::VertexCMVsByComponent& unique_vertex_cmvs ) const
+    {
+        if( absl::c_none_of(
+                unique_vertex_cmvs.lines, [&relationships]( index_t line ) {
+                    return relationships.is_active( line );
+                } ) )
         {
             return true;
         }
-        if( vertex_is_part_of_invalid_embedded_line( unique_vertex_index )
-            || vertex_is_part_of_invalid_single_line( unique_vertex_index )
+        if( vertex_is_part_of_invalid_embedded_line(
+                unique_vertex_index, relationships, unique_vertex_cmvs )
+            || vertex_is_part_of_invalid_single_line(
+                unique_vertex_index, relationships, unique_vertex_cmvs )
             || vertex_is_part_of_line_with_wrong_relationships_to_surface(
-                unique_vertex_index )
-            || vertex_has_lines_but_is_not_a_corner( unique_vertex_index ) )
+                unique_vertex_index, relationships, unique_vertex_cmvs )
+            || vertex_has_lines_but_is_not_a_corner(
+                unique_vertex_index, relationships, unique_vertex_cmvs ) )
         {
             return false;
         }
@@ -164,24 +196,32 @@ namespace geode
         BRepLinesTopology::vertex_is_part_of_invalid_embedded_line(
             index_t unique_vertex_index ) const
     {
-        for( const auto& line_cmv :
-            brep_.component_mesh_vertices( unique_vertex_index ) )
+        const auto& relationships = relationships_snapshot();
+        return vertex_is_part_of_invalid_embedded_line( unique_vertex_index,
+            relationships,
+            internal::vertex_cmvs_by_component(
+                brep_, relationships, unique_vertex_index ) );
+    }
+
+    std::optional< std::string >
+        BRepLinesTopology::vertex_is_part_of_invalid_embedded_line(
+            index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::VertexCMVsByComponent& unique_vertex_cmvs ) const
+    {
+        for( const auto line_index : unique_vertex_cmvs.lines )
         {
-            if( line_cmv.component_id.type()
-                != Line3D::component_type_static() )
+            if( !relationships.is_active( line_index ) )
             {
                 continue;
             }
-            const auto& line_id = line_cmv.component_id.id();
+            const auto& line_id = relationships.component_id( line_index ).id();
             const auto& line = brep_.line( line_id );
-            if( !line.is_active() )
+            for( const auto embedding : relationships.embeddings( line_index ) )
             {
-                continue;
-            }
-            for( const auto& embedding : brep_.embeddings( line_id ) )
-            {
-                if( brep_.Relationships::is_boundary(
-                        line_id, embedding.id() ) )
+                const auto& embedding_id =
+                    relationships.component_id( embedding ).id();
+                if( relationships.is_boundary( line_index, embedding ) )
                 {
                     return absl::StrCat( "unique vertex ", unique_vertex_index,
                         " is part of line ",
@@ -189,30 +229,27 @@ namespace geode
                         line_id.string(),
                         "), which is both boundary and embedded in "
                         "Surface ",
-                        brep_.surface( embedding.id() )
+                        brep_.surface( embedding_id )
                             .name()
-                            .value_or( embedding.id().string() ),
-                        " (", embedding.id().string() + ")." );
+                            .value_or( embedding_id.string() ),
+                        " (", embedding_id.string() + ")." );
                 }
-                if( embedding.type() == Block3D::component_type_static()
-                    && !internal::brep_blocks_are_meshed( brep_ ) )
+                if( relationships.kind( embedding ) == BLOCK
+                    && !relationships.are_meshed( BLOCK ) )
                 {
                     continue;
                 }
-                if( !absl::c_any_of(
-                        brep_.component_mesh_vertices( unique_vertex_index ),
-                        [&embedding]( const ComponentMeshVertex& cmv ) {
-                            return cmv.component_id == embedding;
-                        } ) )
+                if( !internal::vertex_is_linked_to_component(
+                        unique_vertex_cmvs, embedding ) )
                 {
                     return absl::StrCat( "unique vertex ", unique_vertex_index,
                         " is part of Line ",
                         line.name().value_or( line_id.string() ), " (",
                         line_id.string(), "), which is embedded in Surface ",
-                        brep_.surface( embedding.id() )
+                        brep_.surface( embedding_id )
                             .name()
-                            .value_or( embedding.id().string() ),
-                        " (", embedding.id().string(),
+                            .value_or( embedding_id.string() ),
+                        " (", embedding_id.string(),
                         "), but the unique vertex is not linked to the "
                         "Surface mesh vertices." );
                 }
@@ -225,62 +262,78 @@ namespace geode
         BRepLinesTopology::vertex_is_part_of_invalid_single_line(
             index_t unique_vertex_index ) const
     {
-        const auto line_uuids = internal::components_uuids(
-            brep_, unique_vertex_index, Line3D::component_type_static() );
-        if( line_uuids.size() != 1 )
+        const auto& relationships = relationships_snapshot();
+        return vertex_is_part_of_invalid_single_line( unique_vertex_index,
+            relationships,
+            internal::vertex_cmvs_by_component(
+                brep_, relationships, unique_vertex_index ) );
+    }
+
+    std::optional< std::string >
+        BRepLinesTopology::vertex_is_part_of_invalid_single_line(
+            index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::VertexCMVsByComponent& unique_vertex_cmvs ) const
+    {
+        const auto lines =
+            internal::unique_components( unique_vertex_cmvs.lines );
+        if( lines.size() != 1 )
         {
             return std::nullopt;
         }
-        const auto& line_id = line_uuids[0];
-        const auto& line = brep_.line( line_id );
-        if( !line.is_active() )
+        const auto line_index = lines[0];
+        if( !relationships.is_active( line_index ) )
         {
             return std::nullopt;
         }
-        const auto surface_uuids = internal::components_uuids(
-            brep_, unique_vertex_index, Surface3D::component_type_static() );
-        const auto block_uuids = internal::components_uuids(
-            brep_, unique_vertex_index, Block3D::component_type_static() );
-        if( brep_.nb_embedding_surfaces( line ) < 1
-            && brep_.nb_incidences( line_id ) < 1 )
+        const auto& line_id = relationships.component_id( line_index ).id();
+        const auto& line = brep_.line( line_id );
+        const auto surfaces =
+            internal::unique_components( unique_vertex_cmvs.surfaces );
+        const auto blocks =
+            internal::unique_components( unique_vertex_cmvs.blocks );
+        if( relationships.embeddings( line_index, SURFACE ).empty()
+            && relationships.incidences( line_index ).empty() )
         {
             return std::nullopt;
         }
-        if( surface_uuids.size() == 1 )
+        if( surfaces.size() == 1 )
         {
-            if( !brep_.Relationships::is_internal( line_id, surface_uuids[0] )
-                && !( brep_.Relationships::nb_embeddings( surface_uuids[0] ) > 0
-                      || brep_.Relationships::is_boundary(
-                          line_id, surface_uuids[0] ) ) )
+            if( !relationships.is_internal( line_index, surfaces[0] )
+                && !( !relationships.embeddings( surfaces[0] ).empty()
+                      || relationships.is_boundary(
+                          line_index, surfaces[0] ) ) )
             {
+                const auto& surface_id =
+                    relationships.component_id( surfaces[0] ).id();
                 return absl::StrCat( "unique vertex ", unique_vertex_index,
                     " is part of only one Line ",
                     line.name().value_or( line_id.string() ), " (",
                     line_id.string(), "), and only one Surface ",
-                    brep_.surface( surface_uuids[0] )
+                    brep_.surface( surface_id )
                         .name()
-                        .value_or( surface_uuids[0].string() ),
-                    " (", surface_uuids[0].string(),
+                        .value_or( surface_id.string() ),
+                    " (", surface_id.string(),
                     "), but the Line is neither embedded in the "
                     "Surface, nor boundary of the Surface while the "
                     "Surface is embedded in a Block." );
             }
         }
-        else if( surface_uuids.empty() )
+        else if( surfaces.empty() )
         {
-            if( !internal::brep_blocks_are_meshed( brep_ ) )
+            if( !relationships.are_meshed( BLOCK ) )
             {
                 return std::nullopt;
             }
-            if( block_uuids.size() != 1 )
+            if( blocks.size() != 1 )
             {
                 return absl::StrCat( "unique vertex ", unique_vertex_index,
                     " is part of only one Line ",
                     line.name().value_or( line_id.string() ), " (",
                     line_id.string(), "), no Surfaces, but is part of ",
-                    block_uuids.size(), " Blocks, instead of one." );
+                    blocks.size(), " Blocks, instead of one." );
             }
-            if( !brep_.Relationships::is_internal( line_id, block_uuids[0] ) )
+            if( !relationships.is_internal( line_index, blocks[0] ) )
             {
                 return absl::StrCat( "unique vertex ", unique_vertex_index,
                     " is part of only one Line ",
@@ -292,20 +345,24 @@ namespace geode
         }
         else
         {
-            for( const auto& surface_id : surface_uuids )
+            for( const auto surface : surfaces )
             {
-                const auto& surface = brep_.surface( surface_id );
-                if( !brep_.is_boundary( line, surface )
-                    && !brep_.is_internal( line, surface ) )
+                if( !relationships.is_boundary( line_index, surface )
+                    && !relationships.is_internal( line_index, surface ) )
                 {
+                    const auto& surface_id =
+                        relationships.component_id( surface ).id();
                     return absl::StrCat( "unique vertex ", unique_vertex_index,
                         " is part of only one Line ",
                         line.name().value_or( line_id.string() ), " (",
                         line_id.string(),
                         "), and multiple Surfaces, but the Line is "
                         "neither internal nor boundary of Surface ",
-                        surface.name().value_or( surface_id.string() ), " (",
-                        surface_id.string(), "), in which the vertex is." );
+                        brep_.surface( surface_id )
+                            .name()
+                            .value_or( surface_id.string() ),
+                        " (", surface_id.string(),
+                        "), in which the vertex is." );
                 }
             }
         }
@@ -316,25 +373,40 @@ namespace geode
         vertex_is_part_of_line_with_wrong_relationships_to_surface(
             index_t unique_vertex_index ) const
     {
-        for( const auto& cmv :
-            brep_.component_mesh_vertices( unique_vertex_index ) )
+        const auto& relationships = relationships_snapshot();
+        return vertex_is_part_of_line_with_wrong_relationships_to_surface(
+            unique_vertex_index, relationships,
+            internal::vertex_cmvs_by_component(
+                brep_, relationships, unique_vertex_index ) );
+    }
+
+    std::optional< std::string > BRepLinesTopology::
+        vertex_is_part_of_line_with_wrong_relationships_to_surface(
+            index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::VertexCMVsByComponent& unique_vertex_cmvs ) const
+    {
+        for( const auto line_index : unique_vertex_cmvs.lines )
         {
-            if( cmv.component_id.type() != Line3D::component_type_static() )
+            if( !relationships.is_active( line_index ) )
             {
                 continue;
             }
-            const auto& line = brep_.line( cmv.component_id.id() );
-            if( !line.is_active() || line.mesh().nb_edges() == 0 )
+            const auto& line =
+                brep_.line( relationships.component_id( line_index ).id() );
+            if( line.mesh().nb_edges() == 0 )
             {
                 continue;
             }
             const auto cme = geode::component_mesh_edges( brep_, line, 0 );
-            for( const auto& incident_surface : brep_.incidences( line ) )
+            for( const auto incidence : relationships.incidences( line_index ) )
             {
-                if( !incident_surface.is_active() )
+                if( !relationships.is_active( incidence ) )
                 {
                     continue;
                 }
+                const auto& incident_surface = brep_.surface(
+                    relationships.component_id( incidence ).id() );
                 if( !cme.surface_edges.contains( incident_surface.id() ) )
                 {
                     return absl::StrCat( "unique vertex ", unique_vertex_index,
@@ -351,8 +423,7 @@ namespace geode
                     return absl::StrCat( "unique vertex ", unique_vertex_index,
                         " is part of Line ",
                         line.name().value_or( line.id().string() ), " (",
-                        cmv.component_id.id().string(),
-                        "), which is boundary of Surface ",
+                        line.id().string(), "), which is boundary of Surface ",
                         incident_surface.name().value_or(
                             incident_surface.id().string() ),
                         " (", incident_surface.id().string(),
@@ -360,20 +431,22 @@ namespace geode
                         "around Line edge 0" );
                 }
             }
-            for( const auto& embedding_surface :
-                brep_.embedding_surfaces( line ) )
+            const auto embeddings =
+                relationships.embeddings( line_index, SURFACE );
+            for( const auto embedding : embeddings )
             {
-                if( !embedding_surface.is_active() )
+                if( !relationships.is_active( embedding ) )
                 {
                     continue;
                 }
+                const auto& embedding_surface = brep_.surface(
+                    relationships.component_id( embedding ).id() );
                 if( !cme.surface_edges.contains( embedding_surface.id() ) )
                 {
                     return absl::StrCat( "unique vertex ", unique_vertex_index,
                         " is part of Line ",
                         line.name().value_or( line.id().string() ), " (",
-                        cmv.component_id.id().string(),
-                        "), which is embedded in Surface ",
+                        line.id().string(), "), which is embedded in Surface ",
                         embedding_surface.name().value_or(
                             embedding_surface.id().string() ),
                         " (", embedding_surface.id().string(),
@@ -384,8 +457,7 @@ namespace geode
                     return absl::StrCat( "unique vertex ", unique_vertex_index,
                         " is part of Line ",
                         line.name().value_or( line.id().string() ), " (",
-                        cmv.component_id.id().string(),
-                        "), which is embedded in Surface ",
+                        line.id().string(), "), which is embedded in Surface ",
                         embedding_surface.name().value_or(
                             embedding_surface.id().string() ),
                         " (", embedding_surface.id().string(),
@@ -393,17 +465,18 @@ namespace geode
                         "edge around Line edge 0)" );
                 }
             }
-            if( brep_.nb_incidences( cmv.component_id.id() ) == 0
-                && brep_.nb_embedding_surfaces( line ) == 0 )
+            if( relationships.incidences( line_index ).empty()
+                && embeddings.empty() )
             {
                 for( const auto& [surface_id, _] : cme.surface_edges )
                 {
-                    if( brep_.surface( surface_id ).is_active() )
+                    if( relationships.is_active(
+                            relationships.component_index( surface_id ) ) )
                     {
                         return absl::StrCat( "unique vertex ",
                             unique_vertex_index, " is part of Line ",
                             line.name().value_or( line.id().string() ), " (",
-                            cmv.component_id.id().string(),
+                            line.id().string(),
                             "), which should be internal or boundary to "
                             "Surface ",
                             brep_.surface( surface_id )
@@ -421,22 +494,28 @@ namespace geode
         BRepLinesTopology::vertex_has_lines_but_is_not_a_corner(
             index_t unique_vertex_index ) const
     {
-        index_t nb_lines{ 0 };
-        bool is_a_corner{ false };
-        for( const auto& cmv :
-            brep_.component_mesh_vertices( unique_vertex_index ) )
+        const auto& relationships = relationships_snapshot();
+        return vertex_has_lines_but_is_not_a_corner( unique_vertex_index,
+            relationships,
+            internal::vertex_cmvs_by_component(
+                brep_, relationships, unique_vertex_index ) );
+    }
+
+    std::optional< std::string >
+        BRepLinesTopology::vertex_has_lines_but_is_not_a_corner(
+            index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::VertexCMVsByComponent& unique_vertex_cmvs ) const
+    {
+        if( !unique_vertex_cmvs.corner_cmvs.empty() )
         {
-            if( cmv.component_id.type() == Corner3D::component_type_static() )
-            {
-                is_a_corner = true;
-            }
-            else if( cmv.component_id.type() == Line3D::component_type_static()
-                     && brep_.line( cmv.component_id.id() ).is_active() )
-            {
-                nb_lines++;
-            }
+            return std::nullopt;
         }
-        if( nb_lines > 1 && !is_a_corner )
+        const auto nb_lines = absl::c_count_if(
+            unique_vertex_cmvs.lines, [&relationships]( index_t line ) {
+                return relationships.is_active( line );
+            } );
+        if( nb_lines > 1 )
         {
             return absl::StrCat( "unique vertex ", unique_vertex_index,
                 " is part of multiple Lines but is not a Corner." );
@@ -448,15 +527,28 @@ namespace geode
         BRepLinesTopology::line_edge_has_wrong_component_edges_around(
             const Line3D& line, const index_t edge_index ) const
     {
+        return line_edge_has_wrong_component_edges_around(
+            internal::ModelRelationships{ brep_ }, line, edge_index );
+    }
+
+    std::optional< std::string >
+        BRepLinesTopology::line_edge_has_wrong_component_edges_around(
+            const internal::ModelRelationships& relationships,
+            const Line3D& line,
+            const index_t edge_index ) const
+    {
+        const auto line_index = relationships.component_index( line.id() );
         const auto cme = component_mesh_edges( brep_, line, edge_index );
         for( const auto& [surface_id, surface_edges] : cme.surface_edges )
         {
-            const auto& surface = brep_.surface( surface_id );
-            if( !surface.is_active() )
+            const auto surface_index =
+                relationships.component_index( surface_id );
+            if( !relationships.is_active( surface_index ) )
             {
                 continue;
             }
-            if( brep_.is_boundary( line, surface ) )
+            const auto& surface = brep_.surface( surface_id );
+            if( relationships.is_boundary( line_index, surface_index ) )
             {
                 if( surface_edges.size() != 1 )
                 {
@@ -470,7 +562,7 @@ namespace geode
                 }
                 continue;
             }
-            if( brep_.is_internal( line, surface ) )
+            if( relationships.is_internal( line_index, surface_index ) )
             {
                 if( surface_edges.size() != 2 )
                 {
@@ -489,12 +581,15 @@ namespace geode
                 surface_id.string(),
                 "), but is neither boundary of nor internal to it." );
         }
-        for( const auto& embedding_surface : brep_.embedding_surfaces( line ) )
+        for( const auto embedding :
+            relationships.embeddings( line_index, SURFACE ) )
         {
-            if( !embedding_surface.is_active() )
+            if( !relationships.is_active( embedding ) )
             {
                 continue;
             }
+            const auto& embedding_surface = brep_.surface(
+                relationships.component_id( embedding ).id() );
             if( !cme.surface_edges.contains( embedding_surface.id() ) )
             {
                 return absl::StrCat( "Line ",
@@ -506,12 +601,14 @@ namespace geode
                     edge_index, " has no common edge with the surface" );
             }
         }
-        for( const auto& incident_surface : brep_.incidences( line ) )
+        for( const auto incidence : relationships.incidences( line_index ) )
         {
-            if( !incident_surface.is_active() )
+            if( !relationships.is_active( incidence ) )
             {
                 continue;
             }
+            const auto& incident_surface = brep_.surface(
+                relationships.component_id( incidence ).id() );
             if( !cme.surface_edges.contains( incident_surface.id() ) )
             {
                 return absl::StrCat( "Line ",
@@ -525,11 +622,13 @@ namespace geode
         }
         for( const auto& [block_id, block_edges] : cme.block_edges )
         {
-            const auto& block = brep_.block( block_id );
-            if( block.is_active() && brep_.is_internal( line, block ) )
+            const auto block_index = relationships.component_index( block_id );
+            if( relationships.is_active( block_index )
+                && relationships.is_internal( line_index, block_index ) )
             {
                 if( block_edges.size() != 1 )
                 {
+                    const auto& block = brep_.block( block_id );
                     return absl::StrCat( "Line ",
                         line.name().value_or( line.id().string() ), " (",
                         line.id().string(), ") is internal to Block ",
@@ -540,13 +639,16 @@ namespace geode
                 continue;
             }
         }
-        for( const auto& embedding_block : brep_.embedding_blocks( line ) )
+        for( const auto embedding :
+            relationships.embeddings( line_index, BLOCK ) )
         {
-            if( !embedding_block.is_active()
-                || embedding_block.mesh().nb_polyhedra() == 0 )
+            if( !relationships.is_active( embedding )
+                || !relationships.is_meshed( embedding ) )
             {
                 continue;
             }
+            const auto& embedding_block =
+                brep_.block( relationships.component_id( embedding ).id() );
             if( !cme.block_edges.contains( embedding_block.id() ) )
             {
                 return absl::StrCat( "Line ",
@@ -563,6 +665,29 @@ namespace geode
 
     BRepLinesTopologyInspectionResult
         BRepLinesTopology::inspect_lines_topology() const
+    {
+        const internal::ModelUniqueVertices unique_vertices{ brep_,
+            { internal::ModelUniqueVertices::ComponentKind::line } };
+        const internal::ModelRelationships relationships{ brep_ };
+        auto result =
+            inspect_lines_components( unique_vertices, relationships );
+        internal::for_each_unique_vertex_chunk( brep_.nb_unique_vertices(),
+            result,
+            [this, &relationships]( index_t unique_vertex_id,
+                BRepLinesTopologyInspectionResult& chunk_result ) {
+                add_unique_vertex_lines_issues( unique_vertex_id,
+                    relationships,
+                    internal::vertex_cmvs_by_component(
+                        brep_, relationships, unique_vertex_id ),
+                    chunk_result );
+            } );
+        return result;
+    }
+
+    BRepLinesTopologyInspectionResult
+        BRepLinesTopology::inspect_lines_components(
+            const internal::ModelUniqueVertices& unique_vertices,
+            const internal::ModelRelationships& relationships ) const
     {
         BRepLinesTopologyInspectionResult result;
         for( const auto& line : brep_.active_lines() )
@@ -576,7 +701,7 @@ namespace geode
             }
             auto line_result = internal::
                 model_component_vertices_not_associated_to_unique_vertices(
-                    brep_, line.component_id(), line.mesh() );
+                    unique_vertices, line.id() );
             if( line_result.nb_issues() != 0 )
             {
                 line_result.set_description( absl::StrCat( "Line ",
@@ -595,7 +720,7 @@ namespace geode
             {
                 if( const auto problem_message =
                         line_edge_has_wrong_component_edges_around(
-                            line, edge_id ) )
+                            relationships, line, edge_id ) )
                 {
                     line_edges_with_wrong_cme.add_issue(
                         edge_id, problem_message.value() );
@@ -608,39 +733,45 @@ namespace geode
                         line.id(), std::move( line_edges_with_wrong_cme ) );
             }
         }
-        for( const auto unique_vertex_id : Range{ brep_.nb_unique_vertices() } )
+        return result;
+    }
+
+    void BRepLinesTopology::add_unique_vertex_lines_issues(
+        index_t unique_vertex_index,
+        const internal::ModelRelationships& relationships,
+        const internal::VertexCMVsByComponent& unique_vertex_cmvs,
+        BRepLinesTopologyInspectionResult& result ) const
+    {
+        if( const auto invalid_internal_topology =
+                vertex_is_part_of_invalid_embedded_line(
+                    unique_vertex_index, relationships, unique_vertex_cmvs ) )
         {
-            if( const auto invalid_internal_topology =
-                    vertex_is_part_of_invalid_embedded_line(
-                        unique_vertex_id ) )
-            {
-                result.unique_vertices_linked_to_a_line_with_invalid_embeddings
-                    .add_issue(
-                        unique_vertex_id, invalid_internal_topology.value() );
-            }
-            if( const auto problem_message =
-                    vertex_is_part_of_line_with_wrong_relationships_to_surface(
-                        unique_vertex_id ) )
-            {
-                result
-                    .unique_vertices_linked_to_line_with_wrong_relationship_to_surface
-                    .add_issue( unique_vertex_id, problem_message.value() );
-            }
-            if( const auto problem_message =
-                    vertex_is_part_of_invalid_single_line( unique_vertex_id ) )
-            {
-                result.unique_vertices_linked_to_a_single_and_invalid_line
-                    .add_issue( unique_vertex_id, problem_message.value() );
-            }
-            if( const auto lines_but_is_not_corner =
-                    vertex_has_lines_but_is_not_a_corner( unique_vertex_id ) )
-            {
-                result
-                    .unique_vertices_linked_to_several_lines_but_not_linked_to_a_corner
-                    .add_issue(
-                        unique_vertex_id, lines_but_is_not_corner.value() );
-            }
+            result.unique_vertices_linked_to_a_line_with_invalid_embeddings
+                .add_issue(
+                    unique_vertex_index, invalid_internal_topology.value() );
+        }
+        if( const auto problem_message =
+                vertex_is_part_of_line_with_wrong_relationships_to_surface(
+                    unique_vertex_index, relationships, unique_vertex_cmvs ) )
+        {
+            result
+                .unique_vertices_linked_to_line_with_wrong_relationship_to_surface
+                .add_issue( unique_vertex_index, problem_message.value() );
+        }
+        if( const auto problem_message = vertex_is_part_of_invalid_single_line(
+                unique_vertex_index, relationships, unique_vertex_cmvs ) )
+        {
+            result.unique_vertices_linked_to_a_single_and_invalid_line
+                .add_issue( unique_vertex_index, problem_message.value() );
+        }
+        if( const auto lines_but_is_not_corner =
+                vertex_has_lines_but_is_not_a_corner(
+                    unique_vertex_index, relationships, unique_vertex_cmvs ) )
+        {
+            result
+                .unique_vertices_linked_to_several_lines_but_not_linked_to_a_corner
+                .add_issue(
+                    unique_vertex_index, lines_but_is_not_corner.value() );
         }
-        return result;
     }
 } // namespace geode
@@ -41,7 +41,10 @@
 #include <geode/model/mixin/core/surface.hpp>
 #include <geode/model/representation/core/brep.hpp>
 
+#include <geode/inspector/inspection/topology/internal/expected_nb_cmvs.hpp>
+#include <geode/inspector/inspection/topology/internal/model_relationships.hpp>
 #include <geode/inspector/inspection/topology/internal/topology_helpers.hpp>
+#include <geode/inspector/inspection/topology/internal/unique_vertices_topology.hpp>
 
 namespace geode
 {
@@ -109,29 +112,46 @@ namespace geode
     {
     }
 
+    BRepSurfacesTopology::~BRepSurfacesTopology() = default;
+
+    const internal::ModelRelationships&
+        BRepSurfacesTopology::relationships_snapshot() const
+    {
+        std::call_once( relationships_flag_, [this] {
+            relationships_ =
+                std::make_unique< internal::ModelRelationships >( brep_ );
+        } );
+        return *relationships_;
+    }
+
     bool BRepSurfacesTopology::brep_surfaces_topology_is_valid(
         index_t unique_vertex_index ) const
     {
-        bool surface_found{ false };
-        for( const auto& cmv :
-            brep_.component_mesh_vertices( unique_vertex_index ) )
-        {
-            if( cmv.component_id.type() == Surface3D::component_type_static()
-                && brep_.surface( cmv.component_id.id() ).is_active() )
-            {
-                surface_found = true;
-                break;
-            }
-        }
-        if( !surface_found )
+        const auto& relationships = relationships_snapshot();
+        return brep_surfaces_topology_is_valid( unique_vertex_index,
+            relationships,
+            internal::vertex_cmvs_by_component(
+                brep_, relationships, unique_vertex_index ) );
+    }
+
+    bool BRepSurfacesTopology::brep_surfaces_topology_is_valid(
+        index_t unique_vertex_index,
+        const internal::ModelRelationships& relationships,
+        const internal::VertexCMVsByComponent& unique_vertex_cmvs ) const
+    {
+        if( absl::c_none_of( unique_vertex_cmvs.surfaces,
+                [&relationships]( index_t surface ) {
+                    return relationships.is_active( surface );
+                } ) )
         {
             return true;
         }
-        if( vertex_is_part_of_invalid_embedded_surface( unique_vertex_index )
+        if( vertex_is_part_of_invalid_embedded_surface(
+                unique_vertex_index, relationships, unique_vertex_cmvs )
             || vertex_is_part_of_invalid_multiple_surfaces(
-                unique_vertex_index )
+                unique_vertex_index, relationships, unique_vertex_cmvs )
             || vertex_is_part_of_line_and_not_on_surface_border(
-                unique_vertex_index ) )
+                unique_vertex_index, relationships, unique_vertex_cmvs ) )
         {
             return false;
         }
@@ -159,23 +179,39 @@ namespace geode
         BRepSurfacesTopology::vertex_is_part_of_invalid_embedded_surface(
             const index_t unique_vertex_index ) const
     {
-        for( const auto surface_id : internal::components_uuids( brep_,
-                 unique_vertex_index, Surface3D::component_type_static() ) )
+        const auto& relationships = relationships_snapshot();
+        return vertex_is_part_of_invalid_embedded_surface( unique_vertex_index,
+            relationships,
+            internal::vertex_cmvs_by_component(
+                brep_, relationships, unique_vertex_index ) );
+    }
+
+    std::optional< std::string >
+        BRepSurfacesTopology::vertex_is_part_of_invalid_embedded_surface(
+            const index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::VertexCMVsByComponent& unique_vertex_cmvs ) const
+    {
+        for( const auto surface_index :
+            internal::unique_components( unique_vertex_cmvs.surfaces ) )
         {
-            const auto& surface = brep_.surface( surface_id );
-            if( !surface.is_active() )
+            if( !relationships.is_active( surface_index ) )
             {
                 continue;
             }
-            for( const auto& embedding : brep_.embeddings( surface_id ) )
+            const auto& surface_id =
+                relationships.component_id( surface_index ).id();
+            const auto& surface = brep_.surface( surface_id );
+            for( const auto embedding :
+                relationships.embeddings( surface_index ) )
             {
-                const auto& block = brep_.block( embedding.id() );
-                if( !block.is_active() )
+                if( !relationships.is_active( embedding ) )
                 {
                     continue;
                 }
-                if( brep_.Relationships::is_boundary(
-                        surface_id, embedding.id() ) )
+                const auto& block =
+                    brep_.block( relationships.component_id( embedding ).id() );
+                if( relationships.is_boundary( surface_index, embedding ) )
                 {
                     return absl::StrCat( "unique vertex ", unique_vertex_index,
                         " is part of Surface ",
@@ -183,14 +219,12 @@ namespace geode
                         surface_id.string(),
                         "), which is both internal and boundary of ", "Block ",
                         block.name().value_or( block.id().string() ), " (",
-                        embedding.id().string(), ")" );
+                        block.id().string(), ")" );
                 }
-                if( internal::brep_blocks_are_meshed( brep_ )
-                    && !absl::c_any_of(
-                        brep_.component_mesh_vertices( unique_vertex_index ),
-                        [&embedding]( const ComponentMeshVertex& cmv ) {
-                            return cmv.component_id.id() == embedding.id();
-                        } ) )
+                if( relationships.are_meshed(
+                        internal::ModelRelationships::ComponentKind::block )
+                    && !internal::vertex_is_linked_to_component(
+                        unique_vertex_cmvs, embedding ) )
                 {
                     return absl::StrCat( "unique vertex ", unique_vertex_index,
                         " is part of Surface ",
@@ -198,7 +232,7 @@ namespace geode
                         surface_id.string(), " (", surface_id.string(),
                         "), which is embedded in Block ",
                         block.name().value_or( block.id().string() ), " (",
-                        embedding.id().string(), " (", embedding.id().string(),
+                        block.id().string(), " (", block.id().string(),
                         "), but the unique vertex is not linked to any "
                         "of the Block vertices." );
                 }
@@ -211,47 +245,67 @@ namespace geode
         BRepSurfacesTopology::vertex_is_part_of_invalid_multiple_surfaces(
             index_t unique_vertex_index ) const
     {
-        const auto surface_uuids = internal::components_uuids(
-            brep_, unique_vertex_index, Surface3D::component_type_static() );
-        if( absl::c_count_if( surface_uuids,
-                [*this]( const uuid& surface_id ) {
-                    return brep_.surface( surface_id ).is_active();
+        const auto& relationships = relationships_snapshot();
+        return vertex_is_part_of_invalid_multiple_surfaces( unique_vertex_index,
+            relationships,
+            internal::vertex_cmvs_by_component(
+                brep_, relationships, unique_vertex_index ) );
+    }
+
+    std::optional< std::string >
+        BRepSurfacesTopology::vertex_is_part_of_invalid_multiple_surfaces(
+            index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::VertexCMVsByComponent& unique_vertex_cmvs ) const
+    {
+        const auto surfaces =
+            internal::unique_components( unique_vertex_cmvs.surfaces );
+        if( absl::c_count_if( surfaces,
+                [&relationships]( index_t surface ) {
+                    return relationships.is_active( surface );
                 } )
             < 2 )
         {
             return std::nullopt;
         }
-        const auto line_uuids = internal::components_uuids(
-            brep_, unique_vertex_index, Line3D::component_type_static() );
-        if( line_uuids.empty() )
+        const auto lines =
+            internal::unique_components( unique_vertex_cmvs.lines );
+        if( lines.empty() )
         {
             bool has_corner_internal_to_all_surfaces{ false };
-            for( const auto& cmv :
-                brep_.component_mesh_vertices( unique_vertex_index ) )
+            for( const auto corner_cmv_id :
+                Indices{ unique_vertex_cmvs.corner_cmvs } )
             {
-                if( cmv.component_id.type()
-                    != Corner3D::component_type_static() )
-                {
-                    continue;
-                }
-                const auto& corner = brep_.corner( cmv.component_id.id() );
-                for( const auto& surface_id : surface_uuids )
+                const auto corner_index =
+                    unique_vertex_cmvs.corners[corner_cmv_id];
+                for( const auto surface_index : surfaces )
                 {
-                    const auto& surface = brep_.surface( surface_id );
-                    if( surface.is_active()
-                        && !brep_.is_internal( corner, surface ) )
+                    if( !relationships.is_active( surface_index )
+                        || relationships.is_internal(
+                            corner_index, surface_index ) )
                     {
-                        return absl::StrCat( "unique vertex ",
-                            unique_vertex_index, " at position [",
-                            corner.mesh().point( cmv.vertex ).string(),
-                            "] is part of multiple active Surfaces, and not "
-                            "part of any Line, but is part of Corner ",
-                            corner.name().value_or( corner.id().string() ),
-                            " (", corner.id().string(),
-                            "), which is not internal to active Surface ",
-                            surface.name().value_or( surface_id.string() ),
-                            " (", surface_id.string(), ")." );
+                        continue;
                     }
+                    const auto& corner = brep_.corner(
+                        relationships.component_id( corner_index ).id() );
+                    const auto& surface_id =
+                        relationships.component_id( surface_index ).id();
+                    return absl::StrCat( "unique vertex ", unique_vertex_index,
+                        " at position [",
+                        corner.mesh()
+                            .point(
+                                unique_vertex_cmvs.corner_cmvs[corner_cmv_id]
+                                    .vertex )
+                            .string(),
+                        "] is part of multiple active Surfaces, and not "
+                        "part of any Line, but is part of Corner ",
+                        corner.name().value_or( corner.id().string() ), " (",
+                        corner.id().string(),
+                        "), which is not internal to active Surface ",
+                        brep_.surface( surface_id )
+                            .name()
+                            .value_or( surface_id.string() ),
+                        " (", surface_id.string(), ")." );
                 }
                 has_corner_internal_to_all_surfaces = true;
             }
@@ -263,53 +317,34 @@ namespace geode
                     "Surfaces." );
             }
         }
-        if( line_uuids.size() == 1 )
+        if( lines.size() == 1 )
         {
-            index_t nb_cmv_lines{ 0 };
-            index_t nb_of_line_relationships_with_surfaces{ 0 };
-            for( const auto& cmv :
-                brep_.component_mesh_vertices( unique_vertex_index ) )
-            {
-                if( cmv.component_id.type() != Line3D::component_type_static() )
-                {
-                    continue;
-                }
-                nb_cmv_lines += 1;
-                for( const auto& surface_id : surface_uuids )
-                {
-                    if( brep_.Relationships::is_boundary(
-                            cmv.component_id.id(), surface_id )
-                        || brep_.Relationships::is_internal(
-                            cmv.component_id.id(), surface_id ) )
-                    {
-                        nb_of_line_relationships_with_surfaces += 1;
-                    }
-                }
-            }
-            if( nb_cmv_lines >= 2 )
+            if( unique_vertex_cmvs.lines.size() >= 2 )
             {
                 return std::nullopt;
             }
-            for( const auto& cmv :
-                brep_.component_mesh_vertices( unique_vertex_index ) )
+            index_t nb_of_line_relationships_with_surfaces{ 0 };
+            for( const auto surface : surfaces )
             {
-                if( cmv.component_id.type()
-                    != Corner3D::component_type_static() )
+                if( relationships.is_boundary( lines[0], surface )
+                    || relationships.is_internal( lines[0], surface ) )
                 {
-                    continue;
+                    nb_of_line_relationships_with_surfaces += 1;
                 }
-                if( brep_.Relationships::nb_embeddings( cmv.component_id.id() )
-                        + nb_of_line_relationships_with_surfaces
-                    < surface_uuids.size() )
+            }
+            for( const auto corner : unique_vertex_cmvs.corners )
+            {
+                const auto nb_relationships =
+                    relationships.embeddings( corner ).size()
+                    + nb_of_line_relationships_with_surfaces;
+                if( nb_relationships < surfaces.size() )
                 {
                     return absl::StrCat( "unique vertex ", unique_vertex_index,
                         " is part of multiple active Surfaces and only one "
                         "Line, is a Corner, but is not internal to all the "
                         "Surfaces without relationships to the Line." );
                 }
-                if( brep_.Relationships::nb_embeddings( cmv.component_id.id() )
-                        + nb_of_line_relationships_with_surfaces
-                    > surface_uuids.size() )
+                if( nb_relationships > surfaces.size() )
                 {
                     return absl::StrCat( "unique vertex ", unique_vertex_index,
                         " is part of multiple active Surfaces and only one "
@@ -325,30 +360,41 @@ namespace geode
         BRepSurfacesTopology::vertex_is_part_of_line_and_not_on_surface_border(
             index_t unique_vertex_index ) const
     {
-        const auto line_uuids = internal::components_uuids(
-            brep_, unique_vertex_index, Line3D::component_type_static() );
-        if( line_uuids.empty() )
+        const auto& relationships = relationships_snapshot();
+        return vertex_is_part_of_line_and_not_on_surface_border(
+            unique_vertex_index, relationships,
+            internal::vertex_cmvs_by_component(
+                brep_, relationships, unique_vertex_index ) );
+    }
+
+    std::optional< std::string >
+        BRepSurfacesTopology::vertex_is_part_of_line_and_not_on_surface_border(
+            index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::VertexCMVsByComponent& unique_vertex_cmvs ) const
+    {
+        const auto lines =
+            internal::unique_components( unique_vertex_cmvs.lines );
+        if( lines.empty() )
         {
             return std::nullopt;
         }
-        for( const auto& cmv :
-            brep_.component_mesh_vertices( unique_vertex_index ) )
+        for( const auto surface_cmv_id :
+            Indices{ unique_vertex_cmvs.surface_cmvs } )
         {
-            if( cmv.component_id.type() != Surface3D::component_type_static() )
-            {
-                continue;
-            }
+            const auto& cmv = unique_vertex_cmvs.surface_cmvs[surface_cmv_id];
             const auto& surface = brep_.surface( cmv.component_id.id() );
             if( surface.mesh().is_vertex_on_border( cmv.vertex ) )
             {
                 continue;
             }
-            for( const auto& line_id : line_uuids )
+            const auto surface_index =
+                unique_vertex_cmvs.surfaces[surface_cmv_id];
+            for( const auto line : lines )
             {
-                const auto& line = brep_.line( line_id );
-                if( line.is_active()
-                    && ( brep_.is_boundary( line, surface )
-                         || brep_.is_internal( line, surface ) ) )
+                if( relationships.is_active( line )
+                    && ( relationships.is_boundary( line, surface_index )
+                         || relationships.is_internal( line, surface_index ) ) )
                 {
                     return absl::StrCat( "unique vertex ", unique_vertex_index,
                         " is part of a Line and of Surface ",
@@ -366,15 +412,28 @@ namespace geode
         BRepSurfacesTopology::surface_facet_has_wrong_component_facets_around(
             const Surface3D& surface, const index_t facet_index ) const
     {
+        return surface_facet_has_wrong_component_facets_around(
+            internal::ModelRelationships{ brep_ }, surface, facet_index );
+    }
+
+    std::optional< std::string >
+        BRepSurfacesTopology::surface_facet_has_wrong_component_facets_around(
+            const internal::ModelRelationships& relationships,
+            const Surface3D& surface,
+            const index_t facet_index ) const
+    {
+        const auto surface_index =
+            relationships.component_index( surface.id() );
         const auto cmp = component_mesh_polygons( brep_, surface, facet_index );
         for( const auto& [block_id, block_facets] : cmp.block_polygons )
         {
-            const auto& block = brep_.block( block_id );
-            if( !block.is_active() )
+            const auto block_index = relationships.component_index( block_id );
+            if( !relationships.is_active( block_index ) )
             {
                 continue;
             }
-            if( brep_.is_boundary( surface, block ) )
+            const auto& block = brep_.block( block_id );
+            if( relationships.is_boundary( surface_index, block_index ) )
             {
                 if( block_facets.size() != 1 )
                 {
@@ -387,7 +446,7 @@ namespace geode
                 }
                 continue;
             }
-            if( brep_.is_internal( surface, block ) )
+            if( relationships.is_internal( surface_index, block_index ) )
             {
                 if( block_facets.size() != 2 )
                 {
@@ -413,9 +472,33 @@ namespace geode
 
     BRepSurfacesTopologyInspectionResult
         BRepSurfacesTopology::inspect_surfaces_topology() const
+    {
+        const internal::ModelUniqueVertices unique_vertices{ brep_,
+            { internal::ModelUniqueVertices::ComponentKind::surface } };
+        const internal::ModelRelationships relationships{ brep_ };
+        auto result =
+            inspect_surfaces_components( unique_vertices, relationships );
+        internal::for_each_unique_vertex_chunk( brep_.nb_unique_vertices(),
+            result,
+            [this, &relationships]( index_t unique_vertex_id,
+                BRepSurfacesTopologyInspectionResult& chunk_result ) {
+                add_unique_vertex_surfaces_issues( unique_vertex_id,
+                    relationships,
+                    internal::vertex_cmvs_by_component(
+                        brep_, relationships, unique_vertex_id ),
+                    chunk_result );
+            } );
+        return result;
+    }
+
+    BRepSurfacesTopologyInspectionResult
+        BRepSurfacesTopology::inspect_surfaces_components(
+            const internal::ModelUniqueVertices& unique_vertices,
+            const internal::ModelRelationships& relationships ) const
     {
         BRepSurfacesTopologyInspectionResult result;
-        const auto meshed_blocks = internal::brep_blocks_are_meshed( brep_ );
+        const auto meshed_blocks = relationships.are_meshed(
+            internal::ModelRelationships::ComponentKind::block );
         for( const auto& surface : brep_.active_surfaces() )
         {
             if( !surface_is_meshed( brep_.surface( surface.id() ) ) )
@@ -428,7 +511,7 @@ namespace geode
 
             auto surface_result = internal::
                 model_component_vertices_not_associated_to_unique_vertices(
-                    brep_, surface.component_id(), surface.mesh() );
+                    unique_vertices, surface.id() );
             if( surface_result.nb_issues() != 0 )
             {
                 surface_result.set_description( absl::StrCat( "Surface ",
@@ -453,7 +536,7 @@ namespace geode
             {
                 if( const auto problem_message =
                         surface_facet_has_wrong_component_facets_around(
-                            surface, facet_id ) )
+                            relationships, surface, facet_id ) )
                 {
                     surface_facets_with_wrong_cme.add_issue(
                         facet_id, problem_message.value() );
@@ -466,35 +549,39 @@ namespace geode
                         std::move( surface_facets_with_wrong_cme ) );
             }
         }
-        for( const auto unique_vertex_id : Range{ brep_.nb_unique_vertices() } )
+        return result;
+    }
+
+    void BRepSurfacesTopology::add_unique_vertex_surfaces_issues(
+        index_t unique_vertex_index,
+        const internal::ModelRelationships& relationships,
+        const internal::VertexCMVsByComponent& unique_vertex_cmvs,
+        BRepSurfacesTopologyInspectionResult& result ) const
+    {
+        if( const auto invalid_internal_topology =
+                vertex_is_part_of_invalid_embedded_surface(
+                    unique_vertex_index, relationships, unique_vertex_cmvs ) )
         {
-            if( const auto invalid_internal_topology =
-                    vertex_is_part_of_invalid_embedded_surface(
-                        unique_vertex_id ) )
-            {
-                result
-                    .unique_vertices_linked_to_a_surface_with_invalid_embbedings
-                    .add_issue(
-                        unique_vertex_id, invalid_internal_topology.value() );
-            }
-            if( const auto invalid_multiple_surfaces =
-                    vertex_is_part_of_invalid_multiple_surfaces(
-                        unique_vertex_id ) )
-            {
-                result.unique_vertices_linked_to_several_and_invalid_surfaces
-                    .add_issue(
-                        unique_vertex_id, invalid_multiple_surfaces.value() );
-            }
-            if( const auto line_and_not_on_surface_border =
-                    vertex_is_part_of_line_and_not_on_surface_border(
-                        unique_vertex_id ) )
-            {
-                result
-                    .unique_vertices_linked_to_a_line_but_is_not_on_a_surface_border
-                    .add_issue( unique_vertex_id,
-                        line_and_not_on_surface_border.value() );
-            }
+            result.unique_vertices_linked_to_a_surface_with_invalid_embbedings
+                .add_issue(
+                    unique_vertex_index, invalid_internal_topology.value() );
+        }
+        if( const auto invalid_multiple_surfaces =
+                vertex_is_part_of_invalid_multiple_surfaces(
+                    unique_vertex_index, relationships, unique_vertex_cmvs ) )
+        {
+            result.unique_vertices_linked_to_several_and_invalid_surfaces
+                .add_issue(
+                    unique_vertex_index, invalid_multiple_surfaces.value() );
+        }
+        if( const auto line_and_not_on_surface_border =
+                vertex_is_part_of_line_and_not_on_surface_border(
+                    unique_vertex_index, relationships, unique_vertex_cmvs ) )
+        {
+            result
+                .unique_vertices_linked_to_a_line_but_is_not_on_a_surface_border
+                .add_issue( unique_vertex_index,
+                    line_and_not_on_surface_border.value() );
         }
-        return result;
     }
 } // namespace geode
@@ -39,6 +39,10 @@
 #include <geode/model/mixin/core/surface.hpp>
 #include <geode/model/representation/core/brep.hpp>
 
+#include <geode/inspector/inspection/criterion/internal/model_unique_vertices.hpp>
+#include <geode/inspector/inspection/topology/internal/model_relationships.hpp>
+#include <geode/inspector/inspection/topology/internal/unique_vertices_topology.hpp>
+
 namespace geode
 {
     index_t BRepTopologyInspectionResult::nb_issues() const
@@ -98,45 +102,58 @@ namespace geode
         }
 
         void add_unique_vertices_with_wrong_cmv_link(
+            const internal::ModelUniqueVertices& unique_vertices,
             BRepTopologyInspectionResult& brep_issues ) const
         {
-            auto& not_linked_result =
-                brep_issues.unique_vertices_not_linked_to_any_component;
-            auto& linked_to_inexistant_result =
-                brep_issues.unique_vertices_linked_to_inexistant_cmv;
-            auto& linked_to_nonbijective_result =
-                brep_issues.unique_vertices_nonbijectively_linked_to_cmv;
-            for( const auto uv_id : Range{ brep_.nb_unique_vertices() } )
-            {
-                const auto& unique_vertex_cmvs =
-                    brep_.component_mesh_vertices( uv_id );
-                if( unique_vertex_cmvs.empty() )
-                {
-                    not_linked_result.add_issue(
-                        uv_id, absl::StrCat( "unique vertex ", uv_id,
-                                   " is not linked to any mesh vertex." ) );
-                    continue;
-                }
-                for( const auto& cmv : unique_vertex_cmvs )
-                {
-                    if( !cmv_exists_in_brep( cmv ) )
+            internal::UniqueVerticesCMVLinkIssues link_issues;
+            internal::for_each_unique_vertex_chunk( brep_.nb_unique_vertices(),
+                link_issues,
+                [this, &unique_vertices]( index_t uv_id,
+                    internal::UniqueVerticesCMVLinkIssues& chunk_issues ) {
+                    const auto& unique_vertex_cmvs =
+                        brep_.component_mesh_vertices( uv_id );
+                    if( unique_vertex_cmvs.empty() )
                     {
-                        linked_to_inexistant_result.add_issue(
+                        chunk_issues.not_linked_to_any_component.add_issue(
                             uv_id, absl::StrCat( "unique vertex ", uv_id,
-                                       " is linked to inexistant mesh vertex [",
-                                       cmv.string(), "]." ) );
-                        continue;
+                                       " is not linked to any mesh vertex." ) );
+                        return;
                     }
-                    if( brep_.component( cmv.component_id.id() ).is_active()
-                        && brep_.unique_vertex( cmv ) != uv_id )
+                    for( const auto& cmv : unique_vertex_cmvs )
                     {
-                        linked_to_nonbijective_result.add_issue(
-                            uv_id, absl::StrCat( "unique vertex ", uv_id,
-                                       " is linked to inexistant mesh vertex [",
-                                       cmv.string(), "]." ) );
+                        const auto component = unique_vertices.component_index(
+                            cmv.component_id.id() );
+                        if( !internal::component_mesh_vertex_exists(
+                                unique_vertices, component, cmv ) )
+                        {
+                            chunk_issues.linked_to_inexistant_cmv.add_issue(
+                                uv_id,
+                                absl::StrCat( "unique vertex ", uv_id,
+                                    " is linked to inexistant mesh vertex [",
+                                    cmv.string(), "]." ) );
+                            continue;
+                        }
+                        if( unique_vertices.is_active( component )
+                            && unique_vertices.unique_vertex(
+                                   component, cmv.vertex )
+                                   != uv_id )
+                        {
+                            chunk_issues.nonbijectively_linked_to_cmv.add_issue(
+                                uv_id,
+                                absl::StrCat( "unique vertex ", uv_id,
+                                    " is linked to inexistant mesh vertex [",
+                                    cmv.string(), "]." ) );
+                        }
                     }
-                }
-            }
+                } );
+            brep_issues.unique_vertices_not_linked_to_any_component
+                .append_issues( std::move(
+                    link_issues.not_linked_to_any_component ) );
+            brep_issues.unique_vertices_linked_to_inexistant_cmv.append_issues(
+                std::move( link_issues.linked_to_inexistant_cmv ) );
+            brep_issues.unique_vertices_nonbijectively_linked_to_cmv
+                .append_issues( std::move(
+                    link_issues.nonbijectively_linked_to_cmv ) );
         }
 
         bool brep_topology_is_valid(
@@ -155,17 +172,21 @@ namespace geode
             {
                 return false;
             }
+            const internal::ModelRelationships relationships{ brep_ };
             for( const auto unique_vertex_id :
                 Range{ brep_.nb_unique_vertices() } )
             {
+                const auto unique_vertex_cmvs =
+                    internal::vertex_cmvs_by_component(
+                        brep_, relationships, unique_vertex_id );
                 if( !brep_topology_inspector.brep_corner_topology_is_valid(
-                        unique_vertex_id )
+                        unique_vertex_id, relationships, unique_vertex_cmvs )
                     || !brep_topology_inspector.brep_lines_topology_is_valid(
-                        unique_vertex_id )
+                        unique_vertex_id, relationships, unique_vertex_cmvs )
                     || !brep_topology_inspector.brep_surfaces_topology_is_valid(
-                        unique_vertex_id )
+                        unique_vertex_id, relationships, unique_vertex_cmvs )
                     || !brep_topology_inspector.brep_blocks_topology_is_valid(
-                        unique_vertex_id ) )
+                        unique_vertex_id, relationships, unique_vertex_cmvs ) )
                 {
                     return false;
                 }
@@ -175,36 +196,118 @@ namespace geode
 
         BRepTopologyInspectionResult inspect_brep_topology(
             const BRepTopologyInspector& brep_topology_inspector ) const
+        {
+            return inspect_brep_topology( brep_topology_inspector,
+                internal::ModelUniqueVertices{ brep_ } );
+        }
+
+        BRepTopologyInspectionResult inspect_brep_topology(
+            const BRepTopologyInspector& brep_topology_inspector,
+            const internal::ModelUniqueVertices& unique_vertices ) const
         {
             BRepTopologyInspectionResult result;
             try
             {
+                const internal::ModelRelationships relationships{ brep_ };
+                const auto has_active_blocks = brep_.nb_active_blocks() != 0;
+                internal::BRepBlocksTopologyContext blocks_context;
                 async::parallel_invoke(
-                    [&result, &brep_topology_inspector] {
+                    [&result, &brep_topology_inspector, &unique_vertices] {
                         result.corners =
-                            brep_topology_inspector.inspect_corners_topology();
+                            brep_topology_inspector.inspect_corners_components(
+                                unique_vertices );
                     },
-                    [&result, &brep_topology_inspector] {
+                    [&result, &brep_topology_inspector, &unique_vertices,
+                        &relationships] {
                         result.lines =
-                            brep_topology_inspector.inspect_lines_topology();
+                            brep_topology_inspector.inspect_lines_components(
+                                unique_vertices, relationships );
                     },
-                    [&result, &brep_topology_inspector] {
+                    [&result, &brep_topology_inspector, &unique_vertices,
+                        &relationships] {
                         result.surfaces =
-                            brep_topology_inspector.inspect_surfaces_topology();
+                            brep_topology_inspector.inspect_surfaces_components(
+                                unique_vertices, relationships );
                     },
-                    [&result, &brep_topology_inspector] {
+                    [&result, &blocks_context, &brep_topology_inspector,
+                        &unique_vertices, &relationships, has_active_blocks] {
+                        if( !has_active_blocks )
+                        {
+                            return;
+                        }
                         result.blocks =
-                            brep_topology_inspector.inspect_blocks();
+                            brep_topology_inspector.inspect_blocks_components(
+                                unique_vertices, relationships );
+                        blocks_context =
+                            brep_topology_inspector.blocks_topology_context(
+                                relationships );
                     } );
+                add_unique_vertices_topology_issues( brep_topology_inspector,
+                    relationships, has_active_blocks, blocks_context, result );
             }
             catch( OpenGeodeException& )
             {
             }
-            add_unique_vertices_with_wrong_cmv_link( result );
+            add_unique_vertices_with_wrong_cmv_link( unique_vertices, result );
             return result;
         }
 
     private:
+        /*!
+         * Single pass over the unique vertices: the component mesh vertices
+         * of each unique vertex are sorted by type and mapped to the
+         * relationships dense indices once, then given to the Corners,
+         * Lines, Surfaces and Blocks checks.
+         */
+        void add_unique_vertices_topology_issues(
+            const BRepTopologyInspector& brep_topology_inspector,
+            const internal::ModelRelationships& relationships,
+            bool has_active_blocks,
+            const internal::BRepBlocksTopologyContext& blocks_context,
+            BRepTopologyInspectionResult& result ) const
+        {
+            internal::for_each_unique_vertex_chunk(
+                brep_.nb_unique_vertices(), result,
+                [this, &brep_topology_inspector, &relationships,
+                    has_active_blocks, &blocks_context](
+                    index_t unique_vertex_id,
+                    BRepTopologyInspectionResult& chunk_result ) {
+                    const auto unique_vertex_cmvs =
+                        internal::vertex_cmvs_by_component(
+                            brep_, relationships, unique_vertex_id );
+                    brep_topology_inspector.add_unique_vertex_corners_issues(
+                        unique_vertex_id, relationships, unique_vertex_cmvs,
+                        chunk_result.corners );
+                    brep_topology_inspector.add_unique_vertex_lines_issues(
+                        unique_vertex_id, relationships, unique_vertex_cmvs,
+                        chunk_result.lines );
+                    brep_topology_inspector.add_unique_vertex_surfaces_issues(
+                        unique_vertex_id, relationships, unique_vertex_cmvs,
+                        chunk_result.surfaces );
+                    if( has_active_blocks )
+                    {
+                        brep_topology_inspector
+                            .add_unique_vertex_blocks_issues( unique_vertex_id,
+                                relationships, unique_vertex_cmvs,
+                                blocks_context, chunk_result.blocks );
+                    }
+                },
+                []( BRepTopologyInspectionResult& merged_result,
+                    BRepTopologyInspectionResult&& chunk_result ) {
+                    internal::append_unique_vertices_issues(
+                        merged_result.corners,
+                        std::move( chunk_result.corners ) );
+                    internal::append_unique_vertices_issues(
+                        merged_result.lines, std::move( chunk_result.lines ) );
+                    internal::append_unique_vertices_issues(
+                        merged_result.surfaces,
+                        std::move( chunk_result.surfaces ) );
+                    internal::append_unique_vertices_issues(
+                        merged_result.blocks,
+                        std::move( chunk_result.blocks ) );
+                } );
+        }
+
         bool cmv_exists_in_brep( const ComponentMeshVertex& cmv ) const
         {
             if( cmv.component_id.type() == Corner3D::component_type_static() )
@@ -329,4 +432,10 @@ namespace geode
     {
         return impl_->inspect_brep_topology( *this );
     }
+
+    BRepTopologyInspectionResult BRepTopologyInspector::inspect_brep_topology(
+        const internal::ModelUniqueVertices& unique_vertices ) const
+    {
+        return impl_->inspect_brep_topology( *this, unique_vertices );
+    }
 } // namespace geode
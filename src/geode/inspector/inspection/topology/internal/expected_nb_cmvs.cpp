@@ -23,7 +23,7 @@
 
 #include <geode/inspector/inspection/topology/internal/expected_nb_cmvs.hpp>
 
-#include <absl/container/flat_hash_set.h>
+#include <absl/algorithm/container.h>
 
 #include <geode/basic/logger.hpp>
 
@@ -37,36 +37,28 @@
 #include <geode/model/mixin/core/surface.hpp>
 #include <geode/model/representation/core/brep.hpp>
 
+#include <geode/inspector/inspection/topology/internal/model_relationships.hpp>
+
 namespace
 {
-    template < typename Condition >
-    geode::index_t count_cmvs(
-        absl::Span< const geode::ComponentMeshVertex > cmvs,
-        const Condition& condition )
-    {
-        geode::index_t counter{ 0 };
-        for( const auto& cmv : cmvs )
-        {
-            if( condition( cmv ) )
-            {
-                counter++;
-            }
-        }
-        return counter;
-    }
+    constexpr auto SURFACE =
+        geode::internal::ModelRelationships::ComponentKind::surface;
+    constexpr auto BLOCK =
+        geode::internal::ModelRelationships::ComponentKind::block;
 
-    geode::index_t line_on_block_boundary_count( const geode::BRep& brep,
-        const geode::Line3D& line,
-        const geode::Block3D& block )
+    geode::index_t line_on_block_boundary_count(
+        const geode::internal::ModelRelationships& relationships,
+        geode::index_t line,
+        geode::index_t block )
     {
         geode::index_t counter{ 0 };
-        for( const auto& boundary_surface : brep.boundaries( block ) )
+        for( const auto boundary_surface : relationships.boundaries( block ) )
         {
-            if( brep.is_boundary( line, boundary_surface ) )
+            if( relationships.is_boundary( line, boundary_surface ) )
             {
                 counter++;
             }
-            if( brep.is_internal( line, boundary_surface ) )
+            if( relationships.is_internal( line, boundary_surface ) )
             {
                 counter += 2;
             }
@@ -75,13 +67,14 @@ namespace
         return counter;
     }
 
-    bool line_is_inside_block( const geode::BRep& brep,
-        const geode::Line3D& line,
-        const geode::Block3D& block )
+    bool line_is_inside_block(
+        const geode::internal::ModelRelationships& relationships,
+        geode::index_t line,
+        geode::index_t block )
     {
-        for( const auto& incident_surface : brep.incidences( line ) )
+        for( const auto incident_surface : relationships.incidences( line ) )
         {
-            if( !brep.is_internal( incident_surface, block ) )
+            if( !relationships.is_internal( incident_surface, block ) )
             {
                 return false;
             }
@@ -91,26 +84,24 @@ namespace
 
     std::pair< geode::index_t, std::optional< std::string > >
         expected_block_cmvs_and_error( const geode::BRep& brep,
+            const geode::internal::ModelRelationships& relationships,
             geode::index_t unique_vertex_id,
-            const geode::uuid& block_uuid,
+            geode::index_t block_id,
             const geode::internal::VertexCMVsByComponent& unique_vertex_cmvs )
     {
-        const auto nb_block_cmvs = count_cmvs(
-            unique_vertex_cmvs.block_cmvs, [&block_uuid]( const auto& cmv ) {
-                return cmv.component_id.id() == block_uuid;
-            } );
+        const auto nb_block_cmvs = static_cast< geode::index_t >(
+            absl::c_count( unique_vertex_cmvs.blocks, block_id ) );
+        const auto& block_uuid = relationships.component_id( block_id ).id();
         const auto& block = brep.block( block_uuid );
         geode::index_t nb_boundary_surface_cmvs{ 0 };
         geode::index_t nb_internal_surface_cmvs{ 0 };
-        for( const auto& cmv : unique_vertex_cmvs.surface_cmvs )
+        for( const auto surface_id : unique_vertex_cmvs.surfaces )
         {
-            if( brep.is_boundary(
-                    brep.surface( cmv.component_id.id() ), block ) )
+            if( relationships.is_boundary( surface_id, block_id ) )
             {
                 nb_boundary_surface_cmvs++;
             }
-            else if( brep.is_internal(
-                         brep.surface( cmv.component_id.id() ), block ) )
+            else if( relationships.is_internal( surface_id, block_id ) )
             {
                 nb_internal_surface_cmvs++;
             }
@@ -121,15 +112,14 @@ namespace
         geode::index_t nb_line_internal_to_internal_surface_cmvs{ 0 };
         geode::index_t nb_free_line_cmvs{ 0 };
         geode::index_t nb_line_boundary_to_several_internal_surfaces_cmvs{ 0 };
-        for( const auto& cmv : unique_vertex_cmvs.line_cmvs )
+        for( const auto line_id : unique_vertex_cmvs.lines )
         {
-            const auto& cmv_line = brep.line( cmv.component_id.id() );
-            if( brep.nb_embedding_blocks( cmv_line ) != 0 )
+            if( !relationships.embeddings( line_id, BLOCK ).empty() )
             {
                 continue;
             }
-            const auto boundary_count =
-                line_on_block_boundary_count( brep, cmv_line, block );
+            const auto boundary_count = line_on_block_boundary_count(
+                relationships, line_id, block_id );
             if( boundary_count > 0 )
             {
                 nb_line_on_boundary_cmvs += boundary_count;
@@ -140,12 +130,14 @@ namespace
                 }
                 continue;
             }
-            if( brep.nb_embedding_surfaces( cmv_line ) > 0 )
+            const auto embedding_surfaces =
+                relationships.embeddings( line_id, SURFACE );
+            if( !embedding_surfaces.empty() )
             {
-                for( const auto& incident_surface :
-                    brep.embedding_surfaces( cmv_line ) )
+                for( const auto embedding_surface : embedding_surfaces )
                 {
-                    if( brep.is_internal( incident_surface, block ) )
+                    if( relationships.is_internal(
+                            embedding_surface, block_id ) )
                     {
                         nb_line_internal_to_internal_surface_cmvs++;
                         break;
@@ -153,11 +145,11 @@ namespace
                 }
                 continue;
             }
-            if( !line_is_inside_block( brep, cmv_line, block ) )
+            if( !line_is_inside_block( relationships, line_id, block_id ) )
             {
                 continue;
             }
-            if( brep.nb_incidences( cmv.component_id.id() ) == 1 )
+            if( relationships.incidences( line_id ).size() == 1 )
             {
                 nb_free_line_cmvs++;
                 continue;
@@ -235,53 +227,64 @@ namespace geode
 {
     namespace internal
     {
-        VertexCMVsByComponent vertex_cmvs_by_component(
-            const BRep& brep, index_t unique_vertex_id )
+        VertexCMVsByComponent vertex_cmvs_by_component( const BRep& brep,
+            const ModelComponentIndices& components,
+            index_t unique_vertex_id )
         {
             VertexCMVsByComponent result;
             for( const auto& cmv :
                 brep.component_mesh_vertices( unique_vertex_id ) )
             {
-                if( cmv.component_id.type()
-                    == Block3D::component_type_static() )
+                const auto component =
+                    components.component_index( cmv.component_id.id() );
+                if( component == NO_ID )
                 {
-                    result.block_cmvs.push_back( cmv );
+                    continue;
                 }
-                if( cmv.component_id.type()
-                    == Surface3D::component_type_static() )
+                switch( components.kind( component ) )
                 {
+                case ModelComponentIndices::ComponentKind::block:
+                    result.block_cmvs.push_back( cmv );
+                    result.blocks.push_back( component );
+                    break;
+                case ModelComponentIndices::ComponentKind::surface:
                     result.surface_cmvs.push_back( cmv );
-                }
-                if( cmv.component_id.type() == Line3D::component_type_static() )
-                {
+                    result.surfaces.push_back( component );
+                    break;
+                case ModelComponentIndices::ComponentKind::line:
                     result.line_cmvs.push_back( cmv );
-                }
-                if( cmv.component_id.type()
-                    == Corner3D::component_type_static() )
-                {
+                    result.lines.push_back( component );
+                    break;
+                case ModelComponentIndices::ComponentKind::corner:
                     result.corner_cmvs.push_back( cmv );
+                    result.corners.push_back( component );
+                    break;
                 }
             }
             return result;
         }
 
         index_t nb_expected_block_cmvs( const BRep& brep,
+            const ModelRelationships& relationships,
             index_t unique_vertex_id,
-            const geode::uuid& block_uuid,
+            index_t block,
             const VertexCMVsByComponent& unique_vertex_cmvs )
         {
-            return std::get< 0 >( expected_block_cmvs_and_error(
-                brep, unique_vertex_id, block_uuid, unique_vertex_cmvs ) );
+            return std::get< 0 >( expected_block_cmvs_and_error( brep,
+                relationships, unique_vertex_id, block,
+                unique_vertex_cmvs ) );
         }
 
         std::optional< std::string > wrong_nb_expected_block_cmvs(
             const BRep& brep,
+            const ModelRelationships& relationships,
             index_t unique_vertex_id,
-            const geode::uuid& block_uuid,
+            index_t block,
             const VertexCMVsByComponent& unique_vertex_cmvs )
         {
-            return std::get< 1 >( expected_block_cmvs_and_error(
-                brep, unique_vertex_id, block_uuid, unique_vertex_cmvs ) );
+            return std::get< 1 >( expected_block_cmvs_and_error( brep,
+                relationships, unique_vertex_id, block,
+                unique_vertex_cmvs ) );
         }
     } // namespace internal
 } // namespace geode
\ No newline at end of file
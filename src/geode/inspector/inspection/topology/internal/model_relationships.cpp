@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/inspector/inspection/topology/internal/model_relationships.hpp>
+
+#include <algorithm>
+
+#include <geode/basic/range.hpp>
+
+#include <geode/mesh/core/edged_curve.hpp>
+#include <geode/mesh/core/point_set.hpp>
+#include <geode/mesh/core/solid_mesh.hpp>
+#include <geode/mesh/core/surface_mesh.hpp>
+
+#include <geode/model/mixin/core/block.hpp>
+#include <geode/model/mixin/core/corner.hpp>
+#include <geode/model/mixin/core/line.hpp>
+#include <geode/model/mixin/core/relationships.hpp>
+#include <geode/model/mixin/core/surface.hpp>
+#include <geode/model/representation/core/brep.hpp>
+#include <geode/model/representation/core/section.hpp>
+
+namespace
+{
+    template < geode::index_t dimension >
+    bool component_is_meshed( const geode::Corner< dimension >& corner )
+    {
+        return corner.mesh().nb_vertices() != 0;
+    }
+
+    template < geode::index_t dimension >
+    bool component_is_meshed( const geode::Line< dimension >& line )
+    {
+        return line.mesh().nb_edges() != 0;
+    }
+
+    template < geode::index_t dimension >
+    bool component_is_meshed( const geode::Surface< dimension >& surface )
+    {
+        return surface.mesh().nb_polygons() != 0;
+    }
+
+    bool component_is_meshed( const geode::Block3D& block )
+    {
+        return block.mesh().nb_polyhedra() != 0;
+    }
+} // namespace
+
+namespace geode
+{
+    namespace internal
+    {
+        ModelRelationships::ModelRelationships( const Section& section )
+            : ModelComponentIndices( section )
+        {
+            add_meshed_states( section.corners(), ComponentKind::corner );
+            add_meshed_states( section.lines(), ComponentKind::line );
+            add_meshed_states( section.surfaces(), ComponentKind::surface );
+            build_relations( section );
+        }
+
+        ModelRelationships::ModelRelationships( const BRep& brep )
+            : ModelComponentIndices( brep )
+        {
+            add_meshed_states( brep.corners(), ComponentKind::corner );
+            add_meshed_states( brep.lines(), ComponentKind::line );
+            add_meshed_states( brep.surfaces(), ComponentKind::surface );
+            add_meshed_states( brep.blocks(), ComponentKind::block );
+            build_relations( brep );
+        }
+
+        template < typename Components >
+        void ModelRelationships::add_meshed_states(
+            const Components& components, ComponentKind kind )
+        {
+            const auto kind_id = static_cast< index_t >( kind );
+            for( const auto& component : components )
+            {
+                const auto meshed = component_is_meshed( component );
+                meshed_.push_back( meshed );
+                kind_meshed_[kind_id] = kind_meshed_[kind_id] && meshed;
+            }
+        }
+
+        void ModelRelationships::build_relations(
+            const Relationships& relationships )
+        {
+            const auto build_adjacency = [this]( const auto& relations ) {
+                Adjacency adjacency;
+                adjacency.offsets.reserve( nb_components() + 1 );
+                adjacency.offsets.push_back( 0 );
+                for( const auto component : Range{ nb_components() } )
+                {
+                    for( const auto& relation :
+                        relations( component_id( component ).id() ) )
+                    {
+                        const auto other = component_index( relation.id() );
+                        if( other != NO_ID )
+                        {
+                            adjacency.values.push_back( other );
+                        }
+                    }
+                    std::sort( adjacency.values.begin()
+                                   + adjacency.offsets.back(),
+                        adjacency.values.end() );
+                    adjacency.offsets.push_back( adjacency.values.size() );
+                }
+                return adjacency;
+            };
+            boundaries_ = build_adjacency( [&relationships]( const uuid& id ) {
+                return relationships.boundaries( id );
+            } );
+            incidences_ = build_adjacency( [&relationships]( const uuid& id ) {
+                return relationships.incidences( id );
+            } );
+            internals_ = build_adjacency( [&relationships]( const uuid& id ) {
+                return relationships.internals( id );
+            } );
+            embeddings_ = build_adjacency( [&relationships]( const uuid& id ) {
+                return relationships.embeddings( id );
+            } );
+        }
+
+        bool ModelRelationships::is_meshed( index_t component ) const
+        {
+            return component < meshed_.size() && meshed_[component];
+        }
+
+        bool ModelRelationships::are_meshed( ComponentKind kind ) const
+        {
+            return kind_meshed_[static_cast< index_t >( kind )];
+        }
+
+        absl::Span< const index_t > ModelRelationships::boundaries(
+            index_t component ) const
+        {
+            return boundaries_.row( component );
+        }
+
+        absl::Span< const index_t > ModelRelationships::incidences(
+            index_t component ) const
+        {
+            return incidences_.row( component );
+        }
+
+        absl::Span< const index_t > ModelRelationships::internals(
+            index_t component ) const
+        {
+            return internals_.row( component );
+        }
+
+        absl::Span< const index_t > ModelRelationships::embeddings(
+            index_t component ) const
+        {
+            return embeddings_.row( component );
+        }
+
+        absl::Span< const index_t > ModelRelationships::embeddings(
+            index_t component, ComponentKind kind ) const
+        {
+            return restrict_to_kind( embeddings_.row( component ), kind );
+        }
+
+        bool ModelRelationships::is_boundary(
+            index_t boundary, index_t incidence ) const
+        {
+            return boundaries_.contains( incidence, boundary );
+        }
+
+        bool ModelRelationships::is_internal(
+            index_t internal, index_t embedding ) const
+        {
+            return internals_.contains( embedding, internal );
+        }
+
+        absl::Span< const index_t > ModelRelationships::restrict_to_kind(
+            absl::Span< const index_t > components, ComponentKind kind ) const
+        {
+            const auto bounds = kind_bounds( kind );
+            const auto begin = std::lower_bound(
+                components.begin(), components.end(), bounds.first );
+            const auto end =
+                std::lower_bound( begin, components.end(), bounds.second );
+            return components.subspan(
+                std::distance( components.begin(), begin ),
+                std::distance( begin, end ) );
+        }
+
+        absl::Span< const index_t > ModelRelationships::Adjacency::row(
+            index_t component ) const
+        {
+            if( component + 1 >= offsets.size() )
+            {
+                return {};
+            }
+            return absl::MakeConstSpan( values ).subspan( offsets[component],
+                offsets[component + 1] - offsets[component] );
+        }
+
+        bool ModelRelationships::Adjacency::contains(
+            index_t component, index_t other ) const
+        {
+            const auto components = row( component );
+            return std::binary_search(
+                components.begin(), components.end(), other );
+        }
+    } // namespace internal
+} // namespace geode
@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/inspector/inspection/topology/internal/unique_vertices_topology.hpp>
+
+#include <absl/algorithm/container.h>
+
+#include <geode/basic/algorithm.hpp>
+
+#include <geode/model/representation/core/section.hpp>
+
+#include <geode/inspector/inspection/criterion/internal/model_unique_vertices.hpp>
+#include <geode/inspector/inspection/topology/brep_blocks_topology.hpp>
+#include <geode/inspector/inspection/topology/brep_corners_topology.hpp>
+#include <geode/inspector/inspection/topology/brep_lines_topology.hpp>
+#include <geode/inspector/inspection/topology/brep_surfaces_topology.hpp>
+#include <geode/inspector/inspection/topology/section_corners_topology.hpp>
+#include <geode/inspector/inspection/topology/section_lines_topology.hpp>
+#include <geode/inspector/inspection/topology/section_surfaces_topology.hpp>
+
+namespace geode
+{
+    namespace internal
+    {
+        SectionVertexCMVsByComponent vertex_cmvs_by_component(
+            const Section& section,
+            const ModelComponentIndices& components,
+            index_t unique_vertex_id )
+        {
+            SectionVertexCMVsByComponent result;
+            for( const auto& cmv :
+                section.component_mesh_vertices( unique_vertex_id ) )
+            {
+                const auto component =
+                    components.component_index( cmv.component_id.id() );
+                if( component == NO_ID )
+                {
+                    continue;
+                }
+                switch( components.kind( component ) )
+                {
+                case ModelComponentIndices::ComponentKind::surface:
+                    result.surface_cmvs.push_back( cmv );
+                    result.surfaces.push_back( component );
+                    break;
+                case ModelComponentIndices::ComponentKind::line:
+                    result.line_cmvs.push_back( cmv );
+                    result.lines.push_back( component );
+                    break;
+                case ModelComponentIndices::ComponentKind::corner:
+                    result.corner_cmvs.push_back( cmv );
+                    result.corners.push_back( component );
+                    break;
+                default:
+                    break;
+                }
+            }
+            return result;
+        }
+
+        std::vector< index_t > unique_components(
+            absl::Span< const index_t > components )
+        {
+            std::vector< index_t > result{ components.begin(),
+                components.end() };
+            sort_unique( result );
+            return result;
+        }
+
+        bool component_mesh_vertex_exists(
+            const ModelUniqueVertices& unique_vertices,
+            index_t component,
+            const ComponentMeshVertex& component_mesh_vertex )
+        {
+            if( component == NO_ID
+                || unique_vertices.component_id( component ).type()
+                       != component_mesh_vertex.component_id.type() )
+            {
+                return false;
+            }
+            return component_mesh_vertex.vertex
+                   < unique_vertices.component_unique_vertices( component )
+                         .size();
+        }
+
+        bool vertex_is_linked_to_component(
+            const VertexCMVsByComponent& unique_vertex_cmvs,
+            index_t component )
+        {
+            return absl::c_linear_search( unique_vertex_cmvs.blocks, component )
+                   || absl::c_linear_search(
+                       unique_vertex_cmvs.surfaces, component )
+                   || absl::c_linear_search(
+                       unique_vertex_cmvs.lines, component )
+                   || absl::c_linear_search(
+                       unique_vertex_cmvs.corners, component );
+        }
+
+        bool vertex_is_linked_to_component(
+            const SectionVertexCMVsByComponent& unique_vertex_cmvs,
+            index_t component )
+        {
+            return absl::c_linear_search(
+                       unique_vertex_cmvs.surfaces, component )
+                   || absl::c_linear_search(
+                       unique_vertex_cmvs.lines, component )
+                   || absl::c_linear_search(
+                       unique_vertex_cmvs.corners, component );
+        }
+
+        void append_unique_vertices_issues(
+            BRepCornersTopologyInspectionResult& result,
+            BRepCornersTopologyInspectionResult&& chunk_result )
+        {
+            result.unique_vertices_linked_to_multiple_corners.append_issues(
+                std::move(
+                    chunk_result.unique_vertices_linked_to_multiple_corners ) );
+            result.unique_vertices_linked_to_multiply_embedded_corner
+                .append_issues( std::move(
+                    chunk_result
+                        .unique_vertices_linked_to_multiply_embedded_corner ) );
+            result.unique_vertices_linked_to_not_internal_nor_boundary_corner
+                .append_issues( std::move(
+                    chunk_result
+                        .unique_vertices_linked_to_not_internal_nor_boundary_corner ) );
+            result.unique_vertices_linked_to_not_boundary_line_corner
+                .append_issues( std::move(
+                    chunk_result
+                        .unique_vertices_linked_to_not_boundary_line_corner ) );
+        }
+
+        void append_unique_vertices_issues(
+            BRepLinesTopologyInspectionResult& result,
+            BRepLinesTopologyInspectionResult&& chunk_result )
+        {
+            result
+                .unique_vertices_linked_to_line_with_wrong_relationship_to_surface
+                .append_issues( std::move(
+                    chunk_result
+                        .unique_vertices_linked_to_line_with_wrong_relationship_to_surface ) );
+            result.unique_vertices_linked_to_a_line_with_invalid_embeddings
+                .append_issues( std::move(
+                    chunk_result
+                        .unique_vertices_linked_to_a_line_with_invalid_embeddings ) );
+            result.unique_vertices_linked_to_a_single_and_invalid_line
+                .append_issues( std::move(
+                    chunk_result
+                        .unique_vertices_linked_to_a_single_and_invalid_line ) );
+            result
+                .unique_vertices_linked_to_several_lines_but_not_linked_to_a_corner
+                .append_issues( std::move(
+                    chunk_result
+                        .unique_vertices_linked_to_several_lines_but_not_linked_to_a_corner ) );
+        }
+
+        void append_unique_vertices_issues(
+            BRepSurfacesTopologyInspectionResult& result,
+            BRepSurfacesTopologyInspectionResult&& chunk_result )
+        {
+            result.unique_vertices_linked_to_a_surface_with_invalid_embbedings
+                .append_issues( std::move(
+                    chunk_result
+                        .unique_vertices_linked_to_a_surface_with_invalid_embbedings ) );
+            result.unique_vertices_linked_to_several_and_invalid_surfaces
+                .append_issues( std::move(
+                    chunk_result
+                        .unique_vertices_linked_to_several_and_invalid_surfaces ) );
+            result
+                .unique_vertices_linked_to_a_line_but_is_not_on_a_surface_border
+                .append_issues( std::move(
+                    chunk_result
+                        .unique_vertices_linked_to_a_line_but_is_not_on_a_surface_border ) );
+        }
+
+        void append_unique_vertices_issues(
+            BRepBlocksTopologyInspectionResult& result,
+            BRepBlocksTopologyInspectionResult&& chunk_result )
+        {
+            result.unique_vertices_part_of_two_blocks_and_no_boundary_surface
+                .append_issues( std::move(
+                    chunk_result
+                        .unique_vertices_part_of_two_blocks_and_no_boundary_surface ) );
+            result.unique_vertices_with_incorrect_block_cmvs_count
+                .append_issues( std::move(
+                    chunk_result
+                        .unique_vertices_with_incorrect_block_cmvs_count ) );
+            result
+                .unique_vertices_linked_to_surface_with_wrong_relationship_to_blocks
+                .append_issues( std::move(
+                    chunk_result
+                        .unique_vertices_linked_to_surface_with_wrong_relationship_to_blocks ) );
+            result.unique_vertices_linked_to_a_single_and_invalid_surface
+                .append_issues( std::move(
+                    chunk_result
+                        .unique_vertices_linked_to_a_single_and_invalid_surface ) );
+            result.unique_vertex_linked_to_multiple_invalid_surfaces
+                .append_issues( std::move(
+                    chunk_result
+                        .unique_vertex_linked_to_multiple_invalid_surfaces ) );
+        }
+
+        void append_unique_vertices_issues(
+            SectionCornersTopologyInspectionResult& result,
+            SectionCornersTopologyInspectionResult&& chunk_result )
+        {
+            result.unique_vertices_linked_to_multiple_corners.append_issues(
+                std::move(
+                    chunk_result.unique_vertices_linked_to_multiple_corners ) );
+            result.unique_vertices_linked_to_multiple_internals_corner
+                .append_issues( std::move(
+                    chunk_result
+                        .unique_vertices_linked_to_multiple_internals_corner ) );
+            result.unique_vertices_linked_to_not_internal_nor_boundary_corner
+                .append_issues( std::move(
+                    chunk_result
+                        .unique_vertices_linked_to_not_internal_nor_boundary_corner ) );
+            result.unique_vertices_linked_to_not_boundary_line_corner
+                .append_issues( std::move(
+                    chunk_result
+                        .unique_vertices_linked_to_not_boundary_line_corner ) );
+        }
+
+        void append_unique_vertices_issues(
+            SectionLinesTopologyInspectionResult& result,
+            SectionLinesTopologyInspectionResult&& chunk_result )
+        {
+            result
+                .unique_vertices_linked_to_line_with_wrong_relationship_to_surface
+                .append_issues( std::move(
+                    chunk_result
+                        .unique_vertices_linked_to_line_with_wrong_relationship_to_surface ) );
+            result.unique_vertices_linked_to_a_line_with_invalid_embeddings
+                .append_issues( std::move(
+                    chunk_result
+                        .unique_vertices_linked_to_a_line_with_invalid_embeddings ) );
+            result.unique_vertices_linked_to_a_single_and_invalid_line
+                .append_issues( std::move(
+                    chunk_result
+                        .unique_vertices_linked_to_a_single_and_invalid_line ) );
+            result
+                .unique_vertices_linked_to_several_lines_but_not_linked_to_a_corner
+                .append_issues( std::move(
+                    chunk_result
+                        .unique_vertices_linked_to_several_lines_but_not_linked_to_a_corner ) );
+        }
+
+        void append_unique_vertices_issues(
+            SectionSurfacesTopologyInspectionResult& result,
+            SectionSurfacesTopologyInspectionResult&& chunk_result )
+        {
+            result.unique_vertices_linked_to_a_surface_with_invalid_embbedings
+                .append_issues( std::move(
+                    chunk_result
+                        .unique_vertices_linked_to_a_surface_with_invalid_embbedings ) );
+            result
+                .unique_vertices_linked_to_a_line_but_is_not_on_a_surface_border
+                .append_issues( std::move(
+                    chunk_result
+                        .unique_vertices_linked_to_a_line_but_is_not_on_a_surface_border ) );
+        }
+
+        void append_unique_vertices_issues( UniqueVerticesCMVLinkIssues& result,
+            UniqueVerticesCMVLinkIssues&& chunk_result )
+        {
+            result.not_linked_to_any_component.append_issues(
+                std::move( chunk_result.not_linked_to_any_component ) );
+            result.linked_to_inexistant_cmv.append_issues(
+                std::move( chunk_result.linked_to_inexistant_cmv ) );
+            result.nonbijectively_linked_to_cmv.append_issues(
+                std::move( chunk_result.nonbijectively_linked_to_cmv ) );
+        }
+    } // namespace internal
+} // namespace geode
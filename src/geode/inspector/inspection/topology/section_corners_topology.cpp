@@ -23,7 +23,9 @@
 
 #include <optional>
 
+#include <geode/inspector/inspection/topology/internal/model_relationships.hpp>
 #include <geode/inspector/inspection/topology/internal/topology_helpers.hpp>
+#include <geode/inspector/inspection/topology/internal/unique_vertices_topology.hpp>
 #include <geode/inspector/inspection/topology/section_corners_topology.hpp>
 
 #include <geode/mesh/core/point_set.hpp>
@@ -99,15 +101,38 @@ namespace geode
     {
     }
 
+    SectionCornersTopology::~SectionCornersTopology() = default;
+
+    const internal::ModelRelationships&
+        SectionCornersTopology::relationships_snapshot() const
+    {
+        std::call_once( relationships_flag_, [this] {
+            relationships_ =
+                std::make_unique< internal::ModelRelationships >( section_ );
+        } );
+        return *relationships_;
+    }
+
     bool SectionCornersTopology::section_corner_topology_is_valid(
         index_t unique_vertex_index ) const
+    {
+        const auto& relationships = relationships_snapshot();
+        return section_corner_topology_is_valid( unique_vertex_index,
+            relationships,
+            internal::vertex_cmvs_by_component(
+                section_, relationships, unique_vertex_index ) );
+    }
+
+    bool SectionCornersTopology::section_corner_topology_is_valid(
+        index_t unique_vertex_index,
+        const internal::ModelRelationships& relationships,
+        const internal::SectionVertexCMVsByComponent& unique_vertex_cmvs )
+        const
     {
         bool corner_found{ false };
-        for( const auto& cmv :
-            section_.component_mesh_vertices( unique_vertex_index ) )
+        for( const auto corner : unique_vertex_cmvs.corners )
         {
-            if( cmv.component_id.type() != Corner2D::component_type_static()
-                || !section_.corner( cmv.component_id.id() ).is_active() )
+            if( !relationships.is_active( corner ) )
             {
                 continue;
             }
@@ -116,32 +141,28 @@ namespace geode
                 return false;
             }
             corner_found = true;
-            const auto& corner_uuid = cmv.component_id.id();
-            if( section_.nb_embeddings( corner_uuid ) > 1 )
+            const auto nb_embeddings =
+                relationships.embeddings( corner ).size();
+            const auto nb_incidences =
+                relationships.incidences( corner ).size();
+            if( nb_embeddings > 1 )
             {
                 return false;
             }
-            else if( section_.nb_embeddings( corner_uuid ) != 1 )
+            else if( nb_embeddings != 1 )
             {
-                if( section_.nb_incidences( corner_uuid ) < 1 )
+                if( nb_incidences < 1 )
                 {
                     return false;
                 }
             }
-            else if( section_.nb_incidences( corner_uuid ) > 1 )
+            else if( nb_incidences > 1 )
             {
                 return false;
             }
-            for( const auto& line :
-                section_.component_mesh_vertices( unique_vertex_index ) )
+            for( const auto line : unique_vertex_cmvs.lines )
             {
-                if( line.component_id.type()
-                    != Line2D::component_type_static() )
-                {
-                    continue;
-                }
-                if( !section_.Relationships::is_boundary(
-                        corner_uuid, line.component_id.id() ) )
+                if( !relationships.is_boundary( corner, line ) )
                 {
                     return false;
                 }
@@ -168,13 +189,25 @@ namespace geode
     std::optional< std::string >
         SectionCornersTopology::unique_vertex_has_multiple_corners(
             index_t unique_vertex_index ) const
+    {
+        const auto& relationships = relationships_snapshot();
+        return unique_vertex_has_multiple_corners( unique_vertex_index,
+            relationships,
+            internal::vertex_cmvs_by_component(
+                section_, relationships, unique_vertex_index ) );
+    }
+
+    std::optional< std::string >
+        SectionCornersTopology::unique_vertex_has_multiple_corners(
+            index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::SectionVertexCMVsByComponent& unique_vertex_cmvs )
+            const
     {
         bool corner_found{ false };
-        for( const auto& cmv :
-            section_.component_mesh_vertices( unique_vertex_index ) )
+        for( const auto corner : unique_vertex_cmvs.corners )
         {
-            if( cmv.component_id.type() != Corner2D::component_type_static()
-                || !section_.corner( cmv.component_id.id() ).is_active() )
+            if( !relationships.is_active( corner ) )
             {
                 continue;
             }
@@ -192,19 +225,33 @@ namespace geode
         SectionCornersTopology::corner_has_multiple_embeddings(
             index_t unique_vertex_index ) const
     {
-        for( const auto& cmv :
-            section_.component_mesh_vertices( unique_vertex_index ) )
+        const auto& relationships = relationships_snapshot();
+        return corner_has_multiple_embeddings( unique_vertex_index,
+            relationships,
+            internal::vertex_cmvs_by_component(
+                section_, relationships, unique_vertex_index ) );
+    }
+
+    std::optional< std::string >
+        SectionCornersTopology::corner_has_multiple_embeddings(
+            index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::SectionVertexCMVsByComponent& unique_vertex_cmvs )
+            const
+    {
+        for( const auto corner : unique_vertex_cmvs.corners )
         {
-            if( cmv.component_id.type() == Corner2D::component_type_static()
-                && section_.corner( cmv.component_id.id() ).is_active()
-                && section_.nb_embeddings( cmv.component_id.id() ) > 1 )
+            if( relationships.is_active( corner )
+                && relationships.embeddings( corner ).size() > 1 )
             {
+                const auto& corner_id =
+                    relationships.component_id( corner ).id();
                 return absl::StrCat( "unique vertex ", unique_vertex_index,
                     " is associated to Corner",
-                    section_.corner( cmv.component_id.id() )
+                    section_.corner( corner_id )
                         .name()
-                        .value_or( cmv.component_id.id().string() ),
-                    " (", cmv.component_id.id().string(),
+                        .value_or( corner_id.string() ),
+                    " (", corner_id.string(),
                     "), which has several embeddings." );
             }
         }
@@ -215,20 +262,34 @@ namespace geode
         SectionCornersTopology::corner_is_not_internal_nor_boundary(
             index_t unique_vertex_index ) const
     {
-        for( const auto& cmv :
-            section_.component_mesh_vertices( unique_vertex_index ) )
+        const auto& relationships = relationships_snapshot();
+        return corner_is_not_internal_nor_boundary( unique_vertex_index,
+            relationships,
+            internal::vertex_cmvs_by_component(
+                section_, relationships, unique_vertex_index ) );
+    }
+
+    std::optional< std::string >
+        SectionCornersTopology::corner_is_not_internal_nor_boundary(
+            index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::SectionVertexCMVsByComponent& unique_vertex_cmvs )
+            const
+    {
+        for( const auto corner : unique_vertex_cmvs.corners )
         {
-            if( cmv.component_id.type() == Corner2D::component_type_static()
-                && section_.corner( cmv.component_id.id() ).is_active()
-                && section_.nb_embeddings( cmv.component_id.id() ) < 1
-                && section_.nb_incidences( cmv.component_id.id() ) < 1 )
+            if( relationships.is_active( corner )
+                && relationships.embeddings( corner ).empty()
+                && relationships.incidences( corner ).empty() )
             {
+                const auto& corner_id =
+                    relationships.component_id( corner ).id();
                 return absl::StrCat( "unique vertex ", unique_vertex_index,
                     " is associated to Corner ",
-                    section_.corner( cmv.component_id.id() )
+                    section_.corner( corner_id )
                         .name()
-                        .value_or( cmv.component_id.id().string() ),
-                    " (", cmv.component_id.id().string(),
+                        .value_or( corner_id.string() ),
+                    " (", corner_id.string(),
                     "), which is neither internal nor boundary." );
             }
         }
@@ -239,36 +300,44 @@ namespace geode
         SectionCornersTopology::corner_is_part_of_line_but_not_boundary(
             index_t unique_vertex_index ) const
     {
-        for( const auto& cmv :
-            section_.component_mesh_vertices( unique_vertex_index ) )
+        const auto& relationships = relationships_snapshot();
+        return corner_is_part_of_line_but_not_boundary( unique_vertex_index,
+            relationships,
+            internal::vertex_cmvs_by_component(
+                section_, relationships, unique_vertex_index ) );
+    }
+
+    std::optional< std::string >
+        SectionCornersTopology::corner_is_part_of_line_but_not_boundary(
+            index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::SectionVertexCMVsByComponent& unique_vertex_cmvs )
+            const
+    {
+        for( const auto corner : unique_vertex_cmvs.corners )
         {
-            if( cmv.component_id.type() != Corner2D::component_type_static()
-                || !section_.corner( cmv.component_id.id() ).is_active() )
+            if( !relationships.is_active( corner ) )
             {
                 continue;
             }
-            const auto& corner_uuid = cmv.component_id.id();
-            for( const auto& line :
-                section_.component_mesh_vertices( unique_vertex_index ) )
+            for( const auto line : unique_vertex_cmvs.lines )
             {
-                if( line.component_id.type()
-                    != Line2D::component_type_static() )
-                {
-                    continue;
-                }
-                if( !section_.Relationships::is_boundary(
-                        corner_uuid, line.component_id.id() ) )
+                if( !relationships.is_boundary( corner, line ) )
                 {
+                    const auto& corner_uuid =
+                        relationships.component_id( corner ).id();
+                    const auto& line_uuid =
+                        relationships.component_id( line ).id();
                     return absl::StrCat( "unique vertex ", unique_vertex_index,
                         " is associated with Corner ",
                         section_.corner( corner_uuid )
                             .name()
                             .value_or( corner_uuid.string() ),
                         " (", corner_uuid.string(), "), part of Line ",
-                        section_.line( line.component_id.id() )
+                        section_.line( line_uuid )
                             .name()
-                            .value_or( line.component_id.id().string() ),
-                        " (", line.component_id.id().string(),
+                            .value_or( line_uuid.string() ),
+                        " (", line_uuid.string(),
                         "), but is not a boundary of the Line." );
                 }
             }
@@ -278,6 +347,27 @@ namespace geode
 
     SectionCornersTopologyInspectionResult
         SectionCornersTopology::inspect_corners_topology() const
+    {
+        const internal::ModelUniqueVertices unique_vertices{ section_,
+            { internal::ModelUniqueVertices::ComponentKind::corner } };
+        const internal::ModelRelationships relationships{ section_ };
+        auto result = inspect_corners_components( unique_vertices );
+        internal::for_each_unique_vertex_chunk( section_.nb_unique_vertices(),
+            result,
+            [this, &relationships]( index_t unique_vertex_id,
+                SectionCornersTopologyInspectionResult& chunk_result ) {
+                add_unique_vertex_corners_issues( unique_vertex_id,
+                    relationships,
+                    internal::vertex_cmvs_by_component(
+                        section_, relationships, unique_vertex_id ),
+                    chunk_result );
+            } );
+        return result;
+    }
+
+    SectionCornersTopologyInspectionResult
+        SectionCornersTopology::inspect_corners_components(
+            const internal::ModelUniqueVertices& unique_vertices ) const
     {
         SectionCornersTopologyInspectionResult result;
         for( const auto& corner : section_.active_corners() )
@@ -292,7 +382,7 @@ namespace geode
             }
             auto corner_result = internal::
                 model_component_vertices_not_associated_to_unique_vertices(
-                    section_, corner.component_id(), corner.mesh() );
+                    unique_vertices, corner.id() );
             if( corner_result.nb_issues() != 0 )
             {
                 corner_result.set_description( absl::StrCat( "Corner ",
@@ -302,37 +392,39 @@ namespace geode
                     corner.id(), std::move( corner_result ) );
             }
         }
-        for( const auto unique_vertex_id :
-            Range{ section_.nb_unique_vertices() } )
-        {
-            if( const auto problem_message =
-                    unique_vertex_has_multiple_corners( unique_vertex_id ) )
-            {
-                result.unique_vertices_linked_to_multiple_corners.add_issue(
-                    unique_vertex_id, problem_message.value() );
-            }
-            if( const auto problem_message =
-                    corner_has_multiple_embeddings( unique_vertex_id ) )
-            {
-                result.unique_vertices_linked_to_multiple_internals_corner
-                    .add_issue( unique_vertex_id, problem_message.value() );
-            }
-            if( const auto problem_message =
-                    corner_is_not_internal_nor_boundary( unique_vertex_id ) )
-            {
-                result
-                    .unique_vertices_linked_to_not_internal_nor_boundary_corner
-                    .add_issue( unique_vertex_id, problem_message.value() );
-            }
-            if( const auto problem_message =
-                    corner_is_part_of_line_but_not_boundary(
-                        unique_vertex_id ) )
-            {
-                result.unique_vertices_linked_to_not_boundary_line_corner
-                    .add_issue( unique_vertex_id, problem_message.value() );
-            }
-        }
         return result;
     }
 
+    void SectionCornersTopology::add_unique_vertex_corners_issues(
+        index_t unique_vertex_index,
+        const internal::ModelRelationships& relationships,
+        const internal::SectionVertexCMVsByComponent& unique_vertex_cmvs,
+        SectionCornersTopologyInspectionResult& result ) const
+    {
+        if( const auto problem_message = unique_vertex_has_multiple_corners(
+                unique_vertex_index, relationships, unique_vertex_cmvs ) )
+        {
+            result.unique_vertices_linked_to_multiple_corners.add_issue(
+                unique_vertex_index, problem_message.value() );
+        }
+        if( const auto problem_message = corner_has_multiple_embeddings(
+                unique_vertex_index, relationships, unique_vertex_cmvs ) )
+        {
+            result.unique_vertices_linked_to_multiple_internals_corner
+                .add_issue( unique_vertex_index, problem_message.value() );
+        }
+        if( const auto problem_message = corner_is_not_internal_nor_boundary(
+                unique_vertex_index, relationships, unique_vertex_cmvs ) )
+        {
+            result.unique_vertices_linked_to_not_internal_nor_boundary_corner
+                .add_issue( unique_vertex_index, problem_message.value() );
+        }
+        if( const auto problem_message =
+                corner_is_part_of_line_but_not_boundary(
+                    unique_vertex_index, relationships, unique_vertex_cmvs ) )
+        {
+            result.unique_vertices_linked_to_not_boundary_line_corner.add_issue(
+                unique_vertex_index, problem_message.value() );
+        }
+    }
 } // namespace geode
@@ -35,7 +35,9 @@
 #include <geode/model/mixin/core/surface.hpp>
 #include <geode/model/representation/core/section.hpp>
 
+#include <geode/inspector/inspection/topology/internal/model_relationships.hpp>
 #include <geode/inspector/inspection/topology/internal/topology_helpers.hpp>
+#include <geode/inspector/inspection/topology/internal/unique_vertices_topology.hpp>
 
 namespace geode
 {
@@ -109,29 +111,49 @@ namespace geode
     {
     }
 
+    SectionLinesTopology::~SectionLinesTopology() = default;
+
+    const internal::ModelRelationships&
+        SectionLinesTopology::relationships_snapshot() const
+    {
+        std::call_once( relationships_flag_, [this] {
+            relationships_ =
+                std::make_unique< internal::ModelRelationships >( section_ );
+        } );
+        return *relationships_;
+    }
+
     bool SectionLinesTopology::section_lines_topology_is_valid(
         index_t unique_vertex_index ) const
     {
-        bool is_a_line{ false };
-        for( const auto& cmv :
-            section_.component_mesh_vertices( unique_vertex_index ) )
-        {
-            if( cmv.component_id.type() == Line2D::component_type_static()
-                && section_.line( cmv.component_id.id() ).is_active() )
-            {
-                is_a_line = true;
-                break;
-            }
-        }
-        if( !is_a_line )
+        const auto& relationships = relationships_snapshot();
+        return section_lines_topology_is_valid( unique_vertex_index,
+            relationships,
+            internal::vertex_cmvs_by_component(
+                section_, relationships, unique_vertex_index ) );
+    }
+
+    bool SectionLinesTopology::section_lines_topology_is_valid(
+        index_t unique_vertex_index,
+        const internal::ModelRelationships& relationships,
+        const internal::SectionVertexCMVsByComponent& unique_vertex_cmvs )
+        const
+    {
+        if( absl::c_none_of( unique_vertex_cmvs.lines,
+                [&relationships]( index_t line ) {
+                    return relationships.is_active( line );
+                } ) )
         {
             return true;
         }
         if( vertex_is_part_of_line_with_wrong_relationships_to_surface(
-                unique_vertex_index )
-            || vertex_is_part_of_invalid_embedded_line( unique_vertex_index )
-            || vertex_is_part_of_invalid_single_line( unique_vertex_index )
-            || vertex_has_lines_but_is_not_a_corner( unique_vertex_index ) )
+                unique_vertex_index, relationships, unique_vertex_cmvs )
+            || vertex_is_part_of_invalid_embedded_line(
+                unique_vertex_index, relationships, unique_vertex_cmvs )
+            || vertex_is_part_of_invalid_single_line(
+                unique_vertex_index, relationships, unique_vertex_cmvs )
+            || vertex_has_lines_but_is_not_a_corner(
+                unique_vertex_index, relationships, unique_vertex_cmvs ) )
         {
             return false;
         }
@@ -156,23 +178,35 @@ namespace geode
         vertex_is_part_of_line_with_wrong_relationships_to_surface(
             const index_t unique_vertex_index ) const
     {
-        for( const auto& cmv :
-            section_.component_mesh_vertices( unique_vertex_index ) )
+        const auto& relationships = relationships_snapshot();
+        return vertex_is_part_of_line_with_wrong_relationships_to_surface(
+            unique_vertex_index, relationships,
+            internal::vertex_cmvs_by_component(
+                section_, relationships, unique_vertex_index ) );
+    }
+
+    std::optional< std::string > SectionLinesTopology::
+        vertex_is_part_of_line_with_wrong_relationships_to_surface(
+            const index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::SectionVertexCMVsByComponent& unique_vertex_cmvs )
+            const
+    {
+        for( const auto line : unique_vertex_cmvs.lines )
         {
-            if( cmv.component_id.type() != Line2D::component_type_static()
-                || !section_.line( cmv.component_id.id() ).is_active() )
+            if( !relationships.is_active( line ) )
             {
                 continue;
             }
-            if( section_.nb_embeddings( cmv.component_id.id() ) < 1
-                && section_.nb_incidences( cmv.component_id.id() ) < 1 )
+            if( relationships.embeddings( line ).empty()
+                && relationships.incidences( line ).empty() )
             {
+                const auto& line_id = relationships.component_id( line ).id();
                 return absl::StrCat( "unique vertex ", unique_vertex_index,
                     " is part of Line ",
-                    section_.line( cmv.component_id.id() )
-                        .name()
-                        .value_or( cmv.component_id.id().string() ),
-                    " (", cmv.component_id.id().string(),
+                    section_.line( line_id ).name().value_or(
+                        line_id.string() ),
+                    " (", line_id.string(),
                     "), which is neither embedded nor incident." );
             }
         }
@@ -183,63 +217,74 @@ namespace geode
         SectionLinesTopology::vertex_is_part_of_invalid_embedded_line(
             const index_t unique_vertex_index ) const
     {
-        for( const auto& line_cmv :
-            section_.component_mesh_vertices( unique_vertex_index ) )
+        const auto& relationships = relationships_snapshot();
+        return vertex_is_part_of_invalid_embedded_line( unique_vertex_index,
+            relationships,
+            internal::vertex_cmvs_by_component(
+                section_, relationships, unique_vertex_index ) );
+    }
+
+    std::optional< std::string >
+        SectionLinesTopology::vertex_is_part_of_invalid_embedded_line(
+            const index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::SectionVertexCMVsByComponent& unique_vertex_cmvs )
+            const
+    {
+        const auto surfaces_are_meshed = relationships.are_meshed(
+            internal::ModelRelationships::ComponentKind::surface );
+        for( const auto line : unique_vertex_cmvs.lines )
         {
-            if( line_cmv.component_id.type() != Line2D::component_type_static()
-                || !section_.line( line_cmv.component_id.id() ).is_active() )
+            if( !relationships.is_active( line ) )
             {
                 continue;
             }
-            if( section_.nb_embeddings( line_cmv.component_id.id() ) < 1 )
+            const auto embeddings = relationships.embeddings( line );
+            if( embeddings.empty() )
             {
                 return std::nullopt;
             }
-            if( section_.nb_embeddings( line_cmv.component_id.id() ) > 1 )
+            const auto& line_id = relationships.component_id( line ).id();
+            if( embeddings.size() > 1 )
             {
                 return absl::StrCat( "unique vertex ", unique_vertex_index,
                     " is part of line ",
-                    section_.line( line_cmv.component_id.id() )
-                        .name()
-                        .value_or( line_cmv.component_id.id().string() ),
-                    " (", line_cmv.component_id.id().string(),
+                    section_.line( line_id ).name().value_or(
+                        line_id.string() ),
+                    " (", line_id.string(),
                     "), which has multiple embeddings." );
             }
-            if( section_.nb_incidences( line_cmv.component_id.id() ) > 0 )
+            if( !relationships.incidences( line ).empty() )
             {
                 return absl::StrCat( "unique vertex ", unique_vertex_index,
                     " is part of Line ",
-                    section_.line( line_cmv.component_id.id() )
-                        .name()
-                        .value_or( line_cmv.component_id.id().string() ),
-                    " (", line_cmv.component_id.id().string(),
+                    section_.line( line_id ).name().value_or(
+                        line_id.string() ),
+                    " (", line_id.string(),
                     "), which has both an embedding and incidence(s)." );
             }
-            for( const auto& embedding :
-                section_.embeddings( line_cmv.component_id.id() ) )
+            for( const auto embedding : embeddings )
             {
-                if( !section_.surface( embedding.id() ).is_active() )
+                if( !relationships.is_active( embedding ) )
                 {
                     continue;
                 }
-                if( internal::section_surfaces_are_meshed( section_ )
-                    && !absl::c_any_of(
-                        section_.component_mesh_vertices( unique_vertex_index ),
-                        [&embedding]( const ComponentMeshVertex& cmv ) {
-                            return cmv.component_id.id() == embedding.id();
-                        } ) )
+                if( surfaces_are_meshed
+                    && !internal::vertex_is_linked_to_component(
+                        unique_vertex_cmvs, embedding ) )
                 {
+                    const auto& embedding_id =
+                        relationships.component_id( embedding ).id();
                     return absl::StrCat( "unique vertex ", unique_vertex_index,
                         " is part of Line ",
-                        section_.line( line_cmv.component_id.id() )
-                            .name()
-                            .value_or( line_cmv.component_id.id().string() ),
-                        " (", line_cmv.component_id.string(),
+                        section_.line( line_id ).name().value_or(
+                            line_id.string() ),
+                        " (", line_id.string(),
                         "), which is embedded in surface ",
-                        section_.surface( embedding.id() )
+                        section_.surface( embedding_id )
                             .name()
-                            .value_or( embedding.id().string() ),
-                        " (", embedding.id().string(),
+                            .value_or( embedding_id.string() ),
+                        " (", embedding_id.string(),
                         "), but the unique vertex is not linked to the "
                         "Surface mesh vertices." );
                 }
@@ -252,17 +297,31 @@ namespace geode
         SectionLinesTopology::vertex_is_part_of_invalid_single_line(
             index_t unique_vertex_index ) const
     {
-        const auto line_uuids = internal::components_uuids(
-            section_, unique_vertex_index, Line2D::component_type_static() );
-        if( line_uuids.size() != 1
-            || !section_.line( line_uuids[0] ).is_active() )
+        const auto& relationships = relationships_snapshot();
+        return vertex_is_part_of_invalid_single_line( unique_vertex_index,
+            relationships,
+            internal::vertex_cmvs_by_component(
+                section_, relationships, unique_vertex_index ) );
+    }
+
+    std::optional< std::string >
+        SectionLinesTopology::vertex_is_part_of_invalid_single_line(
+            index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::SectionVertexCMVsByComponent& unique_vertex_cmvs )
+            const
+    {
+        const auto lines =
+            internal::unique_components( unique_vertex_cmvs.lines );
+        if( lines.size() != 1 || !relationships.is_active( lines[0] ) )
         {
             return std::nullopt;
         }
-        const auto& line_id = line_uuids[0];
-        const auto surface_uuids = internal::components_uuids(
-            section_, unique_vertex_index, Surface2D::component_type_static() );
-        if( surface_uuids.size() > 2 )
+        const auto line = lines[0];
+        const auto& line_id = relationships.component_id( line ).id();
+        const auto surfaces =
+            internal::unique_components( unique_vertex_cmvs.surfaces );
+        if( surfaces.size() > 2 )
         {
             return absl::StrCat( "unique vertex ", unique_vertex_index,
                 " is part of only one Line ",
@@ -270,12 +329,12 @@ namespace geode
                 " (", line_id.string(),
                 "), but part of more than two Surfaces" );
         }
-        if( section_.nb_embeddings( line_id ) > 0 )
+        if( !relationships.embeddings( line ).empty() )
         {
-            if( internal::section_surfaces_are_meshed( section_ )
-                && ( surface_uuids.size() != 1
-                     || !section_.Relationships::is_internal(
-                         line_id, surface_uuids[0] ) ) )
+            if( relationships.are_meshed(
+                    internal::ModelRelationships::ComponentKind::surface )
+                && ( surfaces.size() != 1
+                     || !relationships.is_internal( line, surfaces[0] ) ) )
             {
                 return absl::StrCat( "unique vertex ", unique_vertex_index,
                     " is part of only one Line ",
@@ -290,11 +349,12 @@ namespace geode
         }
         else
         {
-            for( const auto& surface_id : surface_uuids )
+            for( const auto surface : surfaces )
             {
-                if( !section_.Relationships::is_boundary(
-                        line_id, surface_id ) )
+                if( !relationships.is_boundary( line, surface ) )
                 {
+                    const auto& surface_id =
+                        relationships.component_id( surface ).id();
                     return absl::StrCat( "unique vertex ", unique_vertex_index,
                         " is part of only one Line ",
                         section_.line( line_id ).name().value_or(
@@ -316,23 +376,25 @@ namespace geode
         SectionLinesTopology::vertex_has_lines_but_is_not_a_corner(
             index_t unique_vertex_index ) const
     {
-        bool corner_found{ false };
-        index_t nb_cmv_lines{ 0 };
-        for( const auto& cmv :
-            section_.component_mesh_vertices( unique_vertex_index ) )
-        {
-            if( cmv.component_id.type() == Line2D::component_type_static()
-                && section_.line( cmv.component_id.id() ).is_active() )
-            {
-                nb_cmv_lines += 1;
-            }
-            else if( cmv.component_id.type()
-                     == Corner2D::component_type_static() )
-            {
-                corner_found = true;
-            }
-        }
-        if( nb_cmv_lines > 1 && !corner_found )
+        const auto& relationships = relationships_snapshot();
+        return vertex_has_lines_but_is_not_a_corner( unique_vertex_index,
+            relationships,
+            internal::vertex_cmvs_by_component(
+                section_, relationships, unique_vertex_index ) );
+    }
+
+    std::optional< std::string >
+        SectionLinesTopology::vertex_has_lines_but_is_not_a_corner(
+            index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::SectionVertexCMVsByComponent& unique_vertex_cmvs )
+            const
+    {
+        const auto nb_cmv_lines = absl::c_count_if( unique_vertex_cmvs.lines,
+            [&relationships]( index_t line ) {
+                return relationships.is_active( line );
+            } );
+        if( nb_cmv_lines > 1 && unique_vertex_cmvs.corner_cmvs.empty() )
         {
             return absl::StrCat( "unique vertex ", unique_vertex_index,
                 " is part of multiple Lines but is not a Corner." );
@@ -342,6 +404,27 @@ namespace geode
 
     SectionLinesTopologyInspectionResult
         SectionLinesTopology::inspect_lines_topology() const
+    {
+        const internal::ModelUniqueVertices unique_vertices{ section_,
+            { internal::ModelUniqueVertices::ComponentKind::line } };
+        const internal::ModelRelationships relationships{ section_ };
+        auto result = inspect_lines_components( unique_vertices );
+        internal::for_each_unique_vertex_chunk( section_.nb_unique_vertices(),
+            result,
+            [this, &relationships]( index_t unique_vertex_id,
+                SectionLinesTopologyInspectionResult& chunk_result ) {
+                add_unique_vertex_lines_issues( unique_vertex_id,
+                    relationships,
+                    internal::vertex_cmvs_by_component(
+                        section_, relationships, unique_vertex_id ),
+                    chunk_result );
+            } );
+        return result;
+    }
+
+    SectionLinesTopologyInspectionResult
+        SectionLinesTopology::inspect_lines_components(
+            const internal::ModelUniqueVertices& unique_vertices ) const
     {
         SectionLinesTopologyInspectionResult result;
         for( const auto& line : section_.active_lines() )
@@ -355,7 +438,7 @@ namespace geode
             }
             auto line_result = internal::
                 model_component_vertices_not_associated_to_unique_vertices(
-                    section_, line.component_id(), line.mesh() );
+                    unique_vertices, line.id() );
             if( line_result.nb_issues() != 0 )
             {
                 line_result.set_description( absl::StrCat( "Line ",
@@ -365,42 +448,47 @@ namespace geode
                     line.id(), std::move( line_result ) );
             }
         }
-        for( const auto unique_vertex_id :
-            Range{ section_.nb_unique_vertices() } )
-        {
-            if( const auto boundary_nor_internal_line =
-                    vertex_is_part_of_line_with_wrong_relationships_to_surface(
-                        unique_vertex_id ) )
-            {
-                result
-                    .unique_vertices_linked_to_line_with_wrong_relationship_to_surface
-                    .add_issue(
-                        unique_vertex_id, boundary_nor_internal_line.value() );
-            }
-            if( const auto invalid_internal_topology =
-                    vertex_is_part_of_invalid_embedded_line(
-                        unique_vertex_id ) )
-            {
-                result.unique_vertices_linked_to_a_line_with_invalid_embeddings
-                    .add_issue(
-                        unique_vertex_id, invalid_internal_topology.value() );
-            }
-            if( const auto invalid_unique_line =
-                    vertex_is_part_of_invalid_single_line( unique_vertex_id ) )
-            {
-                result.unique_vertices_linked_to_a_single_and_invalid_line
-                    .add_issue( unique_vertex_id, invalid_unique_line.value() );
-            }
-            if( const auto lines_but_is_not_corner =
-                    vertex_has_lines_but_is_not_a_corner( unique_vertex_id ) )
-            {
-                result
-                    .unique_vertices_linked_to_several_lines_but_not_linked_to_a_corner
-                    .add_issue(
-                        unique_vertex_id, lines_but_is_not_corner.value() );
-            }
-        }
         return result;
     }
 
+    void SectionLinesTopology::add_unique_vertex_lines_issues(
+        index_t unique_vertex_index,
+        const internal::ModelRelationships& relationships,
+        const internal::SectionVertexCMVsByComponent& unique_vertex_cmvs,
+        SectionLinesTopologyInspectionResult& result ) const
+    {
+        if( const auto boundary_nor_internal_line =
+                vertex_is_part_of_line_with_wrong_relationships_to_surface(
+                    unique_vertex_index, relationships, unique_vertex_cmvs ) )
+        {
+            result
+                .unique_vertices_linked_to_line_with_wrong_relationship_to_surface
+                .add_issue(
+                    unique_vertex_index, boundary_nor_internal_line.value() );
+        }
+        if( const auto invalid_internal_topology =
+                vertex_is_part_of_invalid_embedded_line(
+                    unique_vertex_index, relationships, unique_vertex_cmvs ) )
+        {
+            result.unique_vertices_linked_to_a_line_with_invalid_embeddings
+                .add_issue(
+                    unique_vertex_index, invalid_internal_topology.value() );
+        }
+        if( const auto invalid_unique_line =
+                vertex_is_part_of_invalid_single_line(
+                    unique_vertex_index, relationships, unique_vertex_cmvs ) )
+        {
+            result.unique_vertices_linked_to_a_single_and_invalid_line
+                .add_issue( unique_vertex_index, invalid_unique_line.value() );
+        }
+        if( const auto lines_but_is_not_corner =
+                vertex_has_lines_but_is_not_a_corner(
+                    unique_vertex_index, relationships, unique_vertex_cmvs ) )
+        {
+            result
+                .unique_vertices_linked_to_several_lines_but_not_linked_to_a_corner
+                .add_issue(
+                    unique_vertex_index, lines_but_is_not_corner.value() );
+        }
+    }
 } // namespace geode
@@ -27,6 +27,7 @@
 
 #include <geode/basic/algorithm.hpp>
 #include <geode/basic/logger.hpp>
+#include <geode/basic/range.hpp>
 
 #include <geode/mesh/core/surface_mesh.hpp>
 
@@ -35,7 +36,9 @@
 #include <geode/model/mixin/core/surface.hpp>
 #include <geode/model/representation/core/section.hpp>
 
+#include <geode/inspector/inspection/topology/internal/model_relationships.hpp>
 #include <geode/inspector/inspection/topology/internal/topology_helpers.hpp>
+#include <geode/inspector/inspection/topology/internal/unique_vertices_topology.hpp>
 
 namespace geode
 {
@@ -94,21 +97,44 @@ namespace geode
     {
     }
 
+    SectionSurfacesTopology::~SectionSurfacesTopology() = default;
+
+    const internal::ModelRelationships&
+        SectionSurfacesTopology::relationships_snapshot() const
+    {
+        std::call_once( relationships_flag_, [this] {
+            relationships_ =
+                std::make_unique< internal::ModelRelationships >( section_ );
+        } );
+        return *relationships_;
+    }
+
     bool SectionSurfacesTopology::section_vertex_surfaces_topology_is_valid(
         index_t unique_vertex_index ) const
     {
-        for( const auto& cmv :
-            section_.component_mesh_vertices( unique_vertex_index ) )
+        const auto& relationships = relationships_snapshot();
+        return section_vertex_surfaces_topology_is_valid( unique_vertex_index,
+            relationships,
+            internal::vertex_cmvs_by_component(
+                section_, relationships, unique_vertex_index ) );
+    }
+
+    bool SectionSurfacesTopology::section_vertex_surfaces_topology_is_valid(
+        index_t unique_vertex_index,
+        const internal::ModelRelationships& relationships,
+        const internal::SectionVertexCMVsByComponent& unique_vertex_cmvs )
+        const
+    {
+        for( const auto surface : unique_vertex_cmvs.surfaces )
         {
-            if( cmv.component_id.type() != Surface2D::component_type_static()
-                || !section_.surface( cmv.component_id.id() ).is_active() )
+            if( !relationships.is_active( surface ) )
             {
                 continue;
             }
             if( vertex_is_part_of_invalid_embedded_surface(
-                    unique_vertex_index )
+                    unique_vertex_index, relationships, unique_vertex_cmvs )
                 || vertex_is_part_of_line_and_not_on_surface_border(
-                    unique_vertex_index ) )
+                    unique_vertex_index, relationships, unique_vertex_cmvs ) )
             {
                 return false;
             }
@@ -137,22 +163,28 @@ namespace geode
         SectionSurfacesTopology::vertex_is_part_of_invalid_embedded_surface(
             index_t unique_vertex_index ) const
     {
-        const auto surface_uuids = internal::components_uuids(
-            section_, unique_vertex_index, Surface2D::component_type_static() );
-        if( surface_uuids.size() == 2 )
+        const auto& relationships = relationships_snapshot();
+        return vertex_is_part_of_invalid_embedded_surface( unique_vertex_index,
+            relationships,
+            internal::vertex_cmvs_by_component(
+                section_, relationships, unique_vertex_index ) );
+    }
+
+    std::optional< std::string >
+        SectionSurfacesTopology::vertex_is_part_of_invalid_embedded_surface(
+            index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::SectionVertexCMVsByComponent& unique_vertex_cmvs )
+            const
+    {
+        const auto surfaces =
+            internal::unique_components( unique_vertex_cmvs.surfaces );
+        if( surfaces.size() == 2 )
         {
-            for( const auto& line_cmv :
-                section_.component_mesh_vertices( unique_vertex_index ) )
+            for( const auto line : unique_vertex_cmvs.lines )
             {
-                if( line_cmv.component_id.type()
-                    != Line2D::component_type_static() )
-                {
-                    continue;
-                }
-                if( section_.Relationships::is_boundary(
-                        line_cmv.component_id.id(), surface_uuids[0] )
-                    && section_.Relationships::is_boundary(
-                        line_cmv.component_id.id(), surface_uuids[1] ) )
+                if( relationships.is_boundary( line, surfaces[0] )
+                    && relationships.is_boundary( line, surfaces[1] ) )
                 {
                     return std::nullopt;
                 }
@@ -169,38 +201,49 @@ namespace geode
         vertex_is_part_of_line_and_not_on_surface_border(
             index_t unique_vertex_index ) const
     {
-        if( !internal::section_surfaces_are_meshed( section_ ) )
+        const auto& relationships = relationships_snapshot();
+        return vertex_is_part_of_line_and_not_on_surface_border(
+            unique_vertex_index, relationships,
+            internal::vertex_cmvs_by_component(
+                section_, relationships, unique_vertex_index ) );
+    }
+
+    std::optional< std::string > SectionSurfacesTopology::
+        vertex_is_part_of_line_and_not_on_surface_border(
+            index_t unique_vertex_index,
+            const internal::ModelRelationships& relationships,
+            const internal::SectionVertexCMVsByComponent& unique_vertex_cmvs )
+            const
+    {
+        if( !relationships.are_meshed(
+                internal::ModelRelationships::ComponentKind::surface ) )
         {
             return std::nullopt;
         }
-        for( const auto& line_cmv :
-            section_.component_mesh_vertices( unique_vertex_index ) )
+        for( const auto line : unique_vertex_cmvs.lines )
         {
-            if( line_cmv.component_id.type() != Line2D::component_type_static()
-                || !section_.line( line_cmv.component_id.id() ).is_active() )
+            if( !relationships.is_active( line ) )
             {
                 continue;
             }
-            for( const auto& surface_cmv :
-                section_.component_mesh_vertices( unique_vertex_index ) )
+            for( const auto s : Indices{ unique_vertex_cmvs.surfaces } )
             {
-                if( surface_cmv.component_id.type()
-                        != Surface2D::component_type_static()
-                    || !section_.surface( surface_cmv.component_id.id() )
-                        .is_active() )
+                if( !relationships.is_active( unique_vertex_cmvs.surfaces[s] ) )
                 {
                     continue;
                 }
-                if( !section_.surface( surface_cmv.component_id.id() )
+                const auto& surface_cmv = unique_vertex_cmvs.surface_cmvs[s];
+                const auto& surface_id = surface_cmv.component_id.id();
+                if( !section_.surface( surface_id )
                         .mesh()
                         .is_vertex_on_border( surface_cmv.vertex ) )
                 {
                     return absl::StrCat( "Unique vertex ", unique_vertex_index,
                         " is part of a Line and of Surface ",
-                        section_.surface( surface_cmv.component_id.id() )
+                        section_.surface( surface_id )
                             .name()
-                            .value_or( surface_cmv.component_id.id().string() ),
-                        " (", surface_cmv.component_id.id().string(),
+                            .value_or( surface_id.string() ),
+                        " (", surface_id.string(),
                         ") but the associated vertex in the Surface "
                         "mesh is not on the mesh border." );
                 }
@@ -211,6 +254,27 @@ namespace geode
 
     SectionSurfacesTopologyInspectionResult
         SectionSurfacesTopology::inspect_surfaces() const
+    {
+        const internal::ModelUniqueVertices unique_vertices{ section_,
+            { internal::ModelUniqueVertices::ComponentKind::surface } };
+        const internal::ModelRelationships relationships{ section_ };
+        auto result = inspect_surfaces_components( unique_vertices );
+        internal::for_each_unique_vertex_chunk( section_.nb_unique_vertices(),
+            result,
+            [this, &relationships]( index_t unique_vertex_id,
+                SectionSurfacesTopologyInspectionResult& chunk_result ) {
+                add_unique_vertex_surfaces_issues( unique_vertex_id,
+                    relationships,
+                    internal::vertex_cmvs_by_component(
+                        section_, relationships, unique_vertex_id ),
+                    chunk_result );
+            } );
+        return result;
+    }
+
+    SectionSurfacesTopologyInspectionResult
+        SectionSurfacesTopology::inspect_surfaces_components(
+            const internal::ModelUniqueVertices& unique_vertices ) const
     {
         SectionSurfacesTopologyInspectionResult result;
         for( const auto& surface : section_.active_surfaces() )
@@ -225,7 +289,7 @@ namespace geode
 
             auto surface_result = internal::
                 model_component_vertices_not_associated_to_unique_vertices(
-                    section_, surface.component_id(), surface.mesh() );
+                    unique_vertices, surface.id() );
             if( surface_result.nb_issues() != 0 )
             {
                 surface_result.set_description( absl::StrCat( "Surface ",
@@ -235,29 +299,31 @@ namespace geode
                     surface.id(), std::move( surface_result ) );
             }
         }
-        for( const auto unique_vertex_id :
-            Range{ section_.nb_unique_vertices() } )
-        {
-            if( const auto invalid_internal_topology =
-                    vertex_is_part_of_invalid_embedded_surface(
-                        unique_vertex_id ) )
-            {
-                result
-                    .unique_vertices_linked_to_a_surface_with_invalid_embbedings
-                    .add_issue(
-                        unique_vertex_id, invalid_internal_topology.value() );
-            }
-            if( const auto line_and_not_on_surface_border =
-                    vertex_is_part_of_line_and_not_on_surface_border(
-                        unique_vertex_id ) )
-            {
-                result
-                    .unique_vertices_linked_to_a_line_but_is_not_on_a_surface_border
-                    .add_issue( unique_vertex_id,
-                        line_and_not_on_surface_border.value() );
-            }
-        }
         return result;
     }
 
+    void SectionSurfacesTopology::add_unique_vertex_surfaces_issues(
+        index_t unique_vertex_index,
+        const internal::ModelRelationships& relationships,
+        const internal::SectionVertexCMVsByComponent& unique_vertex_cmvs,
+        SectionSurfacesTopologyInspectionResult& result ) const
+    {
+        if( const auto invalid_internal_topology =
+                vertex_is_part_of_invalid_embedded_surface(
+                    unique_vertex_index, relationships, unique_vertex_cmvs ) )
+        {
+            result.unique_vertices_linked_to_a_surface_with_invalid_embbedings
+                .add_issue(
+                    unique_vertex_index, invalid_internal_topology.value() );
+        }
+        if( const auto line_and_not_on_surface_border =
+                vertex_is_part_of_line_and_not_on_surface_border(
+                    unique_vertex_index, relationships, unique_vertex_cmvs ) )
+        {
+            result
+                .unique_vertices_linked_to_a_line_but_is_not_on_a_surface_border
+                .add_issue( unique_vertex_index,
+                    line_and_not_on_surface_border.value() );
+        }
+    }
 } // namespace geode
@@ -37,6 +37,10 @@
 #include <geode/model/mixin/core/surface.hpp>
 #include <geode/model/representation/core/section.hpp>
 
+#include <geode/inspector/inspection/criterion/internal/model_unique_vertices.hpp>
+#include <geode/inspector/inspection/topology/internal/model_relationships.hpp>
+#include <geode/inspector/inspection/topology/internal/unique_vertices_topology.hpp>
+
 namespace geode
 {
     index_t SectionTopologyInspectionResult::nb_issues() const
@@ -95,45 +99,59 @@ namespace geode
         }
 
         void add_unique_vertices_with_wrong_cmv_link(
+            const internal::ModelUniqueVertices& unique_vertices,
             SectionTopologyInspectionResult& section_issues ) const
         {
-            auto& not_linked_result =
-                section_issues.unique_vertices_not_linked_to_any_component;
-            auto& linked_to_inexistant_result =
-                section_issues.unique_vertices_linked_to_inexistant_cmv;
-            auto& linked_to_nonbijective_result =
-                section_issues.unique_vertices_nonbijectively_linked_to_cmv;
-            for( const auto uv_id : Range{ section_.nb_unique_vertices() } )
-            {
-                const auto& unique_vertex_cmvs =
-                    section_.component_mesh_vertices( uv_id );
-                if( unique_vertex_cmvs.empty() )
-                {
-                    not_linked_result.add_issue(
-                        uv_id, absl::StrCat( "unique vertex ", uv_id,
-                                   " is not linked to any mesh vertex." ) );
-                    continue;
-                }
-                for( const auto& cmv : unique_vertex_cmvs )
-                {
-                    if( !cmv_exists_in_section( cmv ) )
+            internal::UniqueVerticesCMVLinkIssues link_issues;
+            internal::for_each_unique_vertex_chunk(
+                section_.nb_unique_vertices(), link_issues,
+                [this, &unique_vertices]( index_t uv_id,
+                    internal::UniqueVerticesCMVLinkIssues& chunk_issues ) {
+                    const auto& unique_vertex_cmvs =
+                        section_.component_mesh_vertices( uv_id );
+                    if( unique_vertex_cmvs.empty() )
                     {
-                        linked_to_inexistant_result.add_issue(
+                        chunk_issues.not_linked_to_any_component.add_issue(
                             uv_id, absl::StrCat( "unique vertex ", uv_id,
-                                       " is linked to inexistant mesh vertex [",
-                                       cmv.string(), "]." ) );
-                        continue;
+                                       " is not linked to any mesh vertex." ) );
+                        return;
                     }
-                    if( section_.component( cmv.component_id.id() ).is_active()
-                        && section_.unique_vertex( cmv ) != uv_id )
+                    for( const auto& cmv : unique_vertex_cmvs )
                     {
-                        linked_to_nonbijective_result.add_issue(
-                            uv_id, absl::StrCat( "unique vertex ", uv_id,
-                                       " is linked to inexistant mesh vertex [",
-                                       cmv.string(), "]." ) );
+                        const auto component = unique_vertices.component_index(
+                            cmv.component_id.id() );
+                        if( !internal::component_mesh_vertex_exists(
+                                unique_vertices, component, cmv ) )
+                        {
+                            chunk_issues.linked_to_inexistant_cmv.add_issue(
+                                uv_id,
+                                absl::StrCat( "unique vertex ", uv_id,
+                                    " is linked to inexistant mesh vertex [",
+                                    cmv.string(), "]." ) );
+                            continue;
+                        }
+                        if( unique_vertices.is_active( component )
+                            && unique_vertices.unique_vertex(
+                                   component, cmv.vertex )
+                                   != uv_id )
+                        {
+                            chunk_issues.nonbijectively_linked_to_cmv.add_issue(
+                                uv_id,
+                                absl::StrCat( "unique vertex ", uv_id,
+                                    " is linked to inexistant mesh vertex [",
+                                    cmv.string(), "]." ) );
+                        }
                     }
-                }
-            }
+                } );
+            section_issues.unique_vertices_not_linked_to_any_component
+                .append_issues( std::move(
+                    link_issues.not_linked_to_any_component ) );
+            section_issues.unique_vertices_linked_to_inexistant_cmv
+                .append_issues( std::move(
+                    link_issues.linked_to_inexistant_cmv ) );
+            section_issues.unique_vertices_nonbijectively_linked_to_cmv
+                .append_issues( std::move(
+                    link_issues.nonbijectively_linked_to_cmv ) );
         }
 
         bool section_topology_is_valid(
@@ -152,16 +170,23 @@ namespace geode
             {
                 return false;
             }
+            const internal::ModelRelationships relationships{ section_ };
             for( const auto unique_vertex_id :
                 Range{ section_.nb_unique_vertices() } )
             {
+                const auto unique_vertex_cmvs =
+                    internal::vertex_cmvs_by_component(
+                        section_, relationships, unique_vertex_id );
                 if( !section_topology_inspector
-                        .section_corner_topology_is_valid( unique_vertex_id )
+                        .section_corner_topology_is_valid( unique_vertex_id,
+                            relationships, unique_vertex_cmvs )
                     || !section_topology_inspector
-                        .section_lines_topology_is_valid( unique_vertex_id )
+                        .section_lines_topology_is_valid( unique_vertex_id,
+                            relationships, unique_vertex_cmvs )
                     || !section_topology_inspector
                         .section_vertex_surfaces_topology_is_valid(
-                            unique_vertex_id ) )
+                            unique_vertex_id, relationships,
+                            unique_vertex_cmvs ) )
                 {
                     return false;
                 }
@@ -171,32 +196,87 @@ namespace geode
 
         SectionTopologyInspectionResult inspect_section_topology(
             const SectionTopologyInspector& section_topology_inspector ) const
+        {
+            return inspect_section_topology( section_topology_inspector,
+                internal::ModelUniqueVertices{ section_ } );
+        }
+
+        SectionTopologyInspectionResult inspect_section_topology(
+            const SectionTopologyInspector& section_topology_inspector,
+            const internal::ModelUniqueVertices& unique_vertices ) const
         {
             SectionTopologyInspectionResult result;
             try
             {
                 async::parallel_invoke(
-                    [&result, &section_topology_inspector] {
-                        result.corners = section_topology_inspector
-                                             .inspect_corners_topology();
+                    [&result, &section_topology_inspector, &unique_vertices] {
+                        result.corners =
+                            section_topology_inspector
+                                .inspect_corners_components( unique_vertices );
                     },
-                    [&result, &section_topology_inspector] {
+                    [&result, &section_topology_inspector, &unique_vertices] {
                         result.lines =
-                            section_topology_inspector.inspect_lines_topology();
+                            section_topology_inspector.inspect_lines_components(
+                                unique_vertices );
                     },
-                    [&result, &section_topology_inspector] {
+                    [&result, &section_topology_inspector, &unique_vertices] {
                         result.surfaces =
-                            section_topology_inspector.inspect_surfaces();
+                            section_topology_inspector
+                                .inspect_surfaces_components( unique_vertices );
                     } );
+                add_unique_vertices_topology_issues( section_topology_inspector,
+                    internal::ModelRelationships{ section_ }, result );
             }
             catch( OpenGeodeException& )
             {
             }
-            add_unique_vertices_with_wrong_cmv_link( result );
+            add_unique_vertices_with_wrong_cmv_link( unique_vertices, result );
             return result;
         }
 
     private:
+        /*!
+         * Single pass over the unique vertices: the component mesh vertices
+         * of each unique vertex are sorted by type once, then given to the
+         * Corners, Lines and Surfaces checks.
+         */
+        void add_unique_vertices_topology_issues(
+            const SectionTopologyInspector& section_topology_inspector,
+            const internal::ModelRelationships& relationships,
+            SectionTopologyInspectionResult& result ) const
+        {
+            internal::for_each_unique_vertex_chunk(
+                section_.nb_unique_vertices(), result,
+                [this, &section_topology_inspector, &relationships](
+                    index_t unique_vertex_id,
+                    SectionTopologyInspectionResult& chunk_result ) {
+                    const auto unique_vertex_cmvs =
+                        internal::vertex_cmvs_by_component(
+                            section_, relationships, unique_vertex_id );
+                    section_topology_inspector.add_unique_vertex_corners_issues(
+                        unique_vertex_id, relationships, unique_vertex_cmvs,
+                        chunk_result.corners );
+                    section_topology_inspector.add_unique_vertex_lines_issues(
+                        unique_vertex_id, relationships, unique_vertex_cmvs,
+                        chunk_result.lines );
+                    section_topology_inspector
+                        .add_unique_vertex_surfaces_issues( unique_vertex_id,
+                            relationships, unique_vertex_cmvs,
+                            chunk_result.surfaces );
+                },
+                []( SectionTopologyInspectionResult& merged_result,
+                    SectionTopologyInspectionResult&& chunk_result ) {
+                    internal::append_unique_vertices_issues(
+                        merged_result.corners,
+                        std::move( chunk_result.corners ) );
+                    internal::append_unique_vertices_issues(
+                        merged_result.lines, std::move( chunk_result.lines ) );
+                    internal::append_unique_vertices_issues(
+                        merged_result.surfaces,
+                        std::move( chunk_result.surfaces ) );
+                } );
+        }
+
         bool cmv_exists_in_section( const ComponentMeshVertex& cmv ) const
         {
             if( cmv.component_id.type() == Corner2D::component_type_static() )
@@ -300,4 +380,11 @@ namespace geode
     {
         return impl_->inspect_section_topology( *this );
     }
+
+    SectionTopologyInspectionResult
+        SectionTopologyInspector::inspect_section_topology(
+            const internal::ModelUniqueVertices& unique_vertices ) const
+    {
+        return impl_->inspect_section_topology( *this, unique_vertices );
+    }
 } // namespace geode
@@ -21,15 +21,26 @@
  *
  */
 
+#include <array>
+
 #include <geode/tests_config.hpp>
 
 #include <geode/basic/assert.hpp>
 #include <geode/basic/logger.hpp>
 
+#include <geode/geometry/point.hpp>
+
+#include <geode/mesh/builder/edged_curve_builder.hpp>
+#include <geode/mesh/builder/surface_mesh_builder.hpp>
+#include <geode/mesh/core/surface_mesh.hpp>
+
+#include <geode/model/representation/builder/brep_builder.hpp>
 #include <geode/model/representation/core/brep.hpp>
 #include <geode/model/representation/io/brep_input.hpp>
 
 #include <geode/inspector/inspection/brep_inspector.hpp>
+#include <geode/inspector/inspection/criterion/intersections/model_intersections.hpp>
+#include <geode/inspector/inspection/criterion/intersections/model_lines_intersections.hpp>
 
 geode::index_t corners_topological_validity(
     const geode::BRepCornersTopologyInspectionResult& result, bool string )
@@ -230,6 +241,25 @@ geode::index_t meshes_intersections_validity(
     return nb_issues;
 }
 
+geode::index_t lines_intersections_validity(
+    const std::optional< geode::ElementsIntersectionsInspectionResult >&
+        result,
+    bool string )
+{
+    if( !result )
+    {
+        return 0;
+    }
+    const auto nb_issues = result->elements_intersections.nb_issues();
+    geode::Logger::info(
+        "BRep lines intersections check: ", nb_issues, " issues." );
+    if( string )
+    {
+        geode::Logger::info( absl::StrCat( result->string(), "\n" ) );
+    }
+    return nb_issues;
+}
+
 geode::index_t meshes_manifolds_validity(
     const geode::BRepMeshesManifoldInspectionResult& result, bool string )
 {
@@ -304,6 +334,8 @@ geode::index_t launch_component_meshes_validity_checks(
         meshes_degenerations_validity( result.meshes_degenerations, string );
     nb_issues +=
         meshes_intersections_validity( result.meshes_intersections, string );
+    nb_issues +=
+        lines_intersections_validity( result.lines_intersections, string );
     nb_issues +=
         meshes_manifolds_validity( result.meshes_non_manifolds, string );
     nb_issues +=
@@ -445,6 +477,132 @@ void check_segmented_cube()
         launch_component_meshes_validity_checks( result.meshes, false );
 }
 
+geode::uuid add_triangle_surface( geode::BRepBuilder& builder,
+    const std::array< geode::Point3D, 3 >& points )
+{
+    const auto surface_id = builder.add_surface();
+    auto mesh_builder = builder.surface_mesh_builder( surface_id );
+    for( const auto& point : points )
+    {
+        mesh_builder->create_point( point );
+    }
+    mesh_builder->create_polygon( { 0, 1, 2 } );
+    return surface_id;
+}
+
+void check_surfaces_near_misses()
+{
+    geode::BRep model_brep;
+    geode::BRepBuilder builder{ model_brep };
+    const auto horizon_id = add_triangle_surface( builder,
+        { geode::Point3D{ { 0, 0, 0 } }, geode::Point3D{ { 10, 0, 0 } },
+            geode::Point3D{ { 0, 10, 0 } } } );
+    const auto close_fault_id = add_triangle_surface( builder,
+        { geode::Point3D{ { 1, 1, 0.05 } }, geode::Point3D{ { 2, 1, 0.05 } },
+            geode::Point3D{ { 1, 1, 1 } } } );
+    add_triangle_surface( builder,
+        { geode::Point3D{ { 5, 1, 0.5 } }, geode::Point3D{ { 6, 1, 0.5 } },
+            geode::Point3D{ { 5, 1, 1.5 } } } );
+    add_triangle_surface( builder,
+        { geode::Point3D{ { 1, 4, -1 } }, geode::Point3D{ { 2, 4, -1 } },
+            geode::Point3D{ { 1, 4, 1 } } } );
+    const geode::BRepMeshesIntersections intersections{ model_brep };
+    const auto result = intersections.inspect_surfaces_near_misses( 0.1 );
+    geode::OpenGeodeInspectorInspectionException::test(
+        result.elements_intersections.nb_issues() == 1, "Near misses: ",
+        result.elements_intersections.nb_issues(),
+        " pairs of polygons detected instead of 1 (the Surface stopping 0.05 "
+        "short of the horizon, neither the one 0.5 above it nor the one "
+        "crossing it)." );
+    const auto& near_miss = result.elements_intersections.issues()[0];
+    const std::array< geode::uuid, 2 > near_miss_surfaces{
+        near_miss.first.component_id.id(), near_miss.second.component_id.id()
+    };
+    geode::OpenGeodeInspectorInspectionException::test(
+        absl::c_linear_search( near_miss_surfaces, horizon_id )
+            && absl::c_linear_search( near_miss_surfaces, close_fault_id ),
+        "Near misses: the detected pair should be the horizon and the "
+        "Surface stopping short of it." );
+}
+
+geode::uuid add_segment_line( geode::BRepBuilder& builder,
+    const geode::Point3D& point0,
+    const geode::Point3D& point1 )
+{
+    const auto line_id = builder.add_line();
+    auto mesh_builder = builder.line_mesh_builder( line_id );
+    mesh_builder->create_point( point0 );
+    mesh_builder->create_point( point1 );
+    mesh_builder->create_edge( 0, 1 );
+    return line_id;
+}
+
+bool is_edges_pair(
+    const std::pair< geode::ComponentMeshElement, geode::ComponentMeshElement >&
+        issue,
+    const geode::ComponentMeshElement& edge1,
+    const geode::ComponentMeshElement& edge2 )
+{
+    return ( issue.first == edge1 && issue.second == edge2 )
+           || ( issue.first == edge2 && issue.second == edge1 );
+}
+
+void check_lines_intersections()
+{
+    geode::BRep model_brep;
+    geode::BRepBuilder builder{ model_brep };
+    const auto straight_id = add_segment_line( builder,
+        geode::Point3D{ { 0, 0, 0 } }, geode::Point3D{ { 4, 0, 0 } } );
+    const auto crossing_id = add_segment_line( builder,
+        geode::Point3D{ { 1, -1, 1 } }, geode::Point3D{ { 1, 1, -1 } } );
+    const auto overlapped_id = add_segment_line( builder,
+        geode::Point3D{ { 0, 5, 0 } }, geode::Point3D{ { 2, 5, 2 } } );
+    const auto overlapping_id = add_segment_line( builder,
+        geode::Point3D{ { 1, 5, 1 } }, geode::Point3D{ { 3, 5, 3 } } );
+    const auto first_neighbour_id = add_segment_line( builder,
+        geode::Point3D{ { 0, 10, 0 } }, geode::Point3D{ { 1, 10, 0 } } );
+    const auto second_neighbour_id = add_segment_line( builder,
+        geode::Point3D{ { 1, 10, 0 } }, geode::Point3D{ { 1, 11, 1 } } );
+    builder.create_unique_vertices( 1 );
+    builder.set_unique_vertex(
+        { model_brep.line( first_neighbour_id ).component_id(), 1 }, 0 );
+    builder.set_unique_vertex(
+        { model_brep.line( second_neighbour_id ).component_id(), 0 }, 0 );
+
+    const geode::BRepLinesIntersections intersections{ model_brep };
+    const auto result = intersections.inspect_lines_intersections();
+    const auto& issues = result.elements_intersections;
+    geode::OpenGeodeInspectorInspectionException::test(
+        issues.nb_issues() == 2, "Lines intersections: ", issues.nb_issues(),
+        " pairs of edges detected instead of 2 (the Lines sharing a unique "
+        "vertex without overlapping should not be reported)." );
+    const geode::ComponentMeshElement straight_edge{
+        model_brep.line( straight_id ).component_id(), 0
+    };
+    const geode::ComponentMeshElement crossing_edge{
+        model_brep.line( crossing_id ).component_id(), 0
+    };
+    const geode::ComponentMeshElement overlapped_edge{
+        model_brep.line( overlapped_id ).component_id(), 0
+    };
+    const geode::ComponentMeshElement overlapping_edge{
+        model_brep.line( overlapping_id ).component_id(), 0
+    };
+    geode::OpenGeodeInspectorInspectionException::test(
+        absl::c_any_of( issues.issues(),
+            [&]( const auto& issue ) {
+                return is_edges_pair( issue, straight_edge, crossing_edge );
+            } ),
+        "Lines intersections: the crossing Lines should be detected." );
+    geode::OpenGeodeInspectorInspectionException::test(
+        absl::c_any_of( issues.issues(),
+            [&]( const auto& issue ) {
+                return is_edges_pair(
+                    issue, overlapped_edge, overlapping_edge );
+            } ),
+        "Lines intersections: the collinear overlap should be detected." );
+}
+
 int main()
 {
     try
@@ -457,6 +615,8 @@ int main()
         check_model_D( false );
         check_wrong_bsurfaces_model();
         check_segmented_cube();
+        check_surfaces_near_misses();
+        check_lines_intersections();
         geode::Logger::info( "TEST SUCCESS" );
         return 0;
     }
@@ -162,6 +162,70 @@ void check_colocation3D()
         "(3D) PointSet has wrong second colocated points group." );
 }
 
+void check_colocation_distance2D()
+{
+    auto pointset = geode::PointSet2D::create();
+    auto builder = geode::PointSetBuilder2D::create( *pointset );
+    builder->create_vertices( 5 );
+    builder->set_point( 0, geode::Point2D{ { 0., 0. } } );
+    builder->set_point( 1, geode::Point2D{ { 5., 5. } } );
+    builder->set_point( 2, geode::Point2D{ { 0.5, 0. } } );
+    builder->set_point( 3, geode::Point2D{ { 1., 0. } } );
+    builder->set_point( 4, geode::Point2D{ { -1.5, 0. } } );
+
+    const geode::PointSetInspector2D inspector{ *pointset };
+    geode::OpenGeodeInspectorInspectionException::test(
+        !inspector.mesh_has_colocated_points( 0.4 ),
+        "PointSet has colocated points within 0.4 when it should have "
+        "none." );
+    geode::OpenGeodeInspectorInspectionException::test(
+        inspector.mesh_has_colocated_points( 0.6 ),
+        "PointSet doesn't have colocated points within 0.6 whereas it "
+        "should have several." );
+    const auto colocated_points_groups =
+        inspector.colocated_points_groups( 0.6 );
+    geode::OpenGeodeInspectorInspectionException::test(
+        colocated_points_groups.nb_issues() == 1,
+        "PointSet has wrong number of colocated groups of points within "
+        "0.6." );
+    const std::vector< geode::index_t > colocated_points_group{ 0, 2, 3 };
+    geode::OpenGeodeInspectorInspectionException::test(
+        colocated_points_groups.issues()[0] == colocated_points_group,
+        "PointSet has wrong colocated points group within 0.6." );
+}
+
+void check_out_of_core_colocation3D()
+{
+    auto pointset = geode::PointSet3D::create();
+    auto builder = geode::PointSetBuilder3D::create( *pointset );
+    builder->create_vertices( 7 );
+    builder->set_point( 0, geode::Point3D{ { 0., 2., 1. } } );
+    builder->set_point( 1, geode::Point3D{ { 0., 2., 1. } } );
+    builder->set_point( 2, geode::Point3D{ { 0., 0., 0. } } );
+    builder->set_point( 3, geode::Point3D{ { 2., 0., 0. } } );
+    builder->set_point( 4, geode::Point3D{ { 1., 4., 3. } } );
+    builder->set_point( 5, geode::Point3D{ { 2., geode::GLOBAL_EPSILON / 2,
+                               geode::GLOBAL_EPSILON / 2 } } );
+    builder->set_point(
+        6, geode::Point3D{ { geode::GLOBAL_EPSILON / 1.1, 2., 1. } } );
+
+    const geode::PointSetInspector3D inspector{ *pointset };
+    geode::OutOfCoreColocationParameters parameters;
+    parameters.chunk_size = 2;
+    geode::OpenGeodeInspectorInspectionException::test(
+        inspector.mesh_has_colocated_points( parameters ),
+        "(3D) PointSet doesn't have out-of-core colocated points whereas it "
+        "should have several." );
+    const auto colocated_points_groups =
+        inspector.colocated_points_groups( parameters );
+    const std::vector< std::vector< geode::index_t > > expected_groups{
+        { 0, 1, 6 }, { 3, 5 }
+    };
+    geode::OpenGeodeInspectorInspectionException::test(
+        colocated_points_groups.issues() == expected_groups,
+        "(3D) PointSet has wrong out-of-core colocated points groups." );
+}
+
 int main()
 {
     try
@@ -171,6 +235,8 @@ int main()
         check_colocation2D();
         check_non_colocation3D();
         check_colocation3D();
+        check_colocation_distance2D();
+        check_out_of_core_colocation3D();
 
         geode::Logger::info( "TEST SUCCESS" );
         return 0;
@@ -21,16 +21,27 @@
  *
  */
 
+#include <array>
+
 #include <geode/tests_config.hpp>
 
 #include <geode/basic/assert.hpp>
 #include <geode/basic/logger.hpp>
+#include <geode/basic/range.hpp>
+
+#include <geode/geometry/point.hpp>
+
+#include <geode/mesh/builder/edged_curve_builder.hpp>
+#include <geode/mesh/core/edged_curve.hpp>
 
+#include <geode/model/mixin/core/line.hpp>
+#include <geode/model/representation/builder/section_builder.hpp>
 #include <geode/model/representation/core/section.hpp>
 #include <geode/model/representation/io/section_input.hpp>
 
 #include <geode/geosciences_io/model/common.hpp>
 
+#include <geode/inspector/inspection/criterion/intersections/model_lines_intersections.hpp>
 #include <geode/inspector/inspection/section_inspector.hpp>
 
 geode::index_t corners_topological_validity(
@@ -182,6 +193,19 @@ geode::index_t meshes_intersections_validity(
     return nb_issues;
 }
 
+geode::index_t lines_intersections_validity(
+    const geode::ElementsIntersectionsInspectionResult& result, bool string )
+{
+    const auto nb_issues = result.elements_intersections.nb_issues();
+    geode::Logger::info(
+        "Section lines intersections check: ", nb_issues, " issues." );
+    if( string )
+    {
+        geode::Logger::info( absl::StrCat( result.string(), "\n" ) );
+    }
+    return nb_issues;
+}
+
 geode::index_t meshes_manifolds_validity(
     const geode::SectionMeshesManifoldInspectionResult& result, bool string )
 {
@@ -248,6 +272,8 @@ geode::index_t launch_component_meshes_validity_checks(
         meshes_degenerations_validity( result.meshes_degenerations, string );
     nb_issues +=
         meshes_intersections_validity( result.meshes_intersections, string );
+    nb_issues +=
+        lines_intersections_validity( result.lines_intersections, string );
     nb_issues +=
         meshes_manifolds_validity( result.meshes_non_manifolds, string );
     nb_issues +=
@@ -291,6 +317,122 @@ void check_section_test()
         section_inspector.section_topology_is_valid() ? "valid." : "invalid." );
 }
 
+geode::uuid add_polyline( geode::SectionBuilder& builder,
+    absl::Span< const geode::Point2D > points )
+{
+    const auto line_id = builder.add_line();
+    auto mesh_builder = builder.line_mesh_builder( line_id );
+    for( const auto& point : points )
+    {
+        mesh_builder->create_point( point );
+    }
+    for( const auto vertex :
+        geode::Range{ 1, static_cast< geode::index_t >( points.size() ) } )
+    {
+        mesh_builder->create_edge( vertex - 1, vertex );
+    }
+    return line_id;
+}
+
+/* Links each vertex of the line to its own new unique vertex. */
+void add_line_unique_vertices( const geode::Section& model_section,
+    geode::SectionBuilder& builder,
+    const geode::uuid& line_id )
+{
+    const auto& line = model_section.line( line_id );
+    const auto first_unique_vertex =
+        builder.create_unique_vertices( line.mesh().nb_vertices() );
+    for( const auto vertex : geode::Range{ line.mesh().nb_vertices() } )
+    {
+        builder.set_unique_vertex(
+            { line.component_id(), vertex }, first_unique_vertex + vertex );
+    }
+}
+
+bool is_edges_pair(
+    const std::pair< geode::ComponentMeshElement, geode::ComponentMeshElement >&
+        issue,
+    const geode::ComponentMeshElement& edge1,
+    const geode::ComponentMeshElement& edge2 )
+{
+    return ( issue.first == edge1 && issue.second == edge2 )
+           || ( issue.first == edge2 && issue.second == edge1 );
+}
+
+void check_lines_intersections()
+{
+    geode::Section model_section;
+    geode::SectionBuilder builder{ model_section };
+    const std::array< geode::Point2D, 2 > straight{ geode::Point2D{ { 0, 0 } },
+        geode::Point2D{ { 4, 0 } } };
+    const auto straight_id = add_polyline( builder, straight );
+    const std::array< geode::Point2D, 2 > crossing{ geode::Point2D{ { 1, -1 } },
+        geode::Point2D{ { 1, 1 } } };
+    const auto crossing_id = add_polyline( builder, crossing );
+    const std::array< geode::Point2D, 2 > overlapped{
+        geode::Point2D{ { 0, 5 } }, geode::Point2D{ { 2, 5 } }
+    };
+    const auto overlapped_id = add_polyline( builder, overlapped );
+    const std::array< geode::Point2D, 2 > overlapping{
+        geode::Point2D{ { 1, 5 } }, geode::Point2D{ { 3, 5 } }
+    };
+    const auto overlapping_id = add_polyline( builder, overlapping );
+    const std::array< geode::Point2D, 5 > self_crossing{
+        geode::Point2D{ { 0, 10 } }, geode::Point2D{ { 2, 10 } },
+        geode::Point2D{ { 2, 12 } }, geode::Point2D{ { 1, 12 } },
+        geode::Point2D{ { 1, 9 } }
+    };
+    const auto self_crossing_id = add_polyline( builder, self_crossing );
+    const std::array< geode::Point2D, 2 > first_neighbour{
+        geode::Point2D{ { 0, 15 } }, geode::Point2D{ { 1, 15 } }
+    };
+    const auto first_neighbour_id = add_polyline( builder, first_neighbour );
+    const std::array< geode::Point2D, 2 > second_neighbour{
+        geode::Point2D{ { 1, 15 } }, geode::Point2D{ { 1, 16 } }
+    };
+    const auto second_neighbour_id = add_polyline( builder, second_neighbour );
+    for( const auto& line : model_section.lines() )
+    {
+        add_line_unique_vertices( model_section, builder, line.id() );
+    }
+    builder.set_unique_vertex(
+        { model_section.line( second_neighbour_id ).component_id(), 0 },
+        model_section.unique_vertex(
+            { model_section.line( first_neighbour_id ).component_id(), 1 } ) );
+
+    const geode::SectionLinesIntersections intersections{ model_section };
+    const auto result = intersections.inspect_lines_intersections();
+    const auto& issues = result.elements_intersections;
+    geode::OpenGeodeInspectorInspectionException::test(
+        issues.nb_issues() == 3, "Lines intersections: ", issues.nb_issues(),
+        " pairs of edges detected instead of 3 (edges sharing an end vertex "
+        "without overlapping should not be reported)." );
+    const auto edge = [&model_section](
+                          const geode::uuid& line_id, geode::index_t edge_id ) {
+        return geode::ComponentMeshElement{
+            model_section.line( line_id ).component_id(), edge_id
+        };
+    };
+    const std::array< std::pair< geode::ComponentMeshElement,
+                          geode::ComponentMeshElement >,
+        3 >
+        expected_pairs{ { { edge( straight_id, 0 ), edge( crossing_id, 0 ) },
+            { edge( overlapped_id, 0 ), edge( overlapping_id, 0 ) },
+            { edge( self_crossing_id, 0 ), edge( self_crossing_id, 3 ) } } };
+    for( const auto& expected_pair : expected_pairs )
+    {
+        geode::OpenGeodeInspectorInspectionException::test(
+            absl::c_any_of( issues.issues(),
+                [&expected_pair]( const auto& issue ) {
+                    return is_edges_pair(
+                        issue, expected_pair.first, expected_pair.second );
+                } ),
+            "Lines intersections: edges ", expected_pair.first.element_id,
+            " and ", expected_pair.second.element_id,
+            " should be detected as intersecting." );
+    }
+}
+
 int main()
 {
     try
@@ -300,6 +442,7 @@ int main()
         geode::Logger::set_level( geode::Logger::LEVEL::trace );
         check_section( false );
         check_section_test();
+        check_lines_intersections();
 
         geode::Logger::info( "TEST SUCCESS" );
         return 0;
@@ -21,6 +21,8 @@
  *
  */
 
+#include <array>
+
 #include <absl/container/flat_hash_set.h>
 
 #include <geode/basic/assert.hpp>
@@ -94,6 +96,35 @@ void check_intersections2D()
             "elements pair: (triangle = ",
             inter.first, ", edge = ", inter.second, ")" );
     }
+
+    auto far_curve = geode::EdgedCurve2D::create();
+    auto far_curve_builder = geode::EdgedCurveBuilder2D::create( *far_curve );
+    far_curve_builder->create_vertices( 2 );
+    far_curve_builder->set_point( 0, geode::Point2D{ { 5., 5. } } );
+    far_curve_builder->set_point( 1, geode::Point2D{ { 6., 5. } } );
+    far_curve_builder->create_edge( 0, 1 );
+
+    const geode::SurfaceCurvesIntersections2D curves_inspector{ *surface };
+    const std::array< const geode::EdgedCurve2D*, 3 > curves{ curve.get(),
+        far_curve.get(), curve.get() };
+    const auto curves_intersect =
+        curves_inspector.curves_have_intersections( curves );
+    geode::OpenGeodeInspectorInspectionException::test(
+        curves_intersect == std::vector< bool >{ true, false, true },
+        "2D Surface and Curves should have intersections only with the "
+        "first and third curves." );
+    const auto curves_result =
+        curves_inspector.curves_intersecting_elements( curves );
+    geode::OpenGeodeInspectorInspectionException::test(
+        curves_result.size() == 3 && curves_result[0].nb_issues() == 7
+            && curves_result[1].nb_issues() == 0
+            && curves_result[2].nb_issues() == 7,
+        "2D Surface and Curves should have 7, 0 and 7 intersecting "
+        "elements pairs." );
+    geode::OpenGeodeInspectorInspectionException::test(
+        curves_result[0].issues() == intersection_result.issues(),
+        "2D Surface and Curves should give the same intersecting elements "
+        "pairs as the single curve inspection." );
 }
 
 void check_intersections3D()